@@ -0,0 +1,516 @@
+/**
+ * @file main.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief This example measure speed of fast paths of Reflex against per-field scanning
+ * @version 0.1
+ * @date 2023-04-08
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Reflex.h"
+#include "ReflexPacker.h"
+#include "ReflexJson.h"
+
+#define PRINTF                      printf
+
+#define BENCH_COUNT                 4096
+#define BENCH_ROUNDS                200
+#define BENCH_COLD_ROUNDS           20
+#define BENCH_COLD_POOL             (64 * 1024 * 1024)
+#define BENCH_COLD_SLOT             256
+// output bytes of each object, JSON text is bigger than object
+#define BENCH_OUT_OBJECT            512
+
+typedef struct {
+    const char*     Name;
+    void            (*run)(void);
+    void            (*setup)(void);         /**< run before each round, it's not measured */
+    uint32_t        Rounds;
+    Reflex_PtrType  Bytes;                  /**< bytes written in each run */
+} Bench;
+
+#define BENCH_INIT(NAME)                    { #NAME, NAME, NULL, BENCH_ROUNDS, 0 }
+#define BENCH_INIT_SETUP(NAME, SETUP, ROUNDS)   { #NAME, NAME, SETUP, ROUNDS, 0 }
+
+void Bench_print(Bench* bench);
+uint32_t Bench_checksum(const uint8_t* buf, Reflex_PtrType len);
+
+/* ----------------------------- Bench Model ------------------------- */
+typedef struct {
+    uint8_t     V0;
+    uint32_t    V1;
+    int16_t     V2[3];
+    double      V3;
+    char        V4[5];
+    uint16_t    V5[20];
+    uint32_t    V6[9];
+    float       V7;
+} BenchModel;
+static const Reflex_TypeParams BenchModel_FMT[] = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Int16, 3, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Double),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Char, 5, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt16, 20, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 9, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Float),
+};
+static const Reflex_Schema BenchModel_SCHEMA = REFLEX_SCHEMA(Reflex_FormatMode_Param, BenchModel_FMT);
+
+static BenchModel benchObjects[BENCH_COUNT];
+static uint8_t benchOut[BENCH_COUNT * BENCH_OUT_OBJECT];
+static Reflex_PtrType benchLen;
+
+/* ----------------------------- Bench Packer ------------------------ */
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_PACKED
+static Reflex_PackRun packRuns[8];
+static Reflex_Packer packer;
+static Reflex_PackRun swapRuns[8];
+static Reflex_Packer swapPacker;
+
+/**
+ * @brief This callback copy field into buffer and reverse bytes of each item
+ */
+Reflex_Result Bench_swapField(Reflex* reflex, void* value, const void* fmt) {
+    Reflex_TypeParams item = *(const Reflex_TypeParams*) fmt;
+    uint8_t* buf = (uint8_t*) Reflex_getBuffer(reflex);
+    uint8_t* src = (uint8_t*) value;
+    Reflex_LenType len = Reflex_sizeType(&item);
+    Reflex_LenType itemSize;
+    Reflex_LenType index;
+    Reflex_LenType byte;
+
+    item.Fields.Category = Reflex_Category_Primary;
+    itemSize = Reflex_sizeType(&item);
+    for (index = 0; index < len; index += itemSize) {
+        for (byte = 0; byte < itemSize; byte++) {
+            buf[index + byte] = src[index + itemSize - 1 - byte];
+        }
+    }
+    Reflex_setBuffer(reflex, buf + len);
+
+    return REFLEX_OK;
+}
+
+void Bench_Scan_Packed(void) {
+    Reflex_PtrType index;
+
+    benchLen = 0;
+    for (index = 0; index < BENCH_COUNT; index++) {
+        benchLen += Reflex_Packed_encode(&BenchModel_SCHEMA, &benchObjects[index], benchOut + benchLen);
+    }
+}
+
+void Bench_Packer(void) {
+    benchLen = Reflex_Packer_encode(&packer, benchObjects, BENCH_COUNT, 0, benchOut);
+}
+
+void Bench_Scan_Swap(void) {
+    Reflex reflex = {0};
+
+    Reflex_init(&reflex, &BenchModel_SCHEMA);
+    Reflex_setCallback(&reflex, Bench_swapField);
+    Reflex_setBuffer(&reflex, benchOut);
+    Reflex_scanArray(&reflex, benchObjects, BENCH_COUNT, sizeof(BenchModel));
+    benchLen = (Reflex_PtrType) ((uint8_t*) Reflex_getBuffer(&reflex) - benchOut);
+}
+
+void Bench_Packer_Swap(void) {
+    benchLen = Reflex_Packer_encode(&swapPacker, benchObjects, BENCH_COUNT, 0, benchOut);
+}
+#endif // REFLEX_SUPPORT_PACKER
+
+/* ----------------------------- Bench Binary ------------------------ */
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+static Reflex_PlanOp binaryPlan[32];
+static BenchModel benchDecoded[BENCH_COUNT];
+
+void Bench_Binary_encode(void) {
+    Reflex reflex = {0};
+    Reflex_PtrType index;
+
+    benchLen = 0;
+    for (index = 0; index < BENCH_COUNT; index++) {
+        benchLen += Reflex_Binary_encode(&reflex, binaryPlan, &benchObjects[index], benchOut + benchLen, sizeof(BenchModel));
+    }
+}
+
+void Bench_Binary_decode(void) {
+    Reflex reflex = {0};
+    Reflex_PtrType index;
+    Reflex_PtrType len = 0;
+
+    for (index = 0; index < BENCH_COUNT; index++) {
+        len += Reflex_Binary_decode(&reflex, binaryPlan, &benchDecoded[index], benchOut + len, sizeof(BenchModel));
+    }
+    // bytes of decode are bytes that read
+    benchLen = len;
+}
+#if REFLEX_SUPPORT_BYTE_ORDER
+void Bench_Binary_network(void) {
+    Reflex reflex = {0};
+    Reflex_PtrType index;
+
+    benchLen = 0;
+    for (index = 0; index < BENCH_COUNT; index++) {
+        benchLen += Reflex_Binary_encodeOrder(&reflex, binaryPlan, &benchObjects[index], benchOut + benchLen, sizeof(BenchModel), Reflex_ByteOrder_Network);
+    }
+}
+#endif
+#endif // REFLEX_SUPPORT_BINARY
+
+/* ----------------------------- Bench Json ------------------------ */
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER
+static Reflex_PtrType jsonLens[BENCH_COUNT];
+
+void Bench_Json_encode(void) {
+    Reflex reflex = {0};
+    Reflex_PtrType index;
+
+    Reflex_init(&reflex, &BenchModel_SCHEMA);
+    benchLen = 0;
+    for (index = 0; index < BENCH_COUNT; index++) {
+        jsonLens[index] = Reflex_Json_encode(&reflex, &benchObjects[index], benchOut + benchLen, BENCH_OUT_OBJECT);
+        benchLen += jsonLens[index];
+    }
+}
+/**
+ * Same JSON text with snprintf per field and per item, only for compare
+ */
+void Bench_Json_snprintf(void) {
+    const BenchModel* obj;
+    char* out = (char*) benchOut;
+    Reflex_PtrType index;
+    uint8_t item;
+
+    for (index = 0; index < BENCH_COUNT; index++) {
+        obj = &benchObjects[index];
+        out += snprintf(out, 32, "[%u,%u,[", obj->V0, (unsigned) obj->V1);
+        for (item = 0; item < 3; item++) {
+            out += snprintf(out, 32, item ? ",%d" : "%d", obj->V2[item]);
+        }
+        out += snprintf(out, 64, "],%.17g,\"%.5s\",[", obj->V3, obj->V4);
+        for (item = 0; item < 20; item++) {
+            out += snprintf(out, 32, item ? ",%u" : "%u", obj->V5[item]);
+        }
+        out += snprintf(out, 8, "],[");
+        for (item = 0; item < 9; item++) {
+            out += snprintf(out, 32, item ? ",%u" : "%u", (unsigned) obj->V6[item]);
+        }
+        out += snprintf(out, 64, "],%.9g]", obj->V7);
+    }
+    benchLen = (Reflex_PtrType) (out - (char*) benchOut);
+}
+#if REFLEX_SUPPORT_PLAN
+static Reflex_PlanOp jsonPlan[32];
+static Reflex_JsonReader jsonReader;
+static BenchModel jsonDecoded[BENCH_COUNT];
+
+/**
+ * Text of Bench_Json_encode is read back, so it must run before this bench
+ */
+void Bench_Json_decode(void) {
+    Reflex_PtrType index;
+    Reflex_PtrType len = 0;
+
+    for (index = 0; index < BENCH_COUNT; index++) {
+        Reflex_Json_decode(&jsonReader, &jsonDecoded[index], benchOut + len, jsonLens[index]);
+        len += jsonLens[index];
+    }
+    // bytes of decode are bytes that read
+    benchLen = len;
+}
+#endif // REFLEX_SUPPORT_PLAN
+#endif // REFLEX_SUPPORT_JSON
+
+#if REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_POINTER_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY)
+/**
+ * @brief This callback read first byte of each field
+ */
+Reflex_Result Bench_readField(Reflex* reflex, void* value, const void* fmt) {
+    uint32_t* sum = (uint32_t*) Reflex_getArgs(reflex);
+
+    if (((const Reflex_TypeParams*) fmt)->Fields.Primary != Reflex_PrimaryType_Complex) {
+        *sum += *(const uint8_t*) value;
+    }
+
+    return REFLEX_OK;
+}
+#endif
+
+/* ----------------------------- Bench Cold Pointers ------------------------ */
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+/**
+ * Objects of pointer array are placed in random slots of a big pool and caches are
+ * flushed before each round, so each object is a cache miss,
+ * build with REFLEX_PREFETCH_DISTANCE=0 for compare without prefetch
+ */
+typedef struct {
+    uint32_t    V0;
+    uint8_t     V1[60];
+    double      V2;
+    uint32_t    V3[16];
+} ColdItem;
+static const Reflex_TypeParams ColdItem_FMT[] = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt8, 60, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Double),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 16, 0),
+};
+static const Reflex_Schema ColdItem_SCHEMA = REFLEX_SCHEMA(Reflex_FormatMode_Param, ColdItem_FMT);
+
+typedef struct {
+    ColdItem*   Items[BENCH_COUNT];
+} ColdModel;
+static const Reflex_TypeParams ColdModel_FMT[] = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Complex, BENCH_COUNT, 0, &ColdItem_SCHEMA),
+};
+static const Reflex_Schema ColdModel_SCHEMA = REFLEX_SCHEMA(Reflex_FormatMode_Param, ColdModel_FMT);
+
+static ColdModel coldModel;
+static uint8_t* coldPool;
+static uint8_t* coldFlush;
+static volatile uint32_t coldSink;
+
+
+void Bench_Cold_init(void) {
+    uint32_t slots = BENCH_COLD_POOL / BENCH_COLD_SLOT;
+    uint32_t index;
+    uint32_t slot;
+
+    coldPool = (uint8_t*) malloc(BENCH_COLD_POOL);
+    coldFlush = (uint8_t*) malloc(BENCH_COLD_POOL);
+    memset(coldPool, 1, BENCH_COLD_POOL);
+    // random distinct slots, slots are used once because pool has much more slots than items
+    srand(1);
+    for (index = 0; index < BENCH_COUNT; index++) {
+        slot = (uint32_t) (((uint32_t) rand() << 15 ^ (uint32_t) rand()) % (slots / BENCH_COUNT)) * BENCH_COUNT + index;
+        coldModel.Items[index] = (ColdItem*) (coldPool + (Reflex_PtrType) slot * BENCH_COLD_SLOT);
+    }
+    // shuffle order of items
+    for (index = BENCH_COUNT - 1; index > 0; index--) {
+        ColdItem* tmp = coldModel.Items[index];
+        slot = (uint32_t) rand() % (index + 1);
+        coldModel.Items[index] = coldModel.Items[slot];
+        coldModel.Items[slot] = tmp;
+    }
+}
+
+void Bench_Cold_flush(void) {
+    Reflex_PtrType index;
+
+    for (index = 0; index < BENCH_COLD_POOL; index += 64) {
+        coldFlush[index]++;
+    }
+}
+
+void Bench_Scan_ColdPointers(void) {
+    Reflex reflex = {0};
+    uint32_t sum = 0;
+
+    Reflex_init(&reflex, &ColdModel_SCHEMA);
+    Reflex_setCallback(&reflex, Bench_readField);
+    Reflex_setArgs(&reflex, &sum);
+    Reflex_scan(&reflex, &coldModel);
+    coldSink = sum;
+    benchLen = (Reflex_PtrType) BENCH_COUNT * sizeof(ColdItem);
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+
+/* ----------------------------- Bench Complex Array ------------------------ */
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_ARRAY
+/**
+ * Elements of complex array have fixed layout, array scan compute layout of first elements only,
+ * per element scan compute layout of each element again
+ */
+typedef struct {
+    uint32_t    V0;
+    uint16_t    V1[3];
+    float       V2;
+} ArrayInner;
+static const Reflex_TypeParams ArrayInner_FMT[] = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt16, 3, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Float),
+};
+static const Reflex_Schema ArrayInner_SCHEMA = REFLEX_SCHEMA(Reflex_FormatMode_Param, ArrayInner_FMT);
+
+typedef struct {
+    uint8_t     V0;
+    ArrayInner  V1;
+    uint16_t    V2;
+    uint8_t     V3;
+} ArrayItem;
+static const Reflex_TypeParams ArrayItem_FMT[] = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Complex, 0, 0, &ArrayInner_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema ArrayItem_SCHEMA = REFLEX_SCHEMA(Reflex_FormatMode_Param, ArrayItem_FMT);
+
+typedef struct {
+    ArrayItem   Items[BENCH_COUNT];
+} ArrayModel;
+static const Reflex_TypeParams ArrayModel_FMT[] = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, BENCH_COUNT, 0, &ArrayItem_SCHEMA),
+};
+static const Reflex_Schema ArrayModel_SCHEMA = REFLEX_SCHEMA(Reflex_FormatMode_Param, ArrayModel_FMT);
+
+static ArrayModel arrayModel;
+
+void Bench_Scan_ComplexArray(void) {
+    Reflex reflex = {0};
+    uint32_t sum = 0;
+
+    Reflex_init(&reflex, &ArrayModel_SCHEMA);
+    Reflex_setCallback(&reflex, Bench_readField);
+    Reflex_setArgs(&reflex, &sum);
+    Reflex_scan(&reflex, &arrayModel);
+    memcpy(benchOut, &sum, sizeof(sum));
+    benchLen = sizeof(arrayModel);
+}
+
+void Bench_Scan_ComplexElements(void) {
+    Reflex reflex = {0};
+    uint32_t sum = 0;
+    uint32_t index;
+
+    Reflex_init(&reflex, &ArrayItem_SCHEMA);
+    Reflex_setCallback(&reflex, Bench_readField);
+    Reflex_setArgs(&reflex, &sum);
+    for (index = 0; index < BENCH_COUNT; index++) {
+        Reflex_scan(&reflex, &arrayModel.Items[index]);
+    }
+    memcpy(benchOut, &sum, sizeof(sum));
+    benchLen = sizeof(arrayModel);
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_ARRAY
+
+static Bench Benches[] = {
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_PACKED
+    BENCH_INIT(Bench_Scan_Packed),
+    BENCH_INIT(Bench_Packer),
+    BENCH_INIT(Bench_Scan_Swap),
+    BENCH_INIT(Bench_Packer_Swap),
+#endif
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    BENCH_INIT(Bench_Binary_encode),
+    BENCH_INIT(Bench_Binary_decode),
+#endif
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_BYTE_ORDER
+    BENCH_INIT(Bench_Binary_network),
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER
+    BENCH_INIT(Bench_Json_encode),
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_PLAN
+    BENCH_INIT(Bench_Json_decode),
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER
+    BENCH_INIT(Bench_Json_snprintf),
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    BENCH_INIT_SETUP(Bench_Scan_ColdPointers, Bench_Cold_flush, BENCH_COLD_ROUNDS),
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_ARRAY
+    BENCH_INIT(Bench_Scan_ComplexArray),
+    BENCH_INIT(Bench_Scan_ComplexElements),
+#endif
+};
+static const uint32_t Benches_Len = sizeof(Benches) / sizeof(Benches[0]);
+
+int main(void) {
+    uint32_t index;
+
+    for (index = 0; index < sizeof(benchObjects); index++) {
+        ((uint8_t*) benchObjects)[index] = (uint8_t) (index * 31 + 7);
+    }
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_ARRAY
+    memcpy(&arrayModel, benchObjects, sizeof(arrayModel));
+#endif
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_PACKED
+    Reflex_Packer_bind(&packer, &BenchModel_SCHEMA, packRuns, 8, 0);
+    Reflex_Packer_bind(&swapPacker, &BenchModel_SCHEMA, swapRuns, 8, 1);
+    PRINTF("Packer: SIMD %d, Block %d, Runs %d\r\n", REFLEX_PACKER_SIMD, REFLEX_PACKER_BLOCK, packer.Len);
+#endif
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    Reflex_compile(&BenchModel_SCHEMA, binaryPlan, sizeof(binaryPlan) / sizeof(binaryPlan[0]));
+    PRINTF("Binary: Record %d\r\n", (int) Reflex_Binary_sizeFixed(binaryPlan));
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_PLAN
+    Reflex_compile(&BenchModel_SCHEMA, jsonPlan, sizeof(jsonPlan) / sizeof(jsonPlan[0]));
+    Reflex_Json_bind(&jsonReader, &BenchModel_SCHEMA, jsonPlan, NULL, 0);
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    Bench_Cold_init();
+    PRINTF("Prefetch: Distance %d, Lines %d\r\n", REFLEX_PREFETCH_DISTANCE, REFLEX_PREFETCH_LINES);
+#endif
+
+    PRINTF("%-24s %12s %12s %12s\r\n", "Bench", "ns/object", "GB/s", "Checksum");
+    for (index = 0; index < Benches_Len; index++) {
+        Bench_print(&Benches[index]);
+    }
+
+    return 0;
+}
+/**
+ * @brief This function run bench for it's rounds and print time of each object,
+ * setup of bench run before each round out of measured time
+ *
+ * @param bench
+ */
+void Bench_print(Bench* bench) {
+    clock_t start;
+    clock_t ticks = 0;
+    double seconds;
+    uint32_t round;
+
+    // warm up
+    bench->run();
+    if (bench->setup == NULL) {
+        start = clock();
+        for (round = 0; round < bench->Rounds; round++) {
+            bench->run();
+        }
+        ticks = clock() - start;
+    }
+    else {
+        for (round = 0; round < bench->Rounds; round++) {
+            bench->setup();
+            start = clock();
+            bench->run();
+            ticks += clock() - start;
+        }
+    }
+    seconds = (double) ticks / CLOCKS_PER_SEC;
+    bench->Bytes = benchLen;
+
+    PRINTF("%-24s %12.2f %12.3f %12x\r\n", bench->Name,
+        seconds * 1e9 / ((double) bench->Rounds * BENCH_COUNT),
+        seconds > 0 ? (double) bench->Bytes * bench->Rounds / seconds / 1e9 : 0.0,
+        bench->setup == NULL ? Bench_checksum(benchOut, bench->Bytes) : 0);
+}
+/**
+ * @brief This function return simple checksum of output, same output of benches give same checksum
+ *
+ * @param buf
+ * @param len
+ * @return uint32_t
+ */
+uint32_t Bench_checksum(const uint8_t* buf, Reflex_PtrType len) {
+    uint32_t sum = 0;
+
+    while (len-- > 0) {
+        sum = sum * 31 + *buf++;
+    }
+
+    return sum;
+}
@@ -6,6 +6,10 @@
 #endif
 
 #include "Reflex.h"
+#include "ReflexInline.h"
+#include "ReflexParallel.h"
+#include "ReflexPacker.h"
+#include "ReflexJson.h"
 
 #define PRINTLN						puts
 #define PRINTF						printf
@@ -47,10 +51,82 @@ static const char FOOTER[] CONST_VAR_ATTR = "-----------------------------------
 #endif
 #if REFLEX_SUPPORT_TYPE_COMPLEX
     Test_Result Test_ComplexType(void);
+#if REFLEX_SUPPORT_TYPE_ARRAY && REFLEX_SUPPORT_TYPE_ARRAY_2D
+    Test_Result Test_ComplexStride(void);
+#endif
 #endif
 #if REFLEX_SUPPORT_SIZE_FN
     Test_Result Test_Size(void);
 #endif
+#if REFLEX_SUPPORT_SIZE_FN && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_LargeObject(void);
+#endif
+#if REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_ScanArray(void);
+#endif
+#if REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Plan(void);
+#endif
+#if REFLEX_SUPPORT_SCAN_MASKED && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_ScanMasked(void);
+#endif
+#if REFLEX_SUPPORT_SCAN_RUNS && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER
+    Test_Result Test_ScanRuns(void);
+#endif
+#if REFLEX_SUPPORT_HASH && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_Hash(void);
+#endif
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_Compare(void);
+#endif
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_Binary(void);
+#endif
+#if REFLEX_SUPPORT_BYTE_ORDER && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_ByteOrder(void);
+#endif
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_View(void);
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_ARRAY_2D && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_Json(void);
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_ARRAY_2D && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM && REFLEX_SUPPORT_PLAN
+    Test_Result Test_JsonDecode(void);
+#endif
+#if REFLEX_SUPPORT_INDEX && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Index(void);
+#endif
+#if REFLEX_SUPPORT_CURSOR && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Cursor(void);
+#endif
+#if REFLEX_PREFETCH_DISTANCE > 0 && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_CURSOR && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_Prefetch(void);
+#endif
+#if REFLEX_SUPPORT_STACK_SCAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Stack(void);
+#endif
+#if REFLEX_SUPPORT_CONFIG && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Config(void);
+#endif
+#if REFLEX_SUPPORT_BATCH && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Batch(void);
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Inline(void);
+#endif
+#if REFLEX_SUPPORT_SCAN_COLUMNS && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    Test_Result Test_Columns(void);
+#endif
+#if REFLEX_SUPPORT_PARALLEL && REFLEX_SUPPORT_CONFIG && REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+    Test_Result Test_Parallel(void);
+#if REFLEX_SUPPORT_PACKED
+    Test_Result Test_ParallelEncode(void);
+#endif
+#endif
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_PACKED && REFLEX_FORMAT_MODE_PARAM && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE
+    Test_Result Test_Packer(void);
+#endif
 
 #if REFLEX_SUPPORT_SCAN_FIELD
 #if REFLEX_FORMAT_MODE_PARAM
@@ -87,6 +163,9 @@ const TestCase Tests[] = {
 #endif
 #if REFLEX_SUPPORT_TYPE_COMPLEX
     TEST_CASE_INIT(Test_ComplexType),
+#if REFLEX_SUPPORT_TYPE_ARRAY && REFLEX_SUPPORT_TYPE_ARRAY_2D
+    TEST_CASE_INIT(Test_ComplexStride),
+#endif
 #endif
 #if REFLEX_SUPPORT_SCAN_FIELD
 #if REFLEX_FORMAT_MODE_PARAM
@@ -108,6 +187,75 @@ const TestCase Tests[] = {
 #if REFLEX_SUPPORT_SIZE_FN
     TEST_CASE_INIT(Test_Size),
 #endif
+#if REFLEX_SUPPORT_SIZE_FN && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_LargeObject),
+#endif
+#if REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_ScanArray),
+#endif
+#if REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Plan),
+#endif
+#if REFLEX_SUPPORT_SCAN_MASKED && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_ScanMasked),
+#endif
+#if REFLEX_SUPPORT_SCAN_RUNS && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER
+    TEST_CASE_INIT(Test_ScanRuns),
+#endif
+#if REFLEX_SUPPORT_HASH && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_Hash),
+#endif
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_Compare),
+#endif
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_Binary),
+#endif
+#if REFLEX_SUPPORT_BYTE_ORDER && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_ByteOrder),
+#endif
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_View),
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_ARRAY_2D && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_Json),
+#endif
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_ARRAY_2D && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM && REFLEX_SUPPORT_PLAN
+    TEST_CASE_INIT(Test_JsonDecode),
+#endif
+#if REFLEX_SUPPORT_INDEX && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Index),
+#endif
+#if REFLEX_SUPPORT_CURSOR && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Cursor),
+#endif
+#if REFLEX_PREFETCH_DISTANCE > 0 && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_CURSOR && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_Prefetch),
+#endif
+#if REFLEX_SUPPORT_STACK_SCAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Stack),
+#endif
+#if REFLEX_SUPPORT_CONFIG && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Config),
+#endif
+#if REFLEX_SUPPORT_BATCH && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Batch),
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Inline),
+#endif
+#if REFLEX_SUPPORT_SCAN_COLUMNS && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    TEST_CASE_INIT(Test_Columns),
+#endif
+#if REFLEX_SUPPORT_PARALLEL && REFLEX_SUPPORT_CONFIG && REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+    TEST_CASE_INIT(Test_Parallel),
+#if REFLEX_SUPPORT_PACKED
+    TEST_CASE_INIT(Test_ParallelEncode),
+#endif
+#endif
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_PACKED && REFLEX_FORMAT_MODE_PARAM && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE
+    TEST_CASE_INIT(Test_Packer),
+#endif
 };
 const uint32_t Tests_Len = sizeof(Tests) / sizeof(Tests[0]);
 
@@ -529,6 +677,24 @@ static const Reflex_TypeParams CModel3_FMT[] CONST_VAR_ATTR = {
 };
 static const Reflex_Schema CModel3_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, CModel3_FMT);
 
+typedef struct {
+    uint8_t         V0;
+    Model2          V1[64];
+    uint16_t        V2;
+    Model1*         V3[16];
+    Model1          V4[8][8];
+    uint8_t         V5;
+} CModel5;
+static const Reflex_TypeParams CModel5_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 64, 0, &Model2_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Complex, 16, 0, &Model1_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_Complex, 8, 8, &Model1_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema CModel5_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, CModel5_FMT);
+
 
 
 Test_Result Test_ComplexType(void) {
@@ -828,6 +994,7 @@ Test_Result Test_ComplexType_GetField(void) {
     CModel1 temp1 = {0};
     CModel2 temp2 = {0};
     CModel3 temp3 = {0};
+    CModel5 temp4 = {0};
 
     // Find in temp1
     reflex.Schema = &CModel1_SCHEMA;
@@ -885,10 +1052,129 @@ Test_Result Test_ComplexType_GetField(void) {
     Assert_getFieldByIndex(temp3.V12.V2, 3);
     Assert_getFieldByIndex(temp3.V12.V2, 4);
 
+    // Find in temp4, fields after large complex arrays
+    reflex.Schema = &CModel5_SCHEMA;
+    Assert_getFieldByIndex(temp4, 0);
+    Assert_getFieldByIndex(temp4, 1);
+    Assert_getFieldByIndex(temp4, 2);
+    assert(Num, Reflex_Field_getVarOffset(&field), 253);
+    assert(Ptr, Reflex_Field_getMainVariable(&field), &temp4);
+    Assert_getFieldByIndex(temp4, 3);
+    Assert_getFieldByIndex(temp4, 4);
+    assert(Num, Reflex_Field_getVarOffset(&field), 333);
+    Assert_getFieldByIndex(temp4, 5);
+    assert(Num, Reflex_Field_getVarOffset(&field), 653);
+    assert(Ptr, Reflex_Field_getMainVariable(&field), &temp4);
+
     return 0;
 }
 #endif
 #endif
+// -------------------------- Test Complex Stride -------------------------
+#if REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_ARRAY && REFLEX_SUPPORT_TYPE_ARRAY_2D
+typedef struct {
+    uint8_t         V0;
+    Model2          V1;
+    uint16_t        V2;
+} StrideItem;
+static const Reflex_TypeParams StrideItem_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Complex, 0, 0, &Model2_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+};
+static const Reflex_Schema StrideItem_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, StrideItem_FMT);
+
+typedef struct {
+    uint32_t        V0;
+    StrideItem      V1[5];
+    uint32_t        V2;
+    StrideItem      V3[2][3];
+    uint32_t        V4;
+    PrimaryTemp1    V5[4];
+} StrideModel;
+static const Reflex_TypeParams StrideModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 5, 0, &StrideItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_Complex, 3, 2, &StrideItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 4, 0, &PrimaryTemp1_SCHEMA),
+};
+static const Reflex_Schema StrideModel_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, StrideModel_FMT);
+
+typedef struct {
+    void*           Addr[96];
+    uint32_t        Len;
+} AddressRecorder;
+
+Reflex_Result Reflex_recordAddress(Reflex* reflex, void* value, const void* fmt) {
+    AddressRecorder* recorder = (AddressRecorder*) reflex->Args;
+
+    if (((const Reflex_TypeParams*) fmt)->Fields.Primary != Reflex_PrimaryType_Complex) {
+        recorder->Addr[recorder->Len++] = value;
+    }
+
+    return REFLEX_OK;
+}
+
+static void StrideItem_addresses(StrideItem* item, AddressRecorder* expected) {
+    expected->Addr[expected->Len++] = &item->V0;
+    expected->Addr[expected->Len++] = &item->V1.V0;
+    expected->Addr[expected->Len++] = &item->V1.V1;
+    expected->Addr[expected->Len++] = &item->V1.V2;
+    expected->Addr[expected->Len++] = &item->V1.V3;
+    expected->Addr[expected->Len++] = &item->V2;
+}
+
+Test_Result Test_ComplexStride(void) {
+    Reflex reflex = {0};
+    StrideModel temp;
+    AddressRecorder expected = {0};
+    AddressRecorder actual = {0};
+    uint32_t index;
+
+    // elements after first one are scanned with known stride, fields of them must be same as full layout
+    expected.Addr[expected.Len++] = &temp.V0;
+    for (index = 0; index < 5; index++) {
+        StrideItem_addresses(&temp.V1[index], &expected);
+    }
+    expected.Addr[expected.Len++] = &temp.V2;
+    for (index = 0; index < 6; index++) {
+        StrideItem_addresses(&temp.V3[index / 3][index % 3], &expected);
+    }
+    expected.Addr[expected.Len++] = &temp.V4;
+    for (index = 0; index < 4; index++) {
+        expected.Addr[expected.Len++] = &temp.V5[index].V0;
+        expected.Addr[expected.Len++] = &temp.V5[index].V1;
+        expected.Addr[expected.Len++] = &temp.V5[index].V2;
+    }
+
+    Reflex_init(&reflex, &StrideModel_SCHEMA);
+    Reflex_setCallback(&reflex, Reflex_recordAddress);
+    Reflex_setArgs(&reflex, &actual);
+    assert(Num, Reflex_scan(&reflex, &temp), REFLEX_OK);
+    assert(Num, actual.Len, expected.Len);
+    for (index = 0; index < expected.Len; index++) {
+        assert(Ptr, actual.Addr[index], expected.Addr[index]);
+    }
+    assert(Ptr, reflex.PObj, &temp + 1);
+
+    // elements scanned one by one with full layout
+    actual.Len = 0;
+    Reflex_init(&reflex, &StrideItem_SCHEMA);
+    Reflex_setCallback(&reflex, Reflex_recordAddress);
+    Reflex_setArgs(&reflex, &actual);
+    for (index = 0; index < 5; index++) {
+        assert(Num, Reflex_scan(&reflex, &temp.V1[index]), REFLEX_OK);
+        assert(Ptr, reflex.PObj, &temp.V1[index + 1]);
+    }
+    for (index = 0; index < actual.Len; index++) {
+        assert(Ptr, actual.Addr[index], expected.Addr[index + 1]);
+    }
+
+    return 0;
+}
+#endif
 // -------------------------- Test Size -------------------------
 #if REFLEX_SUPPORT_SIZE_FN
 Test_Result Test_Size(void) {
@@ -910,16 +1196,2587 @@ Test_Result Test_Size(void) {
     assert(Num, Reflex_size(&Model2_SCHEMA_OFFSET, Reflex_SizeType_Normal), sizeof(Model2));
 #endif
 
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // size of complex fields is not known in schema
+    assert(Num, Reflex_size(&CModel1_SCHEMA, Reflex_SizeType_Normal), -1);
+    assert(Num, Reflex_size(&CModel1_SCHEMA, Reflex_SizeType_Packed), -1);
+#endif
+
     return 0;
 }
 #endif // REFLEX_SUPPORT_SIZE_FN
+// ------------------------- Test Large Object -----------------------
+#if REFLEX_SUPPORT_SIZE_FN && REFLEX_FORMAT_MODE_PARAM
+typedef struct {
+    uint8_t     V0;
+    uint32_t    V1[100];
+    char*       V2[40];
+    uint16_t    V3[20][20];
+    uint8_t     V4;
+} LargeModel1;
+static const Reflex_TypeParams LargeModel1_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 100, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Char, 40, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_UInt16, 20, 20),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema LargeModel1_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, LargeModel1_FMT);
 
-// -------------------------- Assert Functions -------------------------
+static const Reflex_TypeParams Overflow1_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_UInt64, REFLEX_LEN_MAX, REFLEX_LEN_MAX),
+};
+static const Reflex_Schema Overflow1_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, Overflow1_FMT);
 
-void Result_print(Test_Result result) {
-    PRINTF("Line: %u, Index: %u\r\n", result >> 16, result & 0xFFFF);
+static const Reflex_TypeParams Overflow2_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt8, REFLEX_LEN_MAX, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt8, REFLEX_LEN_MAX, 0),
+};
+static const Reflex_Schema Overflow2_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, Overflow2_FMT);
+
+static const Reflex_TypeParams Overflow3_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, -1, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema Overflow3_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, Overflow3_FMT);
+
+#if REFLEX_SIZE_PROFILE != REFLEX_SIZE_PROFILE_SMALL
+typedef struct {
+    uint8_t     V0;
+    uint32_t    V1[1024 * 1024];
+    uint16_t    V2[1024][1024];
+    uint8_t     V3;
+} LargeModel2;
+static const Reflex_TypeParams LargeModel2_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 1024 * 1024, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_UInt16, 1024, 1024),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema LargeModel2_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, LargeModel2_FMT);
+#if REFLEX_FORMAT_MODE_OFFSET
+static const Reflex_TypeParams LargeModel2_FMT_OFFSET[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8, 0, 0, LargeModel2, V0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 1024 * 1024, 0, LargeModel2, V1),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_UInt16, 1024, 1024, LargeModel2, V2),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8, 0, 0, LargeModel2, V3),
+};
+static const Reflex_Schema LargeModel2_SCHEMA_OFFSET CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Offset, LargeModel2_FMT_OFFSET);
+#endif
+static LargeModel2 largeTemp2;
+#endif // REFLEX_SIZE_PROFILE
+
+Test_Result Test_LargeObject(void) {
+    Reflex reflex = {0};
+    LargeModel1 temp1;
+
+    assert(Num, Reflex_size(&LargeModel1_SCHEMA, Reflex_SizeType_Normal), sizeof(LargeModel1));
+    assert(Num, Reflex_size(&Overflow1_SCHEMA, Reflex_SizeType_Normal), -1);
+    assert(Num, Reflex_size(&Overflow1_SCHEMA, Reflex_SizeType_Packed), -1);
+    assert(Num, Reflex_size(&Overflow2_SCHEMA, Reflex_SizeType_Normal), -1);
+    assert(Num, Reflex_size(&Overflow2_SCHEMA, Reflex_SizeType_Packed), -1);
+    // negative len is error
+    assert(Num, Reflex_size(&Overflow3_SCHEMA, Reflex_SizeType_Normal), -1);
+    assert(Num, Reflex_size(&Overflow3_SCHEMA, Reflex_SizeType_Packed), -1);
+    assert(Num, Reflex_sizeType(&Overflow3_FMT[1]), -1);
+#if REFLEX_SIZE_PROFILE == REFLEX_SIZE_PROFILE_HUGE
+    // size of field not fit in address space
+    assert(Num, Reflex_sizeType(&Overflow1_FMT[0]), -1);
+#endif
+
+    Reflex_setCallback(&reflex, Reflex_checkAddress);
+    Reflex_setArgs(&reflex, addressMap);
+
+    addressMap[0] = &temp1.V0;
+    addressMap[1] = &temp1.V1;
+    addressMap[2] = &temp1.V2;
+    addressMap[3] = &temp1.V3;
+    addressMap[4] = &temp1.V4;
+    reflex.Schema = &LargeModel1_SCHEMA;
+    assert(Num, Reflex_scan(&reflex, &temp1), REFLEX_OK);
+
+#if REFLEX_SIZE_PROFILE != REFLEX_SIZE_PROFILE_SMALL
+    assert(Num, Reflex_size(&LargeModel2_SCHEMA, Reflex_SizeType_Normal), sizeof(LargeModel2));
+
+    addressMap[0] = &largeTemp2.V0;
+    addressMap[1] = &largeTemp2.V1;
+    addressMap[2] = &largeTemp2.V2;
+    addressMap[3] = &largeTemp2.V3;
+    reflex.Schema = &LargeModel2_SCHEMA;
+    assert(Num, Reflex_scan(&reflex, &largeTemp2), REFLEX_OK);
+
+#if REFLEX_FORMAT_MODE_OFFSET
+    assert(Num, Reflex_size(&LargeModel2_SCHEMA_OFFSET, Reflex_SizeType_Normal), sizeof(LargeModel2));
+
+    reflex.Schema = &LargeModel2_SCHEMA_OFFSET;
+    assert(Num, Reflex_scan(&reflex, &largeTemp2), REFLEX_OK);
+#endif
+#endif // REFLEX_SIZE_PROFILE
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_SIZE_FN && REFLEX_FORMAT_MODE_PARAM
+// -------------------------- Test Scan Array ------------------------
+#if REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+typedef struct {
+    uint8_t*        Base;
+    Reflex_LenType  Stride;
+    Reflex_LenType  Count;
+    Reflex_LenType  BreakAt;
+} ArrayChecker;
+
+Reflex_Result Reflex_checkArrayAddress(Reflex* reflex, void* value, const void* fmt) {
+    ArrayChecker* checker = (ArrayChecker*) reflex->Args;
+    Reflex_LenType shift = Reflex_getElementIndex(reflex) * checker->Stride;
+
+    if ((uint8_t*) addressMap[Reflex_getVarIndex(reflex)] + shift != value) {
+        PRINTF("Element: %d, Idx: %d, Address not match\r\n", Reflex_getElementIndex(reflex), Reflex_getVarIndex(reflex));
+        return 1;
+    }
+#if REFLEX_SUPPORT_MAIN_OBJ
+    if (Reflex_getMainVariable(reflex) != checker->Base + shift) {
+        PRINTF("Element: %d, MainObject not match\r\n", Reflex_getElementIndex(reflex));
+        return 2;
+    }
+#endif
+#if REFLEX_SUPPORT_BREAK_LAYER && REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D || REFLEX_SUPPORT_TYPE_POINTER_ARRAY)
+    if (Reflex_getElementIndex(reflex) == checker->BreakAt) {
+        Reflex_break(reflex);
+    }
+#endif
+    checker->Count++;
+
+    return REFLEX_OK;
+}
+
+Test_Result Test_ScanArray(void) {
+    Reflex reflex = {0};
+    Model2 temp[5];
+    ArrayChecker checker = { (uint8_t*) temp, sizeof(Model2), 0, -1 };
+
+    Reflex_init(&reflex, &Model2_SCHEMA);
+    Reflex_setCallback(&reflex, Reflex_checkArrayAddress);
+    Reflex_setArgs(&reflex, &checker);
+
+    addressMap[0] = &temp[0].V0;
+    addressMap[1] = &temp[0].V1;
+    addressMap[2] = &temp[0].V2;
+    addressMap[3] = &temp[0].V3;
+
+    assert(Num, Reflex_scanArray(&reflex, temp, 5, sizeof(Model2)), REFLEX_OK);
+    assert(Num, checker.Count, 5 * 4);
+    assert(Num, Reflex_getElementIndex(&reflex), 5);
+
+    checker.Count = 0;
+    assert(Num, Reflex_scanArray(&reflex, temp, 0, sizeof(Model2)), REFLEX_OK);
+    assert(Num, checker.Count, 0);
+
+#if REFLEX_SUPPORT_SIZE_FN
+    checker.Count = 0;
+    assert(Num, Reflex_scanArray(&reflex, temp, 5, 0), REFLEX_OK);
+    assert(Num, checker.Count, 5 * 4);
+#endif
+
+#if REFLEX_SUPPORT_BREAK_LAYER && REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D || REFLEX_SUPPORT_TYPE_POINTER_ARRAY)
+    // break in element 2 finish fields of it and skip rest of elements
+    checker.Count = 0;
+    checker.BreakAt = 2;
+    assert(Num, Reflex_scanArray(&reflex, temp, 5, sizeof(Model2)), REFLEX_OK);
+    assert(Num, checker.Count, 3 * 4);
+    checker.BreakAt = -1;
+#endif
+
+    // error in element 1 stop scan
+    checker.Count = 0;
+    checker.Stride = 0;
+    assert(Num, Reflex_scanArray(&reflex, temp, 5, sizeof(Model2)), 1);
+    assert(Num, checker.Count, 4);
+    checker.Stride = sizeof(Model2);
+
+#if REFLEX_SUPPORT_PLAN
+    {
+        Reflex_PlanOp plan[8];
+
+        assert(Num, Reflex_compile(&Model2_SCHEMA, plan, 8) > 0, 1);
+        Reflex_Plan_bind(&reflex, plan);
+
+        checker.Count = 0;
+        assert(Num, Reflex_Plan_scanArray(&reflex, plan, temp, 5, sizeof(Model2)), REFLEX_OK);
+        assert(Num, checker.Count, 5 * 4);
+
+        checker.Count = 0;
+        assert(Num, Reflex_Plan_scanArray(&reflex, plan, temp, 5, 0), REFLEX_OK);
+        assert(Num, checker.Count, 5 * 4);
+    }
+#endif
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+// -------------------------- Field Recorder -------------------------
+#if (REFLEX_SUPPORT_PLAN || REFLEX_SUPPORT_CURSOR) && REFLEX_SUPPORT_TYPE_COMPLEX
+typedef struct {
+    void*           Obj;
+    uint8_t         Type;
+    Reflex_LenType  VarIndex;
+    Reflex_LenType  VarOffset;
+    Reflex_LenType  LayerIndex;
+} FieldRecord;
+
+typedef struct {
+    FieldRecord     Records[160];
+    uint32_t        Len;
+    Reflex_LenType  BreakAt;
+    Reflex_LenType  ErrorAt;
+} FieldRecorder;
+
+static FieldRecorder recorders[2];
+
+Reflex_Result Reflex_recordField(Reflex* reflex, void* value, const void* fmt) {
+    FieldRecorder* recorder = (FieldRecorder*) reflex->Args;
+    FieldRecord* record = &recorder->Records[recorder->Len++];
+
+    record->Obj = value;
+    record->Type = ((const Reflex_TypeParams*) fmt)->Type;
+    record->VarIndex = Reflex_getVarIndexReal(reflex);
+    record->VarOffset = Reflex_getVarOffset(reflex);
+    record->LayerIndex = reflex->LayerIndex;
+
+    if (Reflex_getVarIndex(reflex) == recorder->BreakAt) {
+        Reflex_break(reflex);
+    }
+    if (Reflex_getVarIndex(reflex) == recorder->ErrorAt) {
+        return (Reflex_Result) 5;
+    }
+
+    return REFLEX_OK;
+}
+
+Test_Result Assert_Records(FieldRecorder* expected, FieldRecorder* actual, uint16_t line) {
+    uint32_t index;
+
+    if (Assert_Num(actual->Len, expected->Len, line)) {
+        return (Test_Result) line << 16;
+    }
+    for (index = 0; index < expected->Len; index++) {
+        if (expected->Records[index].Obj != actual->Records[index].Obj ||
+            expected->Records[index].Type != actual->Records[index].Type ||
+            expected->Records[index].VarIndex != actual->Records[index].VarIndex ||
+            expected->Records[index].VarOffset != actual->Records[index].VarOffset ||
+            expected->Records[index].LayerIndex != actual->Records[index].LayerIndex
+        ) {
+            PRINTF("Record %u not match, Line: %d\r\n", index, line);
+            return (Test_Result) line << 16 | index;
+        }
+    }
+
+    return 0;
+}
+
+typedef struct {
+    uint8_t     V0;
+    Model2      V1[3];
+    uint8_t     V2;
+    Model2      V3[2][2];
+} CModel4;
+static const Reflex_TypeParams CModel4_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 3, 0, &Model2_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array2D_Complex, 2, 2, &Model2_SCHEMA),
+};
+static const Reflex_Schema CModel4_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, CModel4_FMT);
+
+typedef struct {
+    uint16_t    V0;
+    Model2      V1;
+} NestItem;
+static const Reflex_TypeParams NestItem_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Complex, 0, 0, &Model2_SCHEMA),
+};
+static const Reflex_Schema NestItem_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, NestItem_FMT);
+
+// first element of V1 is not aligned to it's biggest field, so it's layout is different from other elements
+typedef struct {
+    uint8_t     V0;
+    NestItem    V1[3];
+    uint8_t     V2;
+} NestModel;
+static const Reflex_TypeParams NestModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 3, 0, &NestItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema NestModel_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, NestModel_FMT);
+#endif // REFLEX_SUPPORT_PLAN || REFLEX_SUPPORT_CURSOR
+// -------------------------- Shared Models -------------------------
+#if REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_FORMAT_MODE_PARAM
+typedef struct {
+    uint16_t    V0;
+    uint8_t     V1;
+} TestItem;
+static const Reflex_TypeParams TestItem_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema TestItem_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, TestItem_FMT);
+
+typedef struct {
+    uint16_t    V0;
+    uint16_t    V1;
+} TestPair;
+static const Reflex_TypeParams TestPair_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+};
+static const Reflex_Schema TestPair_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, TestPair_FMT);
+
+// schema without pointers
+typedef struct {
+    uint8_t     V0;
+    uint32_t    V1[2];
+    TestItem    V2[2];
+    float       V3;
+} TestFixed;
+static const Reflex_TypeParams TestFixed_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 2, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 2, 0, &TestItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Float),
+};
+static const Reflex_Schema TestFixed_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, TestFixed_FMT);
+
+typedef struct {
+    uint8_t     Bytes[128];
+    uint32_t    Len;
+} TestStream;
+
+/**
+ * @brief Append items to expected stream, bytes of each item are reversed if swap is set
+ */
+void TestStream_append(TestStream* stream, const void* data, uint32_t itemSize, uint32_t len, uint8_t swap) {
+    const uint8_t* bytes = (const uint8_t*) data;
+    uint32_t index;
+
+    while (len-- > 0) {
+        for (index = 0; index < itemSize; index++) {
+            stream->Bytes[stream->Len++] = bytes[swap ? itemSize - 1 - index : index];
+        }
+        bytes += itemSize;
+    }
+}
+
+void TestStream_appendItem(TestStream* stream, const TestItem* item, uint8_t swap) {
+    TestStream_append(stream, &item->V0, 2, 1, swap);
+    TestStream_append(stream, &item->V1, 1, 1, swap);
+}
+
+void TestStream_appendFixed(TestStream* stream, const TestFixed* model, uint8_t swap) {
+    TestStream_append(stream, &model->V0, 1, 1, swap);
+    TestStream_append(stream, model->V1, 4, 2, swap);
+    TestStream_appendItem(stream, &model->V2[0], swap);
+    TestStream_appendItem(stream, &model->V2[1], swap);
+    TestStream_append(stream, &model->V3, 4, 1, swap);
+}
+
+void TestFixed_fill(TestFixed* model, uint8_t padding) {
+    memset(model, padding, sizeof(*model));
+    model->V0 = 0x11;
+    model->V1[0] = 0x22334455;
+    model->V1[1] = 0x66778899;
+    model->V2[0].V0 = 0x1234;
+    model->V2[0].V1 = 0x56;
+    model->V2[1].V0 = 0x789A;
+    model->V2[1].V1 = 0xBC;
+    model->V3 = 2.5f;
+}
+
+#if REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE
+typedef struct {
+    uint8_t     V0;
+    uint16_t*   V1;
+    TestItem*   V2[2];
+    TestFixed   V3;
+    double      V4;
+    TestPair    V5[2];
+} TestModel;
+static const Reflex_TypeParams TestModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Pointer_UInt16),
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Complex, 2, 0, &TestItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Complex, 0, 0, &TestFixed_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Double),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 2, 0, &TestPair_SCHEMA),
+};
+static const Reflex_Schema TestModel_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, TestModel_FMT);
+
+/**
+ * @brief Append model to expected stream, objects of pointers are written after presence byte
+ */
+void TestStream_appendModel(TestStream* stream, const TestModel* model, uint8_t swap) {
+    uint8_t marker;
+    uint32_t index;
+
+    stream->Len = 0;
+    TestStream_append(stream, &model->V0, 1, 1, swap);
+    marker = model->V1 != NULL;
+    TestStream_append(stream, &marker, 1, 1, swap);
+    if (marker) {
+        TestStream_append(stream, model->V1, 2, 1, swap);
+    }
+    for (index = 0; index < 2; index++) {
+        marker = model->V2[index] != NULL;
+        TestStream_append(stream, &marker, 1, 1, swap);
+        if (marker) {
+            TestStream_appendItem(stream, model->V2[index], swap);
+        }
+    }
+    TestStream_appendFixed(stream, &model->V3, swap);
+    TestStream_append(stream, &model->V4, 8, 1, swap);
+    for (index = 0; index < 2; index++) {
+        TestStream_append(stream, &model->V5[index].V0, 2, 1, swap);
+        TestStream_append(stream, &model->V5[index].V1, 2, 1, swap);
+    }
+}
+
+void TestModel_fill(TestModel* model, uint8_t padding, uint16_t* value, TestItem* items) {
+    memset(model, padding, sizeof(*model));
+    model->V0 = 0x77;
+    model->V1 = value;
+    model->V2[0] = &items[0];
+    model->V2[1] = &items[1];
+    TestFixed_fill(&model->V3, padding);
+    model->V4 = -1.5;
+    model->V5[0].V0 = 1;
+    model->V5[0].V1 = 2;
+    model->V5[1].V0 = 3;
+    model->V5[1].V1 = 4;
 }
+#endif // REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE
+#endif // REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_FORMAT_MODE_PARAM
+// -------------------------- Test Plan -------------------------
+#if REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+static Reflex_PlanOp planOps[256];
+
+#define Assert_Plan(SCHEMA, OBJ, BREAK_AT)      memset(recorders, 0, sizeof(recorders)); \
+                                                recorders[0].BreakAt = BREAK_AT; \
+                                                recorders[1].BreakAt = BREAK_AT; \
+                                                recorders[0].ErrorAt = -1; \
+                                                recorders[1].ErrorAt = -1; \
+                                                Reflex_init(&reflex, &SCHEMA); \
+                                                Reflex_setArgs(&reflex, &recorders[0]); \
+                                                assert(Num, Reflex_scan(&reflex, &OBJ), REFLEX_OK); \
+                                                assert(Num, Reflex_compile(&SCHEMA, NULL, 0) <= ARRAY_LEN(planOps), 1); \
+                                                assert(Num, Reflex_compile(&SCHEMA, planOps, ARRAY_LEN(planOps)), Reflex_compile(&SCHEMA, NULL, 0)); \
+                                                Reflex_setArgs(&reflex, &recorders[1]); \
+                                                assert(Num, Reflex_Plan_scan(&reflex, planOps, &OBJ), REFLEX_OK); \
+                                                assert(Records, &recorders[0], &recorders[1]); \
+                                                recorders[1].Len = 0; \
+                                                Reflex_Plan_bind(&reflex, planOps); \
+                                                assert(Num, Reflex_Plan_scanBound(&reflex, planOps, &OBJ), REFLEX_OK); \
+                                                assert(Records, &recorders[0], &recorders[1])
+
+#if REFLEX_SUPPORT_SCAN_ARRAY
+#define Assert_ScanArray(SCHEMA, OBJS)          memset(recorders, 0, sizeof(recorders)); \
+                                                recorders[0].BreakAt = -1; \
+                                                recorders[1].BreakAt = -1; \
+                                                recorders[0].ErrorAt = -1; \
+                                                recorders[1].ErrorAt = -1; \
+                                                Reflex_init(&reflex, &SCHEMA); \
+                                                Reflex_setArgs(&reflex, &recorders[0]); \
+                                                for (index = 0; index < ARRAY_LEN(OBJS); index++) { \
+                                                    assert(Num, Reflex_scan(&reflex, &OBJS[index]), REFLEX_OK); \
+                                                } \
+                                                Reflex_setArgs(&reflex, &recorders[1]); \
+                                                assert(Num, Reflex_scanArray(&reflex, OBJS, ARRAY_LEN(OBJS), sizeof(OBJS[0])), REFLEX_OK); \
+                                                assert(Records, &recorders[0], &recorders[1]); \
+                                                assert(Num, Reflex_getElementIndex(&reflex), ARRAY_LEN(OBJS))
+#endif
 
+#if REFLEX_SUPPORT_DRIVER && REFLEX_SUPPORT_COMPACT
+static const Reflex_ScanFunctions recordFunctions = {
+    .fnChar = Reflex_recordField,
+    .fnUInt8 = Reflex_recordField,
+    .fnInt8 = Reflex_recordField,
+    .fnUInt16 = Reflex_recordField,
+    .fnInt16 = Reflex_recordField,
+    .fnUInt32 = Reflex_recordField,
+    .fnInt32 = Reflex_recordField,
+#if REFLEX_SUPPORT_TYPE_64BIT
+    .fnUInt64 = Reflex_recordField,
+    .fnInt64 = Reflex_recordField,
+#endif
+    .fnFloat = Reflex_recordField,
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+    .fnDouble = Reflex_recordField,
+#endif
+    .fnComplexBegin = Reflex_recordField,
+    .fnComplexEnd = Reflex_recordField,
+};
+static const Reflex_ScanFunctions emptyFunctions = {0};
+// fields without begin/end callbacks of complex fields
+static const Reflex_ScanFunctions fieldFunctions = {
+    .fnChar = Reflex_recordField,
+    .fnUInt8 = Reflex_recordField,
+    .fnInt8 = Reflex_recordField,
+    .fnUInt16 = Reflex_recordField,
+    .fnInt16 = Reflex_recordField,
+    .fnUInt32 = Reflex_recordField,
+    .fnInt32 = Reflex_recordField,
+#if REFLEX_SUPPORT_TYPE_64BIT
+    .fnUInt64 = Reflex_recordField,
+    .fnInt64 = Reflex_recordField,
+#endif
+    .fnFloat = Reflex_recordField,
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+    .fnDouble = Reflex_recordField,
+#endif
+};
+static const Reflex_ScanDriver recordDriver = {
+    .Category = {
+        &recordFunctions,
+        &recordFunctions,
+        &recordFunctions,
+        &recordFunctions,
+        &recordFunctions,
+    },
+};
+#endif
+
+Test_Result Test_Plan(void) {
+    Reflex reflex = {0};
+    Model1 temp1 = {0};
+    PrimaryTemp4 temp2 = {0};
+    CModel2 temp3 = {0};
+    CModel3 temp4 = {0};
+    CModel4 temp5 = {0};
+    uint32_t index;
+
+    Reflex_setCallback(&reflex, Reflex_recordField);
+
+    Assert_Plan(Model1_SCHEMA, temp1, -1);
+    Assert_Plan(PrimaryTemp4_SCHEMA, temp2, -1);
+    Assert_Plan(CModel2_SCHEMA, temp3, -1);
+    Assert_Plan(CModel3_SCHEMA, temp4, -1);
+    Assert_Plan(CModel3_SCHEMA, temp4, 13);
+    Assert_Plan(CModel3_SCHEMA, temp4, 33);
+    Assert_Plan(CModel3_SCHEMA, temp4, 60);
+    Assert_Plan(CModel4_SCHEMA, temp5, -1);
+    Assert_Plan(CModel4_SCHEMA, temp5, 7);
+    Assert_Plan(CModel4_SCHEMA, temp5, 16);
+
+    // check address of fields
+    Reflex_setCallback(&reflex, Reflex_checkAddress);
+    Reflex_setArgs(&reflex, addressMap);
+    addressMap[0] = &temp5.V0;
+    for (index = 0; index < 3; index++) {
+        addressMap[1 + index * 4] = &temp5.V1[index].V0;
+        addressMap[2 + index * 4] = &temp5.V1[index].V1;
+        addressMap[3 + index * 4] = &temp5.V1[index].V2;
+        addressMap[4 + index * 4] = &temp5.V1[index].V3;
+    }
+    addressMap[13] = &temp5.V2;
+    for (index = 0; index < 4; index++) {
+        addressMap[14 + index * 4] = &temp5.V3[index / 2][index % 2].V0;
+        addressMap[15 + index * 4] = &temp5.V3[index / 2][index % 2].V1;
+        addressMap[16 + index * 4] = &temp5.V3[index / 2][index % 2].V2;
+        addressMap[17 + index * 4] = &temp5.V3[index / 2][index % 2].V3;
+    }
+    assert(Num, Reflex_Plan_scan(&reflex, planOps, &temp5), REFLEX_OK);
+    // error in nested complex field of first element, bound scan must leave through Next op like scan
+    {
+        NestModel temp6 = {0};
+    #if REFLEX_SUPPORT_MAIN_OBJ
+        void* mainObj;
+    #endif
+
+        memset(recorders, 0, sizeof(recorders));
+        recorders[0].BreakAt = -1;
+        recorders[1].BreakAt = -1;
+        recorders[0].ErrorAt = 5;
+        recorders[1].ErrorAt = 5;
+        Reflex_init(&reflex, &NestModel_SCHEMA);
+        Reflex_setCallback(&reflex, Reflex_recordField);
+        assert(Num, Reflex_compile(&NestModel_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+        // op after end of nested complex field is Next op of first element
+        assert(Num, planOps[planOps[3].Jump + 1].Code, Reflex_PlanCode_Next);
+        Reflex_setArgs(&reflex, &recorders[0]);
+        assert(Num, Reflex_Plan_scan(&reflex, planOps, &temp6), 5);
+    #if REFLEX_SUPPORT_MAIN_OBJ
+        mainObj = Reflex_getMainVariable(&reflex);
+    #endif
+        Reflex_Plan_bind(&reflex, planOps);
+        Reflex_setArgs(&reflex, &recorders[1]);
+        assert(Num, Reflex_Plan_scanBound(&reflex, planOps, &temp6), 5);
+        assert(Records, &recorders[0], &recorders[1]);
+    #if REFLEX_SUPPORT_MAIN_OBJ
+        assert(Ptr, Reflex_getMainVariable(&reflex), mainObj);
+    #endif
+        assert(Num, reflex.LayerIndex, 0);
+    }
+#if REFLEX_SUPPORT_SCAN_ARRAY
+    // array scan give same records as scan of each object, with default REFLEX_SCAN_ARRAY_PLAN_SIZE
+    // layout of both schemas is compiled once
+    {
+        CModel2 temps2[3] = {0};
+        CModel4 temps4[3] = {0};
+
+        Reflex_setCallback(&reflex, Reflex_recordField);
+        Assert_ScanArray(CModel2_SCHEMA, temps2);
+        Assert_ScanArray(CModel4_SCHEMA, temps4);
+    }
+#endif
+#if REFLEX_SUPPORT_DRIVER && REFLEX_SUPPORT_COMPACT
+    // resolved callbacks of driver and compact functions
+    Reflex_setDriver(&reflex, &recordDriver);
+    Assert_Plan(CModel3_SCHEMA, temp4, -1);
+    Assert_Plan(CModel4_SCHEMA, temp5, 16);
+    assert(Ptr, planOps[0].Fn, Reflex_recordField);
+    Reflex_setCompact(&reflex, &recordFunctions);
+    Assert_Plan(PrimaryTemp4_SCHEMA, temp2, -1);
+    Assert_Plan(CModel3_SCHEMA, temp4, 33);
+    // complex fields without begin/end callbacks are only entered
+    Reflex_setCompact(&reflex, &fieldFunctions);
+    assert(Num, Reflex_Plan_bind(&reflex, planOps), REFLEX_OK);
+    recorders[1].Len = 0;
+    recorders[1].BreakAt = -1;
+    assert(Num, Reflex_Plan_scanBound(&reflex, planOps, &temp4), REFLEX_OK);
+    assert(Num, recorders[1].Len > 0, 1);
+    // plan must bind again after change of functions, fields without callback are error
+    Reflex_setCompact(&reflex, &emptyFunctions);
+    assert(Num, Reflex_Plan_bind(&reflex, planOps), REFLEX_ERROR);
+    recorders[1].Len = 0;
+    assert(Num, Reflex_Plan_scanBound(&reflex, planOps, &temp4), REFLEX_OK);
+    assert(Num, recorders[1].Len, 0);
+    Reflex_setCallback(&reflex, Reflex_recordField);
+#endif
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_PLAN
+// -------------------------- Test Scan Masked -------------------------
+#if REFLEX_SUPPORT_SCAN_MASKED && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+static uint32_t scanMask[16];
+
+/**
+ * @brief Filter records of full scan with mask, begin/end of complex fields
+ * are only kept if they have a selected field
+ */
+void Reflex_filterRecords(const FieldRecorder* all, FieldRecorder* out, const uint32_t* mask) {
+    uint32_t begins[REFLEX_MAX_DEPTH + 1];
+    uint8_t selected[REFLEX_MAX_DEPTH + 1];
+    int32_t depth = -1;
+    uint32_t index;
+    const FieldRecord* record;
+    Reflex_LenType var;
+
+    out->Len = 0;
+    for (index = 0; index < all->Len; index++) {
+        record = &all->Records[index];
+        var = record->VarIndex + record->VarOffset;
+        if ((record->Type & 0x1F) != Reflex_PrimaryType_Complex) {
+            if (mask[var >> 5] & ((uint32_t) 1 << (var & 31))) {
+                out->Records[out->Len++] = *record;
+                if (depth >= 0) {
+                    selected[depth] = 1;
+                }
+            }
+        }
+        else if (depth >= 0 && all->Records[begins[depth]].LayerIndex == record->LayerIndex) {
+            // end of complex field
+            if (selected[depth]) {
+                out->Records[out->Len++] = *record;
+            }
+            else {
+                // remove begin record
+                out->Len--;
+            }
+            if (--depth >= 0) {
+                selected[depth] |= selected[depth + 1];
+            }
+        }
+        else {
+            // begin of complex field
+            begins[++depth] = index;
+            selected[depth] = 0;
+            out->Records[out->Len++] = *record;
+        }
+    }
+}
+
+Test_Result Assert_MaskedRecords(FieldRecorder* expected, FieldRecorder* actual, uint16_t line) {
+    uint32_t index;
+
+    if (Assert_Num(actual->Len, expected->Len, line)) {
+        return (Test_Result) line << 16;
+    }
+    for (index = 0; index < expected->Len; index++) {
+        if (expected->Records[index].Obj != actual->Records[index].Obj ||
+            expected->Records[index].Type != actual->Records[index].Type ||
+            expected->Records[index].VarIndex + expected->Records[index].VarOffset != actual->Records[index].VarIndex + actual->Records[index].VarOffset ||
+            expected->Records[index].LayerIndex != actual->Records[index].LayerIndex
+        ) {
+            PRINTF("Record %u not match, Line: %d\r\n", index, line);
+            return (Test_Result) line << 16 | index;
+        }
+    }
+
+    return 0;
+}
+
+#define Assert_Masked(SCHEMA, OBJ)              memset(recorders, 0, sizeof(recorders)); \
+                                                recorders[0].BreakAt = -1; \
+                                                recorders[0].ErrorAt = -1; \
+                                                recorders[1].BreakAt = -1; \
+                                                recorders[1].ErrorAt = -1; \
+                                                Reflex_init(&reflex, &SCHEMA); \
+                                                Reflex_setCallback(&reflex, Reflex_recordField); \
+                                                Reflex_setArgs(&reflex, &recorders[0]); \
+                                                assert(Num, Reflex_scan(&reflex, &OBJ), REFLEX_OK); \
+                                                assert(Num, Reflex_compile(&SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1); \
+                                                vars = Reflex_Plan_vars(planOps); \
+                                                assert(Num, REFLEX_MASK_LEN(vars) <= ARRAY_LEN(scanMask), 1); \
+                                                Reflex_setArgs(&reflex, &recorders[1]); \
+                                                /* all fields */ \
+                                                memset(scanMask, 0xFF, sizeof(scanMask)); \
+                                                assert(Num, Reflex_Plan_scanMasked(&reflex, planOps, &OBJ, scanMask), REFLEX_OK); \
+                                                assert(Num, recorders[0].Len, recorders[1].Len); \
+                                                assert(Records, &recorders[0], &recorders[1]); \
+                                                /* no field */ \
+                                                memset(scanMask, 0, sizeof(scanMask)); \
+                                                recorders[1].Len = 0; \
+                                                assert(Num, Reflex_Plan_scanMasked(&reflex, planOps, &OBJ, scanMask), REFLEX_OK); \
+                                                assert(Num, recorders[1].Len, 0); \
+                                                /* each field */ \
+                                                for (index = 0; index < vars; index++) { \
+                                                    memset(scanMask, 0, sizeof(scanMask)); \
+                                                    REFLEX_MASK_SET(scanMask, index); \
+                                                    Reflex_filterRecords(&recorders[0], &expected, scanMask); \
+                                                    recorders[1].Len = 0; \
+                                                    assert(Num, Reflex_Plan_scanMasked(&reflex, planOps, &OBJ, scanMask), REFLEX_OK); \
+                                                    assert(MaskedRecords, &expected, &recorders[1]); \
+                                                } \
+                                                /* sparse fields */ \
+                                                for (step = 2; step < 40; step += 5) { \
+                                                    memset(scanMask, 0, sizeof(scanMask)); \
+                                                    for (index = step / 2; index < vars; index += step) { \
+                                                        REFLEX_MASK_SET(scanMask, index); \
+                                                    } \
+                                                    Reflex_filterRecords(&recorders[0], &expected, scanMask); \
+                                                    recorders[1].Len = 0; \
+                                                    assert(Num, Reflex_Plan_scanMasked(&reflex, planOps, &OBJ, scanMask), REFLEX_OK); \
+                                                    assert(MaskedRecords, &expected, &recorders[1]); \
+                                                }
+
+Test_Result Test_ScanMasked(void) {
+    static FieldRecorder expected;
+    Reflex reflex = {0};
+    Model1 temp1 = {0};
+    PrimaryTemp4 temp2 = {0};
+    CModel2 temp3 = {0};
+    CModel3 temp4 = {0};
+    CModel4 temp5 = {0};
+    Reflex_LenType vars;
+    Reflex_LenType index;
+    Reflex_LenType step;
+
+    Assert_Masked(Model1_SCHEMA, temp1);
+    Assert_Masked(PrimaryTemp4_SCHEMA, temp2);
+    Assert_Masked(CModel2_SCHEMA, temp3);
+    Assert_Masked(CModel3_SCHEMA, temp4);
+    Assert_Masked(CModel4_SCHEMA, temp5);
+
+    // error in selected field stop scan
+    memset(scanMask, 0, sizeof(scanMask));
+    REFLEX_MASK_SET(scanMask, 3);
+    REFLEX_MASK_SET(scanMask, 9);
+    REFLEX_MASK_SET(scanMask, 20);
+    recorders[1].Len = 0;
+    recorders[1].ErrorAt = 9;
+    assert(Num, Reflex_Plan_scanMasked(&reflex, planOps, &temp5, scanMask), 5);
+    // begin of V1, field 3, field 9 and end of V1
+    assert(Num, recorders[1].Len, 4);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_SCAN_MASKED
+// -------------------------- Test Scan Runs -------------------------
+#if REFLEX_SUPPORT_SCAN_RUNS && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER
+typedef struct {
+    uint32_t    V0;
+    uint16_t    V1[2];
+    uint8_t     V2[4];
+} RunModel1;
+static const Reflex_TypeParams RunModel1_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt16, 2, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt8, 4, 0),
+};
+static const Reflex_Schema RunModel1_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, RunModel1_FMT);
+
+typedef struct {
+    uint8_t     V0;
+    uint32_t    V1;
+    uint8_t     V2[3];
+    uint8_t     V3;
+} RunModel2;
+static const Reflex_TypeParams RunModel2_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt8, 3, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema RunModel2_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, RunModel2_FMT);
+
+typedef struct {
+    uint32_t    V0;
+    RunModel1   V1[3];
+    uint8_t*    V2;
+    RunModel2   V3[2];
+    RunModel1*  V4;
+    uint16_t    V5;
+} RunModel3;
+static const Reflex_TypeParams RunModel3_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 3, 0, &RunModel1_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Pointer_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, 2, 0, &RunModel2_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Pointer_Complex, 0, 0, &RunModel1_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt16),
+};
+static const Reflex_Schema RunModel3_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, RunModel3_FMT);
+
+typedef struct {
+    void*           Obj;
+    Reflex_LenType  Len;
+} Run;
+
+typedef struct {
+    Run             Runs[16];
+    uint32_t        Len;
+} RunRecorder;
+
+Reflex_Result Reflex_recordRun(Reflex* reflex, void* obj, Reflex_LenType len) {
+    RunRecorder* recorder = (RunRecorder*) Reflex_getArgs(reflex);
+
+    recorder->Runs[recorder->Len].Obj = obj;
+    recorder->Runs[recorder->Len].Len = len;
+    recorder->Len++;
+
+    return recorder->Len < ARRAY_LEN(recorder->Runs) ? REFLEX_OK : REFLEX_ERROR;
+}
+
+Test_Result Assert_Runs(RunRecorder* actual, const Run* expected, uint32_t len, uint16_t line) {
+    uint32_t index;
+
+    if (Assert_Num(actual->Len, len, line)) {
+        return (Test_Result) line << 16;
+    }
+    for (index = 0; index < len; index++) {
+        if (actual->Runs[index].Obj != expected[index].Obj || actual->Runs[index].Len != expected[index].Len) {
+            PRINTF("Run %u not match, Line: %d\r\n", index, line);
+            return (Test_Result) line << 16 | index;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_ScanRuns(void) {
+    Reflex reflex = {0};
+    RunRecorder recorder = {0};
+    RunModel1 temp1 = {0};
+    RunModel2 temp2 = {0};
+    RunModel3 temp3 = {0};
+
+    Reflex_setArgs(&reflex, &recorder);
+
+    // fields without padding are one run
+    {
+        const Run runs[] = {
+            { &temp1, sizeof(temp1) },
+        };
+        assert(Num, Reflex_compile(&RunModel1_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+        assert(Num, Reflex_Plan_scanRuns(&reflex, planOps, &temp1, Reflex_recordRun), REFLEX_OK);
+        assert(Runs, &recorder, runs, ARRAY_LEN(runs));
+    }
+    // padding break runs
+    {
+        const Run runs[] = {
+            { &temp2.V0, 1 },
+            { &temp2.V1, 8 },
+        };
+        recorder.Len = 0;
+        assert(Num, Reflex_compile(&RunModel2_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+        assert(Num, Reflex_Plan_scanRuns(&reflex, planOps, &temp2, Reflex_recordRun), REFLEX_OK);
+        assert(Runs, &recorder, runs, ARRAY_LEN(runs));
+    }
+    // complex fields without padding are merged with neighbours, pointers break runs
+    {
+        const Run runs[] = {
+            { &temp3.V0, sizeof(temp3.V0) + sizeof(temp3.V1) },
+            { &temp3.V3[0].V0, 1 },
+            { &temp3.V3[0].V1, 9 },
+            { &temp3.V3[1].V1, 8 },
+            { &temp1, sizeof(temp1) },
+            { &temp3.V5, sizeof(temp3.V5) },
+        };
+        temp3.V4 = &temp1;
+        recorder.Len = 0;
+        assert(Num, Reflex_compile(&RunModel3_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+        assert(Num, Reflex_Plan_scanRuns(&reflex, planOps, &temp3, Reflex_recordRun), REFLEX_OK);
+        assert(Runs, &recorder, runs, ARRAY_LEN(runs));
+        // error of callback stop scan
+        recorder.Len = ARRAY_LEN(recorder.Runs) - 2;
+        assert(Num, Reflex_Plan_scanRuns(&reflex, planOps, &temp3, Reflex_recordRun), REFLEX_ERROR);
+        assert(Num, recorder.Len, ARRAY_LEN(recorder.Runs));
+    }
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_SCAN_RUNS
+// -------------------------- Test Hash -------------------------
+#if REFLEX_SUPPORT_HASH && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+#if REFLEX_HASH_ENDIAN_NORMALIZE && REFLEX_BIG_ENDIAN
+    #define HASH_SWAP       1
+#else
+    #define HASH_SWAP       0
+#endif
+
+Test_Result Test_Hash(void) {
+    Reflex reflex = {0};
+    TestStream stream;
+    TestModel temp1;
+    TestModel temp2;
+    uint16_t value1 = 0xA1A2;
+    uint16_t value2 = 0xA1A2;
+    TestItem items1[2] = { { 0x0102, 0x03 }, { 0x0405, 0x06 } };
+    TestItem items2[2] = { { 0x0102, 0x03 }, { 0x0405, 0x06 } };
+    uint8_t bytes[100];
+    uint64_t hash;
+    uint32_t index;
+
+    // XXH64 vectors
+    for (index = 0; index < sizeof(bytes); index++) {
+        bytes[index] = (uint8_t) index;
+    }
+    assert(Num, Reflex_hashBytes("", 0, 0) == 0xEF46DB3751D8E999ULL, 1);
+    assert(Num, Reflex_hashBytes("abc", 3, 0) == 0x44BC2CF5AD770999ULL, 1);
+    assert(Num, Reflex_hashBytes(bytes, sizeof(bytes), 0) == 0x6AC1E58032166597ULL, 1);
+    assert(Num, Reflex_hashBytes(bytes, sizeof(bytes), 0x1234) == 0x9C5395B5DA7D2126ULL, 1);
+    assert(Num, Reflex_hashBytes(bytes, 37, 7) == 0x69E0C889396AFAF7ULL, 1);
+
+    assert(Num, Reflex_compile(&TestModel_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    // hash is same as hash of meaningful bytes
+    TestModel_fill(&temp1, 0x00, &value1, items1);
+    TestStream_appendModel(&stream, &temp1, HASH_SWAP);
+    hash = Reflex_Plan_hash(&reflex, planOps, &temp1, 0);
+    assert(Num, hash == Reflex_hashBytes(stream.Bytes, stream.Len, 0), 1);
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp1, 99) == Reflex_hashBytes(stream.Bytes, stream.Len, 99), 1);
+    // paddings and address of pointers are not hashed
+    TestModel_fill(&temp2, 0xAA, &value2, items2);
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp2, 0) == hash, 1);
+    // objects of pointers are hashed
+    value2 = 0xA1A3;
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp2, 0) != hash, 1);
+    value2 = 0xA1A2;
+    items2[1].V1 = 0x07;
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp2, 0) != hash, 1);
+    items2[1].V1 = 0x06;
+    // NULL pointers
+    temp2.V1 = NULL;
+    temp2.V2[0] = NULL;
+    TestStream_appendModel(&stream, &temp2, HASH_SWAP);
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp2, 0) == Reflex_hashBytes(stream.Bytes, stream.Len, 0), 1);
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp2, 0) != hash, 1);
+    // seed
+    assert(Num, Reflex_Plan_hash(&reflex, planOps, &temp1, 1) != hash, 1);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_HASH
+// -------------------------- Test Compare -------------------------
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+typedef struct {
+    void*           A;
+    void*           B;
+    Reflex_LenType  VarIndex;
+} Change;
+
+typedef struct {
+    Change          Changes[8];
+    uint32_t        Len;
+} ChangeRecorder;
+
+Reflex_Result Reflex_recordChange(Reflex* reflex, void* a, void* b, const void* fmt, Reflex_LenType varIndex) {
+    ChangeRecorder* recorder = (ChangeRecorder*) Reflex_getArgs(reflex);
+
+    recorder->Changes[recorder->Len].A = a;
+    recorder->Changes[recorder->Len].B = b;
+    recorder->Changes[recorder->Len].VarIndex = varIndex;
+    recorder->Len++;
+
+    return recorder->Len < ARRAY_LEN(recorder->Changes) ? REFLEX_OK : REFLEX_ERROR;
+}
+
+Test_Result Assert_Changes(ChangeRecorder* actual, const Change* expected, uint32_t len, uint16_t line) {
+    uint32_t index;
+
+    if (Assert_Num(actual->Len, len, line)) {
+        return (Test_Result) line << 16;
+    }
+    for (index = 0; index < len; index++) {
+        if (actual->Changes[index].A != expected[index].A ||
+            actual->Changes[index].B != expected[index].B ||
+            actual->Changes[index].VarIndex != expected[index].VarIndex
+        ) {
+            PRINTF("Change %u not match, Line: %d\r\n", index, line);
+            return (Test_Result) line << 16 | index;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_Compare(void) {
+    Reflex reflex = {0};
+    ChangeRecorder recorder = {0};
+    TestModel temp1;
+    TestModel temp2;
+    uint16_t value1 = 0xA1A2;
+    uint16_t value2 = 0xA1A2;
+    TestItem items1[2] = { { 0x0102, 0x03 }, { 0x0405, 0x06 } };
+    TestItem items2[2] = { { 0x0102, 0x03 }, { 0x0405, 0x06 } };
+
+    Reflex_setArgs(&reflex, &recorder);
+    assert(Num, Reflex_compile(&TestModel_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    // paddings and address of pointers are not compared
+    TestModel_fill(&temp1, 0x00, &value1, items1);
+    TestModel_fill(&temp2, 0xAA, &value2, items2);
+    assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 1);
+    assert(Num, Reflex_Plan_diff(&reflex, planOps, &temp1, &temp2, Reflex_recordChange), REFLEX_OK);
+    assert(Num, recorder.Len, 0);
+    // changed fields in order of fields
+    {
+        const Change changes[] = {
+            { &temp1.V1, &temp2.V1, 1 },
+            { &items1[1].V0, &items2[1].V0, 4 },
+            { &temp1.V3.V1, &temp2.V3.V1, 7 },
+            { &temp1.V3.V2[1].V1, &temp2.V3.V2[1].V1, 11 },
+            { &temp1.V5[1].V0, &temp2.V5[1].V0, 16 },
+        };
+        value2++;
+        items2[1].V0++;
+        temp2.V3.V1[1]++;
+        temp2.V3.V2[1].V1++;
+        temp2.V5[1].V0++;
+        assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 0);
+        assert(Num, Reflex_Plan_diff(&reflex, planOps, &temp1, &temp2, Reflex_recordChange), REFLEX_OK);
+        assert(Changes, &recorder, changes, ARRAY_LEN(changes));
+    }
+    // each change is found by equals
+    value2 = value1;
+    items2[1].V0 = items1[1].V0;
+    TestModel_fill(&temp2, 0xAA, &value2, items2);
+    assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 1);
+    temp2.V5[0].V1++;
+    assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 0);
+    temp2.V5[0].V1--;
+    items2[0].V1++;
+    assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 0);
+    items2[0].V1--;
+    // NULL pointers
+    {
+        const Change changes[] = {
+            { &temp1.V1, &temp2.V1, 1 },
+            { &items1[0], NULL, 2 },
+        };
+        temp2.V1 = NULL;
+        temp2.V2[0] = NULL;
+        recorder.Len = 0;
+        assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 0);
+        assert(Num, Reflex_Plan_diff(&reflex, planOps, &temp1, &temp2, Reflex_recordChange), REFLEX_OK);
+        assert(Changes, &recorder, changes, ARRAY_LEN(changes));
+        // both NULL are equal
+        temp1.V1 = NULL;
+        temp1.V2[0] = NULL;
+        assert(Num, Reflex_Plan_equals(&reflex, planOps, &temp1, &temp2), 1);
+    }
+    // error of callback stop diff
+    temp2.V0++;
+    temp2.V3.V1[0]++;
+    recorder.Len = ARRAY_LEN(recorder.Changes) - 1;
+    assert(Num, Reflex_Plan_diff(&reflex, planOps, &temp1, &temp2, Reflex_recordChange), REFLEX_ERROR);
+    assert(Num, recorder.Len, ARRAY_LEN(recorder.Changes));
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_COMPARE
+// -------------------------- Test Binary -------------------------
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+Test_Result Test_Binary(void) {
+    Reflex reflex = {0};
+    TestFixed fixed1;
+    TestFixed fixed2;
+    TestModel temp1;
+    TestModel temp2;
+    uint16_t value1 = 0xA1A2;
+    uint16_t value2 = 0;
+    TestItem items1[2] = { { 0x0102, 0x03 }, { 0x0405, 0x06 } };
+    TestItem items2[2] = { { 0 } };
+    uint8_t buf1[64];
+    uint8_t buf2[64];
+    Reflex_LenType len;
+
+    // fixed schema have packed layout
+    assert(Num, Reflex_compile(&TestFixed_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    assert(Num, Reflex_Binary_sizeFixed(planOps), 19);
+    TestFixed_fill(&fixed1, 0xAA);
+    assert(Num, Reflex_Binary_size(&reflex, planOps, &fixed1), 19);
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &fixed1, buf1, sizeof(buf1)), 19);
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+    assert(Num, Reflex_Packed_encode(&TestFixed_SCHEMA, &fixed1, buf2), 19);
+    assert(Num, memcmp(buf1, buf2, 19), 0);
+#endif
+    memset(&fixed2, 0, sizeof(fixed2));
+    assert(Num, Reflex_Binary_decode(&reflex, planOps, &fixed2, buf1, 19), 19);
+    assert(Num, fixed2.V1[1], fixed1.V1[1]);
+    assert(Num, fixed2.V2[1].V1, fixed1.V2[1].V1);
+    assert(Num, fixed2.V3 == fixed1.V3, 1);
+    // buffer is not enough
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &fixed1, buf1, 18), -1);
+    assert(Num, Reflex_Binary_decode(&reflex, planOps, &fixed2, buf1, 18), -1);
+
+    // objects of pointers are written after presence byte
+    assert(Num, Reflex_compile(&TestModel_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    assert(Num, Reflex_Binary_sizeFixed(planOps), -1);
+    TestModel_fill(&temp1, 0xAA, &value1, items1);
+    assert(Num, Reflex_Binary_size(&reflex, planOps, &temp1), 47);
+    len = Reflex_Binary_encode(&reflex, planOps, &temp1, buf1, sizeof(buf1));
+    assert(Num, len, 47);
+    assert(Num, buf1[1], 1);
+    assert(Num, buf1[4], 1);
+    assert(Num, buf1[8], 1);
+    // decode into objects of pointers
+    memset(&temp2, 0, sizeof(temp2));
+    temp2.V1 = &value2;
+    temp2.V2[0] = &items2[0];
+    temp2.V2[1] = &items2[1];
+    assert(Num, Reflex_Binary_decode(&reflex, planOps, &temp2, buf1, len), len);
+    assert(Num, temp2.V0, temp1.V0);
+    assert(Num, value2, value1);
+    assert(Num, items2[1].V0, items1[1].V0);
+    assert(Num, temp2.V3.V2[1].V0, temp1.V3.V2[1].V0);
+    assert(Num, temp2.V5[1].V1, temp1.V5[1].V1);
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &temp2, buf2, sizeof(buf2)), len);
+    assert(Num, memcmp(buf1, buf2, (size_t) len), 0);
+    // NULL pointers
+    temp1.V2[0] = NULL;
+    len = Reflex_Binary_encode(&reflex, planOps, &temp1, buf1, sizeof(buf1));
+    assert(Num, len, 44);
+    assert(Num, buf1[4], 0);
+    assert(Num, Reflex_Binary_decode(&reflex, planOps, &temp2, buf1, len), len);
+    assert(Num, temp2.V2[0] == NULL, 1);
+    assert(Num, temp2.V2[1] == &items2[1], 1);
+    // there is no object for decode
+    temp1.V2[0] = &items1[0];
+    len = Reflex_Binary_encode(&reflex, planOps, &temp1, buf1, sizeof(buf1));
+    assert(Num, Reflex_Binary_decode(&reflex, planOps, &temp2, buf1, len), -1);
+    // invalid marker
+    temp2.V2[0] = &items2[0];
+    buf1[1] = 2;
+    assert(Num, Reflex_Binary_decode(&reflex, planOps, &temp2, buf1, len), -1);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_BINARY
+// -------------------------- Test Byte Order -------------------------
+#if REFLEX_SUPPORT_BYTE_ORDER && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+// network order is big endian on all hosts
+#define ORDER_SWAP      (!REFLEX_BIG_ENDIAN)
+
+Test_Result Test_ByteOrder(void) {
+    Reflex reflex = {0};
+    TestStream stream;
+    TestModel temp1;
+    TestModel temp2;
+    TestFixed fixed;
+    uint16_t value1 = 0xB1B2;
+    uint16_t value2 = 0;
+    TestItem items1[2] = { { 0xC1C2, 0xC3 }, { 0xD1D2, 0xD3 } };
+    TestItem items2[2] = { { 0 } };
+    uint8_t buf1[64];
+    uint8_t buf2[64];
+    Reflex_LenType len;
+
+    assert(Num, Reflex_compile(&TestModel_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    TestModel_fill(&temp1, 0x00, &value1, items1);
+    TestStream_appendModel(&stream, &temp1, ORDER_SWAP);
+    // network order bytes are same as hand swapped bytes
+    len = Reflex_Binary_encodeOrder(&reflex, planOps, &temp1, buf1, sizeof(buf1), Reflex_ByteOrder_Network);
+    assert(Num, len, (Reflex_LenType) stream.Len);
+    assert(Num, memcmp(buf1, stream.Bytes, stream.Len), 0);
+    // round trip through network order in place, objects of pointers are converted too
+    TestModel_fill(&temp2, 0x00, &value2, items2);
+    assert(Num, Reflex_Binary_decodeOrder(&reflex, planOps, &temp2, buf1, len, Reflex_ByteOrder_Network), len);
+    assert(Num, Reflex_Plan_toNetworkOrder(&reflex, planOps, &temp2), REFLEX_OK);
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &temp2, buf2, sizeof(buf2)), len);
+    assert(Num, memcmp(buf2, stream.Bytes, stream.Len), 0);
+    assert(Num, Reflex_Plan_fromNetworkOrder(&reflex, planOps, &temp2), REFLEX_OK);
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &temp1, buf1, sizeof(buf1)), len);
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &temp2, buf2, sizeof(buf2)), len);
+    assert(Num, memcmp(buf1, buf2, (size_t) len), 0);
+    assert(Num, value2, value1);
+    assert(Num, items2[1].V0, items1[1].V0);
+    // plans without pointers are converted in size of plan
+    assert(Num, Reflex_compile(&TestFixed_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    TestFixed_fill(&fixed, 0x00);
+    TestStream_appendFixed(&stream, &fixed, ORDER_SWAP);
+    assert(Num, Reflex_Plan_toNetworkOrder(&reflex, planOps, &fixed), REFLEX_OK);
+    assert(Num, Reflex_Binary_encode(&reflex, planOps, &fixed, buf2, sizeof(buf2)), Reflex_Binary_sizeFixed(planOps));
+    assert(Num, memcmp(buf2, &stream.Bytes[len], (size_t) Reflex_Binary_sizeFixed(planOps)), 0);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_BYTE_ORDER
+// -------------------------- Test View -------------------------
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+Test_Result Test_View(void) {
+    Reflex reflex = {0};
+    Reflex_View view;
+    Reflex_ViewRef root;
+    Reflex_ViewRef child;
+    Reflex_ViewRef inner;
+    Reflex_ViewEntry entries[24];
+    TestModel temp;
+    uint16_t value = 0xA1A2;
+    TestItem items[2] = { { 0x0102, 0x03 }, { 0x0405, 0x06 } };
+    uint8_t buf[64];
+    Reflex_LenType len;
+
+    assert(Num, Reflex_compile(&TestModel_SCHEMA, planOps, ARRAY_LEN(planOps)) > 0, 1);
+    TestModel_fill(&temp, 0xAA, &value, items);
+    len = Reflex_Binary_encode(&reflex, planOps, &temp, buf, sizeof(buf));
+    assert(Num, len, 47);
+
+    assert(Num, Reflex_View_init(&view, planOps, buf, len, entries, 17), REFLEX_ERROR);
+    assert(Num, Reflex_View_init(&view, planOps, buf, len, entries, ARRAY_LEN(entries)), REFLEX_OK);
+    // fields are read on first access
+    assert(Num, view.Resolved, 0);
+    assert(Num, Reflex_View_getUInt8(&view, 0, 0), temp.V0);
+    assert(Num, view.Resolved, 1);
+    root = Reflex_View_root(&view);
+    assert(Num, Reflex_View_var(&root, &TestModel_FMT[1]), 1);
+    assert(Num, Reflex_View_getUInt16(&view, 1, 0), value);
+    assert(Num, Reflex_View_getUInt16(&view, 1, 1), 0);
+    assert(Num, Reflex_View_getUInt32(&view, 1, 0), 0);
+    // drill down into elements of complex fields
+    assert(Num, Reflex_View_child(&root, &TestModel_FMT[2], 1, &child), 1);
+    assert(Num, Reflex_View_getUInt16(&view, Reflex_View_var(&child, &TestItem_FMT[0]), 0), items[1].V0);
+    assert(Num, Reflex_View_child(&root, &TestModel_FMT[2], 2, &child), 0);
+    assert(Num, Reflex_View_child(&root, &TestModel_FMT[3], 0, &child), 1);
+    assert(Num, Reflex_View_getUInt32(&view, Reflex_View_var(&child, &TestFixed_FMT[1]), 1), temp.V3.V1[1]);
+    assert(Num, Reflex_View_getUInt32(&view, Reflex_View_var(&child, &TestFixed_FMT[1]), 2), 0);
+    assert(Num, Reflex_View_child(&child, &TestFixed_FMT[2], 1, &inner), 1);
+    assert(Num, Reflex_View_getUInt8(&view, Reflex_View_var(&inner, &TestItem_FMT[1]), 0), temp.V3.V2[1].V1);
+    assert(Num, Reflex_View_var(&root, &TestItem_FMT[0]), -1);
+    assert(Num, Reflex_View_getFloat(&view, Reflex_View_var(&child, &TestFixed_FMT[3]), 0) == temp.V3.V3, 1);
+    assert(Num, view.Resolved, 13);
+    // items are read in place
+    assert(Ptr, Reflex_View_item(&view, 7, 1), &buf[17]);
+    assert(Num, Reflex_View_offset(&view, 13), 31);
+    assert(Num, Reflex_View_offset(&view, 18), -1);
+
+    // NULL pointers
+    temp.V1 = NULL;
+    temp.V2[0] = NULL;
+    len = Reflex_Binary_encode(&reflex, planOps, &temp, buf, sizeof(buf));
+    assert(Num, Reflex_View_init(&view, planOps, buf, len, entries, ARRAY_LEN(entries)), REFLEX_OK);
+    root = Reflex_View_root(&view);
+    assert(Ptr, Reflex_View_item(&view, 1, 0), NULL);
+    assert(Num, Reflex_View_child(&root, &TestModel_FMT[2], 0, &child), 0);
+    assert(Num, Reflex_View_offset(&view, 2), -1);
+    assert(Num, Reflex_View_child(&root, &TestModel_FMT[2], 1, &child), 1);
+    assert(Num, Reflex_View_getUInt8(&view, Reflex_View_var(&child, &TestItem_FMT[1]), 0), items[1].V1);
+    assert(Num, Reflex_View_offset(&view, 13), len - 16);
+    // buffer is not enough, fields before end are valid
+    assert(Num, Reflex_View_init(&view, planOps, buf, len - 1, entries, ARRAY_LEN(entries)), REFLEX_OK);
+    assert(Num, Reflex_View_offset(&view, 17), -1);
+    assert(Num, Reflex_View_getUInt8(&view, 6, 0), temp.V3.V0);
+    // invalid marker
+    buf[1] = 2;
+    assert(Num, Reflex_View_init(&view, planOps, buf, len, entries, ARRAY_LEN(entries)), REFLEX_OK);
+    assert(Num, Reflex_View_getUInt8(&view, 0, 0), temp.V0);
+    assert(Num, Reflex_View_offset(&view, 1), -1);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_VIEW
+// -------------------------- Test Json -------------------------
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER && REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER && REFLEX_SUPPORT_TYPE_ARRAY_2D && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE && REFLEX_FORMAT_MODE_PARAM
+#include <math.h>
+
+typedef struct {
+    int32_t         V0;
+    int16_t         V1;
+} JsonPoint;
+static const Reflex_JsonParams JsonPoint_FMT[] CONST_VAR_ATTR = {
+    REFLEX_JSON_PARAMS("x", Reflex_Type_Primary_Int32),
+    REFLEX_JSON_PARAMS("y", Reflex_Type_Primary_Int16),
+};
+static const Reflex_Schema JsonPoint_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, JsonPoint_FMT);
+// schema without names is written as arrays
+typedef struct {
+    int64_t         V0;
+    uint8_t         V1;
+} JsonPair;
+static const Reflex_TypeParams JsonPair_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Int64),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+};
+static const Reflex_Schema JsonPair_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, JsonPair_FMT);
+// custom type params with same size of Reflex_JsonParams, it has no names
+typedef struct {
+    Reflex_TypeParams   Params;
+    const char*         V0;
+    const void*         V1;
+} JsonCustomParams;
+static const JsonCustomParams JsonCustom_FMT[] CONST_VAR_ATTR = {
+    { .Params = REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Int64), .V0 = (const char*) (Reflex_PtrType) 0x10004D2, .V1 = NULL, },
+    { .Params = REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8), .V0 = (const char*) (Reflex_PtrType) 0x10004D2, .V1 = NULL, },
+};
+static const Reflex_Schema JsonCustom_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, JsonCustom_FMT);
+
+typedef struct {
+    char            V0[12];
+    uint8_t*        V1;
+    float           V2;
+    double          V3[4];
+    JsonPoint       V4;
+    JsonPoint       V5[2][2];
+    uint16_t        V6[2][3];
+    JsonPair        V7[2];
+    char            V8;
+} JsonModel;
+static const Reflex_JsonParams JsonModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_JSON_PARAMS("name", Reflex_Type_Array_Char, 12),
+    REFLEX_JSON_PARAMS("flag", Reflex_Type_Pointer_UInt8),
+    REFLEX_JSON_PARAMS("ratio", Reflex_Type_Primary_Float),
+    REFLEX_JSON_PARAMS("values", Reflex_Type_Array_Double, 4),
+    REFLEX_JSON_PARAMS("origin", Reflex_Type_Primary_Complex, 0, 0, &JsonPoint_SCHEMA),
+    REFLEX_JSON_PARAMS("grid", Reflex_Type_Array2D_Complex, 2, 2, &JsonPoint_SCHEMA),
+    REFLEX_JSON_PARAMS("cells", Reflex_Type_Array2D_UInt16, 2, 3),
+    REFLEX_JSON_PARAMS("pairs", Reflex_Type_Array_Complex, 2, 0, &JsonPair_SCHEMA),
+    REFLEX_JSON_PARAMS("tag", Reflex_Type_Primary_Char),
+};
+static const Reflex_Schema JsonModel_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, JsonModel_FMT);
+
+static const char JSON_MODEL_TEXT[] =
+    "{\"name\":\"a\\\"b\\\\c\\n\\u0001\",\"flag\":null,\"ratio\":0.1,"
+    "\"values\":[0.30000000000000004,5e-324,-0,null],\"origin\":{\"x\":-7,\"y\":300},"
+    "\"grid\":[[{\"x\":1,\"y\":2},{\"x\":3,\"y\":4}],[{\"x\":5,\"y\":6},{\"x\":7,\"y\":8}]],"
+    "\"cells\":[[1,2,3],[4,5,65535]],\"pairs\":[[-9223372036854775808,1],[42,255]],\"tag\":\"t\"}";
+
+Test_Result Test_Json(void) {
+    Reflex reflex = {0};
+    JsonModel temp;
+    char text[320];
+    char num[REFLEX_JSON_NUMBER_LEN + 1];
+    Reflex_PtrType len = sizeof(JSON_MODEL_TEXT) - 1;
+    uint8_t index;
+
+    memset(&temp, 0, sizeof(temp));
+    memcpy(temp.V0, "a\"b\\c\n\x01", 8);
+    temp.V2 = 0.1f;
+    temp.V3[0] = 0.30000000000000004;
+    temp.V3[1] = 5e-324;
+    temp.V3[2] = -0.0;
+    temp.V3[3] = NAN;
+    temp.V4.V0 = -7;
+    temp.V4.V1 = 300;
+    for (index = 0; index < 4; index++) {
+        temp.V5[index / 2][index % 2].V0 = index * 2 + 1;
+        temp.V5[index / 2][index % 2].V1 = index * 2 + 2;
+    }
+    for (index = 0; index < 6; index++) {
+        temp.V6[index / 3][index % 3] = index + 1;
+    }
+    temp.V6[1][2] = 0xFFFF;
+    temp.V7[0].V0 = INT64_MIN;
+    temp.V7[0].V1 = 1;
+    temp.V7[1].V0 = 42;
+    temp.V7[1].V1 = 255;
+    temp.V8 = 't';
+
+    Reflex_init(&reflex, &JsonModel_SCHEMA);
+    assert(Num, Reflex_Json_encode(&reflex, &temp, text, sizeof(text)), len);
+    assert(Str, text, JSON_MODEL_TEXT);
+    // small buffer, bytes after size are not changed and needed bytes are returned
+    memset(text, '#', sizeof(text));
+    assert(Num, Reflex_Json_encode(&reflex, &temp, text, 40), len);
+    assert(Num, memcmp(text, JSON_MODEL_TEXT, 40), 0);
+    assert(Num, text[40], '#');
+    // null terminator only if there is space for it
+    assert(Num, Reflex_Json_encode(&reflex, &temp, text, len), len);
+    assert(Num, text[len], '#');
+    assert(Num, Reflex_Json_encode(&reflex, &temp, text, len + 1), len);
+    assert(Num, text[len], '\0');
+    // main object without names
+    Reflex_init(&reflex, &JsonPair_SCHEMA);
+    assert(Num, Reflex_Json_encode(&reflex, &temp.V7[1], text, sizeof(text)), 8);
+    assert(Str, text, "[42,255]");
+    // custom type params with same size are not names
+    Reflex_init(&reflex, &JsonCustom_SCHEMA);
+    assert(Num, Reflex_Json_encode(&reflex, &temp.V7[1], text, sizeof(text)), 8);
+    assert(Str, text, "[42,255]");
+    // numbers
+    num[Reflex_Json_formatDouble(num, 1.7976931348623157e308)] = '\0';
+    assert(Str, num, "1.7976931348623157e308");
+    num[Reflex_Json_formatDouble(num, 1e21)] = '\0';
+    assert(Str, num, "1e21");
+    num[Reflex_Json_formatDouble(num, 123456789012345680000.0)] = '\0';
+    assert(Str, num, "123456789012345680000");
+    num[Reflex_Json_formatDouble(num, 1e-7)] = '\0';
+    assert(Str, num, "1e-7");
+    num[Reflex_Json_formatDouble(num, -0.000001)] = '\0';
+    assert(Str, num, "-0.000001");
+    num[Reflex_Json_formatFloat(num, 3.4028235e38f)] = '\0';
+    assert(Str, num, "3.4028235e38");
+    num[Reflex_Json_formatFloat(num, 1e-45f)] = '\0';
+    assert(Str, num, "1e-45");
+    num[Reflex_Json_formatFloat(num, 16777216.0f)] = '\0';
+    assert(Str, num, "16777216");
+    num[Reflex_Json_formatUInt(num, UINT64_MAX)] = '\0';
+    assert(Str, num, "18446744073709551615");
+
+    return 0;
+}
+#if REFLEX_SUPPORT_PLAN
+static const char JSON_DECODE_TEXT[] =
+    "{ \"tag\" : \"z\", \"unknown\": {\"a\": [1, {\"b\": \"]}\\\"\"}], \"c\": null},\n"
+    "  \"flag\": 7, \"n\\u0061me\": \"\\u00e9\\ud83d\\ude00\", \"origin\": {\"y\": -2, \"z\": true, \"x\": 1000},\n"
+    "  \"cells\": [[9, 8, 7, 6], [5]], \"pairs\": [[1, 2, 3], [4, 5], [6, 7]],\n"
+    "  \"ratio\": 2.5e-1, \"values\": [1.5, -2E2] }";
+
+Test_Result Test_JsonDecode(void) {
+    Reflex reflex = {0};
+    Reflex_JsonReader reader;
+    Reflex_JsonKey keys[32];
+    Reflex_PlanOp plan[64];
+    JsonModel temp;
+    JsonPair pair;
+    char text[320];
+    uint8_t flag = 0;
+    Reflex_LenType len;
+
+    assert(Num, Reflex_compile(&JsonModel_SCHEMA, plan, ARRAY_LEN(plan)) > 0, 1);
+    len = Reflex_Json_bind(&reader, &JsonModel_SCHEMA, plan, NULL, 0);
+    assert(Num, Reflex_Json_bind(&reader, &JsonModel_SCHEMA, plan, keys, len - 1), -1);
+    assert(Num, Reflex_Json_bind(&reader, &JsonModel_SCHEMA, plan, keys, ARRAY_LEN(keys)), len);
+    // decoded object is written same as source text, null values are not changed
+    memset(&temp, 0, sizeof(temp));
+    temp.V3[3] = NAN;
+    assert(Num, Reflex_Json_decode(&reader, &temp, JSON_MODEL_TEXT, sizeof(JSON_MODEL_TEXT) - 1), REFLEX_OK);
+    assert(Num, temp.V7[0].V0 == INT64_MIN, 1);
+    Reflex_init(&reflex, &JsonModel_SCHEMA);
+    text[Reflex_Json_encode(&reflex, &temp, text, sizeof(text) - 1)] = '\0';
+    assert(Str, text, JSON_MODEL_TEXT);
+    // keys in any order, escaped keys, unknown keys and extra items
+    temp.V1 = &flag;
+    assert(Num, Reflex_Json_decode(&reader, &temp, JSON_DECODE_TEXT, sizeof(JSON_DECODE_TEXT) - 1), REFLEX_OK);
+    assert(Str, temp.V0, "\xC3\xA9\xF0\x9F\x98\x80");
+    assert(Num, flag, 7);
+    assert(Num, temp.V2 == 0.25f, 1);
+    assert(Num, temp.V3[0] == 1.5 && temp.V3[1] == -200.0 && temp.V3[2] == 0.0, 1);
+    assert(Num, temp.V4.V0, 1000);
+    assert(Num, temp.V4.V1, -2);
+    assert(Num, temp.V5[1][1].V0, 7);
+    assert(Num, temp.V6[0][2], 7);
+    assert(Num, temp.V6[1][0], 5);
+    assert(Num, temp.V6[1][2], 0xFFFF);
+    assert(Num, temp.V7[0].V0 == 1 && temp.V7[0].V1 == 2, 1);
+    assert(Num, temp.V7[1].V0 == 4 && temp.V7[1].V1 == 5, 1);
+    assert(Num, temp.V8, 'z');
+    // errors
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"cells\":[[70000]]}", 19), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"origin\":{\"x\":1.5}}", 20), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"pairs\":[[-9223372036854775809]]}", 34), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"ratio\":01}", 12), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"name\":\"\\x\"}", 13), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"tag\":\"t\"", 10), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"tag\":\"t\"} {", 13), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"values\":[1e400]}", 19), REFLEX_ERROR);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"ratio\":-1e39}", 16), REFLEX_ERROR);
+    // strings longer than char arrays are error and truncated with null terminator
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"name\":\"abcdefghijkl\"}", 23), REFLEX_OK);
+    assert(Num, memcmp(temp.V0, "abcdefghijkl", 12), 0);
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"name\":\"abcdefghijklmnopqrst\"}", 31), REFLEX_ERROR);
+    assert(Str, temp.V0, "abcdefghijk");
+    assert(Num, Reflex_Json_decode(&reader, &temp, "{\"tag\":\"ab\"}", 12), REFLEX_ERROR);
+    assert(Num, temp.V8, '\0');
+    // main object without names
+    assert(Num, Reflex_compile(&JsonPair_SCHEMA, plan, ARRAY_LEN(plan)) > 0, 1);
+    assert(Num, Reflex_Json_bind(&reader, &JsonPair_SCHEMA, plan, keys, ARRAY_LEN(keys)), 0);
+    assert(Num, Reflex_Json_decode(&reader, &pair, " [ -5, 200, \"extra\" ] ", 22), REFLEX_OK);
+    assert(Num, pair.V0 == -5 && pair.V1 == 200, 1);
+    // custom type params with same size are not names
+    assert(Num, Reflex_compile(&JsonCustom_SCHEMA, plan, ARRAY_LEN(plan)) > 0, 1);
+    assert(Num, Reflex_Json_bind(&reader, &JsonCustom_SCHEMA, plan, keys, ARRAY_LEN(keys)), 0);
+    assert(Num, Reflex_Json_decode(&reader, &pair, "[7,8]", 5), REFLEX_OK);
+    assert(Num, pair.V0 == 7 && pair.V1 == 8, 1);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_PLAN
+#endif // REFLEX_SUPPORT_JSON
+// -------------------------- Test Index -------------------------
+#if REFLEX_SUPPORT_INDEX && REFLEX_SUPPORT_TYPE_COMPLEX
+static Reflex_IndexEntry indexEntries[1024];
+
+Test_Result Assert_IndexSchema(Reflex* reflex, const Reflex_Index* index, void* obj, const Reflex_Schema* schema, uint16_t line) {
+    Reflex_Field expected = {0};
+    Reflex_Field actual = {0};
+    const Reflex_TypeParams* fmt;
+    const void* fieldFmt;
+    Reflex_LenType fieldIndex;
+
+    for (fieldIndex = 0; fieldIndex < schema->Len; fieldIndex++) {
+        fieldFmt = (const uint8_t*) schema->CustomFmt + fieldIndex * schema->FmtSize;
+        assert(Num, Reflex_getField(reflex, obj, fieldFmt, &expected), Reflex_GetResult_Ok);
+        assert(Num, Reflex_Index_getField(index, obj, fieldFmt, &actual), Reflex_GetResult_Ok);
+        assert(Ptr, actual.CustomFmt, expected.CustomFmt);
+        assert(Ptr, Reflex_Field_getVariable(&actual), Reflex_Field_getVariable(&expected));
+        assert(Ptr, Reflex_Field_getMainVariable(&actual), Reflex_Field_getMainVariable(&expected));
+        assert(Num, Reflex_Field_getVarIndex(&actual), Reflex_Field_getVarIndex(&expected));
+        assert(Num, Reflex_Field_getVarOffset(&actual), Reflex_Field_getVarOffset(&expected));
+        if (schema->FormatMode == Reflex_FormatMode_Primary) {
+            continue;
+        }
+        fmt = (const Reflex_TypeParams*) fieldFmt;
+        if (fmt->Fields.Primary == Reflex_PrimaryType_Complex) {
+            assertResult = Assert_IndexSchema(reflex, index, obj, fmt->Schema, line);
+            if (assertResult) {
+                return assertResult;
+            }
+        }
+        else {
+            // flat VarIndex give same field
+            assert(Num, Reflex_Index_getFieldAt(index, obj, Reflex_Field_getVarIndex(&expected), &actual), Reflex_GetResult_Ok);
+            assert(Ptr, actual.CustomFmt, fieldFmt);
+        }
+    }
+
+    return 0;
+}
+
+typedef struct {
+    const Reflex_Index* Index;
+    void*               Object;
+    Reflex_LenType      Count;
+} IndexChecker;
+
+Reflex_Result Reflex_checkIndexField(Reflex* reflex, void* value, const void* fmt) {
+    IndexChecker* checker = (IndexChecker*) reflex->Args;
+    Reflex_Field field = {0};
+
+    if (reflex->Schema->FormatMode != Reflex_FormatMode_Primary &&
+        ((const Reflex_TypeParams*) fmt)->Fields.Primary == Reflex_PrimaryType_Complex) {
+        return REFLEX_OK;
+    }
+    // every field of every element is found by flat VarIndex
+    if (Reflex_Index_getFieldAt(checker->Index, checker->Object, Reflex_getVarIndex(reflex), &field) != Reflex_GetResult_Ok) {
+        PRINTF("Idx: %d, Field not found\r\n", Reflex_getVarIndex(reflex));
+        return 1;
+    }
+    if (Reflex_Field_getVariable(&field) != value) {
+        PRINTF("Idx: %d, Address not match\r\n", Reflex_getVarIndex(reflex));
+        return 2;
+    }
+    checker->Count++;
+
+    return REFLEX_OK;
+}
+
+#define Assert_Index(SCHEMA, OBJ)       Reflex_init(&reflex, &SCHEMA); \
+                                        assert(Num, Reflex_Index_build(&index, &SCHEMA, &OBJ, NULL, 0) <= ARRAY_LEN(indexEntries), 1); \
+                                        assert(Num, Reflex_Index_build(&index, &SCHEMA, &OBJ, indexEntries, ARRAY_LEN(indexEntries)) > 0, 1); \
+                                        assert(Num, Assert_IndexSchema(&reflex, &index, &OBJ, &SCHEMA, __LINE__), 0); \
+                                        checker.Index = &index; \
+                                        checker.Object = &OBJ; \
+                                        checker.Count = 0; \
+                                        Reflex_setCallback(&reflex, Reflex_checkIndexField); \
+                                        Reflex_setArgs(&reflex, &checker); \
+                                        assert(Num, Reflex_scan(&reflex, &OBJ), REFLEX_OK); \
+                                        assert(Num, checker.Count > 0, 1)
+
+Test_Result Test_Index(void) {
+    Reflex reflex = {0};
+    Reflex_Index index = {0};
+    Reflex_Field field = {0};
+    IndexChecker checker = {0};
+    PrimaryTemp4 temp1 = {0};
+    CModel3 temp2 = {0};
+    CModel5 temp3 = {0};
+    Model1 model1[17] = {0};
+    Model2 model2[4] = {0};
+    uint32_t idx;
+
+    temp2.V6 = &model1[16];
+    for (idx = 0; idx < 4; idx++) {
+        temp2.V10[idx] = &model2[idx];
+    }
+    for (idx = 0; idx < 16; idx++) {
+        temp3.V3[idx] = &model1[idx];
+    }
+
+    Assert_Index(PrimaryTemp4_SCHEMA, temp1);
+    Assert_Index(CModel5_SCHEMA, temp3);
+    // index is valid for other objects
+    assert(Num, Reflex_Index_getField(&index, &temp3, &CModel5_FMT[5], &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp3.V5);
+    assert(Num, Reflex_Index_getField(&index, &temp3, &Model2_FMT[2], &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp3.V1[0].V2);
+    Assert_Index(CModel3_SCHEMA, temp2);
+    // fields of next elements of complex arrays
+    assert(Num, Reflex_Index_getField(&index, &temp2, &Model2_FMT[1], &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp2.V4[0].V1);
+    assert(Num, Reflex_Index_getFieldAt(&index, &temp2, Reflex_Field_getVarIndex(&field) + Model2_SCHEMA.Len, &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp2.V4[1].V1);
+    assert(Num, Reflex_Index_getField(&index, &temp2, &Model2_FMT_OFFSET[1], &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &model2[0].V1);
+    assert(Num, Reflex_Index_getFieldAt(&index, &temp2, Reflex_Field_getVarIndex(&field) + Model2_SCHEMA_OFFSET.Len, &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &model2[1].V1);
+    // follow pointers of object
+    temp2.V6 = &model1[0];
+    assert(Num, Reflex_Index_getField(&index, &temp2, &Model1_FMT_OFFSET[2], &field), Reflex_GetResult_Ok);
+    assert(Ptr, Reflex_Field_getVariable(&field), &model1[0].V2);
+    assert(Ptr, Reflex_Field_getMainVariable(&field), &model1[0]);
+    // not found
+    assert(Num, Reflex_Index_getField(&index, &temp2, &CModel5_FMT[0], &field), Reflex_GetResult_NotFound);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_INDEX
+// -------------------------- Test Cursor -------------------------
+#if REFLEX_SUPPORT_CURSOR && REFLEX_SUPPORT_TYPE_COMPLEX
+static Reflex_Cursor cursor;
+
+Reflex_Result Reflex_Cursor_record(Reflex* reflex, void* obj) {
+    Reflex_Field field;
+    Reflex_CursorEvent event;
+
+    Reflex_Cursor_begin(&cursor, reflex, obj);
+    while ((event = Reflex_Cursor_next(&cursor, &field)) != Reflex_CursorEvent_Done) {
+        if (event == Reflex_CursorEvent_Error) {
+            return REFLEX_ERROR;
+        }
+        Reflex_recordField(reflex, field.Object, field.Fmt);
+    }
+
+    return REFLEX_OK;
+}
+
+#define Assert_Cursor(SCHEMA, OBJ, BREAK_AT)    memset(recorders, 0, sizeof(recorders)); \
+                                                recorders[0].BreakAt = BREAK_AT; \
+                                                recorders[1].BreakAt = BREAK_AT; \
+                                                recorders[0].ErrorAt = -1; \
+                                                recorders[1].ErrorAt = -1; \
+                                                Reflex_init(&reflex, &SCHEMA); \
+                                                Reflex_setArgs(&reflex, &recorders[0]); \
+                                                assert(Num, Reflex_scan(&reflex, &OBJ), REFLEX_OK); \
+                                                Reflex_setArgs(&reflex, &recorders[1]); \
+                                                assert(Num, Reflex_Cursor_record(&reflex, &OBJ), REFLEX_OK); \
+                                                assert(Records, &recorders[0], &recorders[1])
+
+Test_Result Test_Cursor(void) {
+    Reflex reflex = {0};
+    Reflex_Field field = {0};
+    Model1 temp1 = {0};
+    PrimaryTemp4 temp2 = {0};
+    CModel2 temp3 = {0};
+    CModel3 temp4 = {0};
+    CModel4 temp5 = {0};
+    Model1 model1 = {0};
+    Model2 model2[4] = {0};
+    uint32_t index;
+
+    // cursor is placed on stack, keep each layer close to its own fields
+    assert(Num, sizeof(Reflex_CursorLayer) <= 8 * sizeof(void*) + 6 * sizeof(Reflex_LenType) + sizeof(Reflex_TypeParams), 1);
+    assert(Num, sizeof(Reflex_Cursor) <= (REFLEX_MAX_DEPTH + 2) * sizeof(Reflex_CursorLayer), 1);
+
+    temp4.V6 = &model1;
+    for (index = 0; index < 4; index++) {
+        temp4.V10[index] = &model2[index];
+    }
+    Reflex_setCallback(&reflex, Reflex_recordField);
+
+    Assert_Cursor(Model1_SCHEMA, temp1, -1);
+    Assert_Cursor(Model1_SCHEMA_OFFSET, temp1, -1);
+    Assert_Cursor(PrimaryTemp4_SCHEMA, temp2, -1);
+    Assert_Cursor(CModel2_SCHEMA, temp3, -1);
+    Assert_Cursor(CModel3_SCHEMA, temp4, -1);
+    Assert_Cursor(CModel3_SCHEMA, temp4, 13);
+    Assert_Cursor(CModel3_SCHEMA, temp4, 33);
+    Assert_Cursor(CModel3_SCHEMA, temp4, 60);
+    Assert_Cursor(CModel4_SCHEMA, temp5, -1);
+    Assert_Cursor(CModel4_SCHEMA, temp5, 7);
+    Assert_Cursor(CModel4_SCHEMA, temp5, 16);
+
+    // pull fields one by one
+    Reflex_init(&reflex, &CModel4_SCHEMA);
+    Reflex_Cursor_begin(&cursor, &reflex, &temp5);
+    assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp5.V0);
+    assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Begin);
+    assert(Ptr, field.Fmt, &CModel4_FMT[1]);
+    for (index = 0; index < 3; index++) {
+        assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+        assert(Ptr, Reflex_Field_getVariable(&field), &temp5.V1[index].V0);
+        assert(Num, Reflex_Field_getVarIndex(&field), 1 + index * 4);
+        assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+        assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+        assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+        assert(Ptr, Reflex_Field_getVariable(&field), &temp5.V1[index].V3);
+    }
+    assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_End);
+    assert(Ptr, field.Fmt, &CModel4_FMT[1]);
+    assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp5.V2);
+    // stop in middle of object, cursor can start again
+    Reflex_Cursor_begin(&cursor, &reflex, &temp5);
+    assert(Num, Reflex_Cursor_next(&cursor, &field), Reflex_CursorEvent_Field);
+    assert(Ptr, Reflex_Field_getVariable(&field), &temp5.V0);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_CURSOR
+// -------------------------- Test Prefetch -------------------------
+#if REFLEX_PREFETCH_DISTANCE > 0 && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_CURSOR && REFLEX_SUPPORT_TYPE_COMPLEX && REFLEX_SUPPORT_TYPE_POINTER_ARRAY && REFLEX_FORMAT_MODE_PARAM
+typedef struct {
+    uint32_t    V0;
+    uint8_t     V1[3];
+} PrefetchItem;
+static const Reflex_TypeParams PrefetchItem_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt8, 3, 0),
+};
+static const Reflex_Schema PrefetchItem_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, PrefetchItem_FMT);
+
+// arrays longer and shorter than REFLEX_PREFETCH_DISTANCE
+typedef struct {
+    PrefetchItem*   V0[11];
+    PrefetchItem*   V1[2];
+    PrefetchItem*   V2[1];
+} PrefetchModel;
+static const Reflex_TypeParams PrefetchModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Complex, 11, 0, &PrefetchItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Complex, 2, 0, &PrefetchItem_SCHEMA),
+    REFLEX_TYPE_PARAMS(Reflex_Type_PointerArray_Complex, 1, 0, &PrefetchItem_SCHEMA),
+};
+static const Reflex_Schema PrefetchModel_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, PrefetchModel_FMT);
+
+Test_Result Test_Prefetch(void) {
+    Reflex reflex = {0};
+    PrefetchModel temp = {0};
+    PrefetchItem items[16] = {0};
+    PrefetchItem** pointers = (PrefetchItem**) &temp;
+    // shuffled objects, -1 is NULL element
+    static const int8_t order[] = { 9, -1, 3, 14, 0, -1, 7, 12, 5, -1, 1, -1, 10, -1 };
+    void* expected[32];
+    uint32_t len = 0;
+    uint32_t count = 0;
+    uint32_t index;
+
+    for (index = 0; index < ARRAY_LEN(order); index++) {
+        pointers[index] = order[index] < 0 ? NULL : &items[order[index]];
+        // fields of NULL element are reported relative to NULL
+        expected[len++] = (void*) ((uintptr_t) pointers[index]);
+        expected[len++] = (void*) ((uintptr_t) pointers[index] + ((uint8_t*) items[0].V1 - (uint8_t*) &items[0]));
+    }
+
+    // fields are same as scan without prefetch, objects in order of pointers
+    Reflex_setCallback(&reflex, Reflex_recordField);
+    memset(recorders, 0, sizeof(recorders));
+    recorders[0].BreakAt = -1;
+    recorders[0].ErrorAt = -1;
+    Reflex_init(&reflex, &PrefetchModel_SCHEMA);
+    Reflex_setArgs(&reflex, &recorders[0]);
+    assert(Num, Reflex_scan(&reflex, &temp), REFLEX_OK);
+    assert(Ptr, reflex.PObj, &temp + 1);
+    for (index = 0; index < recorders[0].Len; index++) {
+        if (recorders[0].Records[index].Type != Reflex_Type_PointerArray_Complex) {
+            assert(Num, count < len, 1);
+            assert(Ptr, recorders[0].Records[index].Obj, expected[count]);
+            count++;
+        }
+    }
+    assert(Num, count, len);
+    // plan and cursor give same callbacks as scan
+    Assert_Plan(PrefetchModel_SCHEMA, temp, -1);
+    Assert_Plan(PrefetchModel_SCHEMA, temp, 4);
+    Assert_Cursor(PrefetchModel_SCHEMA, temp, -1);
+    Assert_Cursor(PrefetchModel_SCHEMA, temp, 4);
+
+    return 0;
+}
+#endif // REFLEX_PREFETCH_DISTANCE
+// -------------------------- Test Stack Scan -------------------------
+#if REFLEX_SUPPORT_STACK_SCAN && REFLEX_SUPPORT_TYPE_COMPLEX
+#define Assert_Stack(SCHEMA, OBJ, BREAK_AT, ERROR_AT, RESULT) \
+                                                memset(recorders, 0, sizeof(recorders)); \
+                                                recorders[0].BreakAt = BREAK_AT; \
+                                                recorders[1].BreakAt = BREAK_AT; \
+                                                recorders[0].ErrorAt = ERROR_AT; \
+                                                recorders[1].ErrorAt = ERROR_AT; \
+                                                Reflex_init(&reflex, &SCHEMA); \
+                                                Reflex_setArgs(&reflex, &recorders[0]); \
+                                                assert(Num, Reflex_scan(&reflex, &OBJ), RESULT); \
+                                                Reflex_setArgs(&reflex, &recorders[1]); \
+                                                assert(Num, Reflex_Stack_scan(&reflex, &OBJ), RESULT); \
+                                                assert(Num, reflex.LayerIndex, 0); \
+                                                assert(Ptr, reflex.Schema, &SCHEMA); \
+                                                assert(Records, &recorders[0], &recorders[1])
+
+Test_Result Test_Stack(void) {
+    Reflex reflex = {0};
+    Model1 temp1 = {0};
+    PrimaryTemp4 temp2 = {0};
+    CModel2 temp3 = {0};
+    CModel3 temp4 = {0};
+    CModel4 temp5 = {0};
+    Model1 model1 = {0};
+    Model2 model2[4] = {0};
+    uint32_t index;
+
+    temp4.V6 = &model1;
+    for (index = 0; index < 4; index++) {
+        temp4.V10[index] = &model2[index];
+    }
+    Reflex_setCallback(&reflex, Reflex_recordField);
+
+    Assert_Stack(Model1_SCHEMA, temp1, -1, -1, REFLEX_OK);
+    Assert_Stack(Model1_SCHEMA_OFFSET, temp1, -1, -1, REFLEX_OK);
+    Assert_Stack(PrimaryTemp4_SCHEMA, temp2, -1, -1, REFLEX_OK);
+    Assert_Stack(PrimaryTemp4_SCHEMA, temp2, -1, 3, 5);
+    Assert_Stack(CModel2_SCHEMA, temp3, -1, -1, REFLEX_OK);
+    Assert_Stack(CModel3_SCHEMA, temp4, -1, -1, REFLEX_OK);
+    Assert_Stack(CModel3_SCHEMA, temp4, 13, -1, REFLEX_OK);
+    Assert_Stack(CModel3_SCHEMA, temp4, 33, -1, REFLEX_OK);
+    Assert_Stack(CModel3_SCHEMA, temp4, 60, -1, REFLEX_OK);
+    Assert_Stack(CModel4_SCHEMA, temp5, -1, -1, REFLEX_OK);
+    Assert_Stack(CModel4_SCHEMA, temp5, 7, -1, REFLEX_OK);
+    Assert_Stack(CModel4_SCHEMA, temp5, 16, -1, REFLEX_OK);
+    // error in nested complex fields, end callbacks must be called
+    Assert_Stack(CModel3_SCHEMA, temp4, -1, 6, 5);
+    Assert_Stack(CModel3_SCHEMA, temp4, -1, 40, 5);
+    Assert_Stack(CModel4_SCHEMA, temp5, -1, 19, 5);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_STACK_SCAN
+// -------------------------- Test Config -------------------------
+#if REFLEX_SUPPORT_CONFIG && REFLEX_SUPPORT_TYPE_COMPLEX
+#define Assert_Config(SCHEMA, OBJ, BREAK_AT)    memset(recorders, 0, sizeof(recorders)); \
+                                                recorders[0].BreakAt = BREAK_AT; \
+                                                recorders[1].BreakAt = BREAK_AT; \
+                                                recorders[0].ErrorAt = -1; \
+                                                recorders[1].ErrorAt = -1; \
+                                                Reflex_init(&reflex, &SCHEMA); \
+                                                Reflex_setArgs(&reflex, &recorders[0]); \
+                                                assert(Num, Reflex_scan(&reflex, &OBJ), REFLEX_OK); \
+                                                Reflex_setArgs(&reflex, &recorders[1]); \
+                                                Reflex_getConfig(&reflex, &config); \
+                                                memcpy(&copy, &config, sizeof(config)); \
+                                                assert(Num, Reflex_Config_scan(&config, &OBJ), REFLEX_OK); \
+                                                assert(Num, memcmp(&copy, &config, sizeof(config)), 0); \
+                                                assert(Records, &recorders[0], &recorders[1])
+
+Test_Result Test_Config(void) {
+    Reflex reflex = {0};
+    Reflex context;
+    Reflex_Config config;
+    Reflex_Config copy;
+    PrimaryTemp4 temp1 = {0};
+    CModel3 temp2 = {0};
+    CModel4 temp3 = {0};
+
+    Reflex_setCallback(&reflex, Reflex_recordField);
+
+    Assert_Config(PrimaryTemp4_SCHEMA, temp1, -1);
+    Assert_Config(CModel3_SCHEMA, temp2, -1);
+    Assert_Config(CModel3_SCHEMA, temp2, 13);
+    Assert_Config(CModel4_SCHEMA, temp3, -1);
+    Assert_Config(CModel4_SCHEMA, temp3, 7);
+    // context of scan
+    memset(&context, 0xFF, sizeof(context));
+    Reflex_initContext(&context, &config);
+    assert(Ptr, context.Schema, &CModel4_SCHEMA);
+    assert(Ptr, Reflex_getArgs(&context), &recorders[1]);
+    assert(Num, context.FunctionMode, Reflex_FunctionMode_Callback);
+    assert(Num, context.BreakLayer, 0);
+    memset(recorders, 0, sizeof(recorders));
+    recorders[1].BreakAt = -1;
+    recorders[1].ErrorAt = -1;
+    assert(Num, Reflex_scan(&context, &temp3), REFLEX_OK);
+    assert(Num, recorders[1].Len, 34);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_CONFIG
+// -------------------------- Test Batch -------------------------
+#if REFLEX_SUPPORT_BATCH && REFLEX_SUPPORT_TYPE_COMPLEX
+static Reflex_FieldEvent batchEvents[5];
+static uint32_t batchCount;
+
+Reflex_Result Reflex_checkEvents(Reflex* reflex, const Reflex_FieldEvent* events, Reflex_LenType len) {
+    while (len-- > 0) {
+        if (events->PrimaryFmt != &reflex->Schema->PrimaryFmt[events->VarIndex] ||
+            events->Type != *events->PrimaryFmt) {
+            return REFLEX_ERROR;
+        }
+        events++;
+    }
+
+    return REFLEX_OK;
+}
+
+Reflex_Result Reflex_recordFields(Reflex* reflex, const Reflex_FieldEvent* events, Reflex_LenType len) {
+    FieldRecorder* recorder = (FieldRecorder*) reflex->Args;
+    FieldRecord* record;
+
+    batchCount++;
+    while (len-- > 0) {
+        record = &recorder->Records[recorder->Len++];
+        record->Obj = events->Object;
+        record->Type = events->Type;
+        record->VarIndex = events->VarIndex;
+        if (events->VarIndex == recorder->ErrorAt) {
+            return (Reflex_Result) 5;
+        }
+        events++;
+    }
+
+    return REFLEX_OK;
+}
+
+Test_Result Assert_Batch(Reflex* reflex, void* obj, Reflex_LenType errorAt, uint16_t line) {
+    Reflex_TypeParams fmt = {0};
+    FieldRecord* record;
+    uint32_t index;
+    uint32_t expectedBatch;
+    Reflex_Result result;
+
+    memset(recorders, 0, sizeof(recorders));
+    recorders[0].BreakAt = -1;
+    recorders[0].ErrorAt = -1;
+    recorders[1].BreakAt = -1;
+    recorders[1].ErrorAt = errorAt;
+    Reflex_setCallback(reflex, Reflex_recordField);
+    Reflex_setArgs(reflex, &recorders[0]);
+    if (Assert_Num(Reflex_scan(reflex, obj), REFLEX_OK, line)) {
+        return (Test_Result) line << 16;
+    }
+    // keep only fields with flat VarIndex, until field with error
+    for (index = 0; index < recorders[0].Len; index++) {
+        fmt.Type = recorders[0].Records[index].Type;
+        if (fmt.Fields.Primary != Reflex_PrimaryType_Complex) {
+            record = &recorders[1].Records[recorders[1].Len++];
+            record->Obj = recorders[0].Records[index].Obj;
+            record->Type = recorders[0].Records[index].Type;
+            record->VarIndex = recorders[0].Records[index].VarIndex + recorders[0].Records[index].VarOffset;
+            if (record->VarIndex == errorAt) {
+                break;
+            }
+        }
+    }
+    expectedBatch = (recorders[1].Len + ARRAY_LEN(batchEvents) - 1) / ARRAY_LEN(batchEvents);
+    memcpy(&recorders[0], &recorders[1], sizeof(FieldRecorder));
+    recorders[1].Len = 0;
+    batchCount = 0;
+    Reflex_setArgs(reflex, &recorders[1]);
+    result = Reflex_Batch_scanRaw(reflex, obj, batchEvents, ARRAY_LEN(batchEvents), Reflex_recordFields);
+    if (Assert_Num(result, errorAt < 0 ? REFLEX_OK : 5, line) ||
+        Assert_Num(reflex->LayerIndex, 0, line) ||
+        Assert_Num(batchCount, expectedBatch, line)) {
+        return (Test_Result) line << 16;
+    }
+
+    return Assert_Records(&recorders[0], &recorders[1], line);
+}
+
+Test_Result Test_Batch(void) {
+    Reflex reflex = {0};
+    Reflex_FieldEvent events[REFLEX_BATCH_SIZE];
+    PrimaryTemp4 temp1 = {0};
+    CModel3 temp2 = {0};
+    CModel4 temp3 = {0};
+    Model1 model1 = {0};
+    Model2 model2[4] = {0};
+    uint32_t index;
+
+    temp2.V6 = &model1;
+    for (index = 0; index < 4; index++) {
+        temp2.V10[index] = &model2[index];
+    }
+
+    Reflex_init(&reflex, &PrimaryTemp4_SCHEMA);
+    assert(Num, Assert_Batch(&reflex, &temp1, -1, __LINE__), 0);
+    Reflex_init(&reflex, &CModel3_SCHEMA);
+    assert(Num, Assert_Batch(&reflex, &temp2, -1, __LINE__), 0);
+    assert(Num, Assert_Batch(&reflex, &temp2, 22, __LINE__), 0);
+    assert(Ptr, reflex.Schema, &CModel3_SCHEMA);
+    Reflex_init(&reflex, &CModel4_SCHEMA);
+    assert(Num, Assert_Batch(&reflex, &temp3, -1, __LINE__), 0);
+    // primary schema report address of field type
+    Reflex_init(&reflex, &PrimaryTemp4_SCHEMA);
+    assert(Num, Reflex_Batch_scanRaw(&reflex, &temp1, events, ARRAY_LEN(events), Reflex_checkEvents), REFLEX_OK);
+    // invalid buffer of events or callback
+    assert(Num, Reflex_Batch_scanRaw(&reflex, &temp1, events, 0, Reflex_checkEvents), REFLEX_ERROR);
+    assert(Num, Reflex_Batch_scanRaw(&reflex, &temp1, events, -1, Reflex_checkEvents), REFLEX_ERROR);
+    assert(Num, Reflex_Batch_scanRaw(&reflex, &temp1, NULL, ARRAY_LEN(events), Reflex_checkEvents), REFLEX_ERROR);
+    assert(Num, Reflex_Batch_scanRaw(&reflex, &temp1, events, ARRAY_LEN(events), NULL), REFLEX_ERROR);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_BATCH
+// -------------------------- Test Inline -------------------------
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+REFLEX_INLINE_SCAN(Inline_Model1, Model1_SCHEMA, Reflex_recordField)
+REFLEX_INLINE_SCAN(Inline_Model1Offset, Model1_SCHEMA_OFFSET, Reflex_recordField)
+REFLEX_INLINE_SCAN(Inline_PrimaryTemp4, PrimaryTemp4_SCHEMA, Reflex_recordField)
+REFLEX_INLINE_SCAN(Inline_CModel2, CModel2_SCHEMA, Reflex_recordField)
+REFLEX_INLINE_SCAN(Inline_CModel3, CModel3_SCHEMA, Reflex_recordField)
+REFLEX_INLINE_SCAN(Inline_CModel4, CModel4_SCHEMA, Reflex_recordField)
+
+#define Assert_Inline(SCAN, SCHEMA, OBJ, BREAK_AT)  memset(recorders, 0, sizeof(recorders)); \
+                                                    recorders[0].BreakAt = BREAK_AT; \
+                                                    recorders[1].BreakAt = BREAK_AT; \
+                                                    recorders[0].ErrorAt = -1; \
+                                                    recorders[1].ErrorAt = -1; \
+                                                    Reflex_init(&reflex, &SCHEMA); \
+                                                    Reflex_setArgs(&reflex, &recorders[0]); \
+                                                    assert(Num, Reflex_scan(&reflex, &OBJ), REFLEX_OK); \
+                                                    Reflex_setArgs(&reflex, &recorders[1]); \
+                                                    reflex.Schema = NULL; \
+                                                    assert(Num, SCAN(&reflex, &OBJ), REFLEX_OK); \
+                                                    assert(Ptr, reflex.Schema, &SCHEMA); \
+                                                    assert(Records, &recorders[0], &recorders[1])
+
+Test_Result Test_Inline(void) {
+    Reflex reflex = {0};
+    Model1 temp1 = {0};
+    PrimaryTemp4 temp2 = {0};
+    CModel2 temp3 = {0};
+    CModel3 temp4 = {0};
+    CModel4 temp5 = {0};
+    Model1 model1 = {0};
+    Model2 model2[4] = {0};
+    uint32_t index;
+
+    temp4.V6 = &model1;
+    for (index = 0; index < 4; index++) {
+        temp4.V10[index] = &model2[index];
+    }
+    Reflex_setCallback(&reflex, Reflex_recordField);
+
+    Assert_Inline(Inline_Model1, Model1_SCHEMA, temp1, -1);
+    Assert_Inline(Inline_Model1Offset, Model1_SCHEMA_OFFSET, temp1, -1);
+    Assert_Inline(Inline_PrimaryTemp4, PrimaryTemp4_SCHEMA, temp2, -1);
+    Assert_Inline(Inline_CModel2, CModel2_SCHEMA, temp3, -1);
+    Assert_Inline(Inline_CModel3, CModel3_SCHEMA, temp4, -1);
+    Assert_Inline(Inline_CModel3, CModel3_SCHEMA, temp4, 13);
+    Assert_Inline(Inline_CModel3, CModel3_SCHEMA, temp4, 33);
+    Assert_Inline(Inline_CModel3, CModel3_SCHEMA, temp4, 60);
+    Assert_Inline(Inline_CModel4, CModel4_SCHEMA, temp5, -1);
+    Assert_Inline(Inline_CModel4, CModel4_SCHEMA, temp5, 7);
+    Assert_Inline(Inline_CModel4, CModel4_SCHEMA, temp5, 16);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+
+// -------------------------- Test Columns -------------------------
+#if REFLEX_SUPPORT_SCAN_COLUMNS && REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+Reflex_Result Reflex_recordColumn(Reflex* reflex, void* base, Reflex_LenType stride, Reflex_LenType count, const void* fmt) {
+    FieldRecorder* recorder = (FieldRecorder*) reflex->Args;
+    FieldRecord* record = &recorder->Records[recorder->Len++];
+
+    record->Obj = base;
+    record->Type = ((const Reflex_TypeParams*) fmt)->Type;
+    record->VarIndex = Reflex_getVarIndex(reflex);
+    record->VarOffset = stride;
+    record->LayerIndex = count;
+
+    if (Reflex_getVarIndex(reflex) == recorder->ErrorAt) {
+        return (Reflex_Result) 5;
+    }
+
+    return REFLEX_OK;
+}
+/**
+ * @brief Convert row-major records of first object to expected columns,
+ * complex records are markers except complex pointers that hide their fields
+ */
+static void Reflex_expectColumns(const FieldRecorder* rows, FieldRecorder* columns, Reflex_LenType stride, Reflex_LenType count) {
+    const FieldRecord* row = rows->Records;
+    const FieldRecord* end = row + rows->Len;
+    FieldRecord pointer;
+    FieldRecord* column;
+    Reflex_TypeParams fmt;
+
+    columns->Len = 0;
+    while (row < end) {
+        fmt.Type = row->Type;
+        if (fmt.Fields.Primary == Reflex_PrimaryType_Complex &&
+            fmt.Fields.Category != Reflex_Category_Pointer &&
+            fmt.Fields.Category != Reflex_Category_PointerArray) {
+            row++;
+            continue;
+        }
+        pointer = *row;
+        column = &columns->Records[columns->Len];
+        column->Obj = row->Obj;
+        column->Type = row->Type;
+        column->VarIndex = columns->Len++;
+        column->VarOffset = stride;
+        column->LayerIndex = count;
+        if (fmt.Fields.Primary == Reflex_PrimaryType_Complex) {
+            // skip fields behind pointer until end record of it
+            row++;
+            while (row->Obj != pointer.Obj || row->Type != pointer.Type || row->LayerIndex != pointer.LayerIndex) {
+                row++;
+            }
+        }
+        row++;
+    }
+}
+
+Test_Result Test_Columns(void) {
+    Reflex reflex = {0};
+    CModel3 temp3[3] = {0};
+    Model1 model1 = {0};
+    Model2 model2[4] = {0};
+    CModel4 temp4[5] = {0};
+    Test_Result res;
+
+    temp3[0].V6 = &model1;
+    temp3[0].V10[0] = &model2[0];
+    temp3[0].V10[1] = &model2[1];
+    temp3[0].V10[2] = &model2[2];
+    temp3[0].V10[3] = &model2[3];
+
+    memset(recorders, 0, sizeof(recorders));
+    recorders[0].BreakAt = -1;
+    recorders[0].ErrorAt = -1;
+    recorders[1].BreakAt = -1;
+    recorders[1].ErrorAt = -1;
+    Reflex_init(&reflex, &CModel4_SCHEMA);
+
+    // complex arrays and 2D arrays
+    Reflex_setCallback(&reflex, Reflex_recordField);
+    Reflex_setArgs(&reflex, &recorders[0]);
+    assert(Num, Reflex_scan(&reflex, &temp4[0]), REFLEX_OK);
+    Reflex_expectColumns(&recorders[0], &recorders[0], sizeof(CModel4), 5);
+
+    assert(Num, Reflex_compile(&CModel4_SCHEMA, planOps, 256) > 0, 1);
+    Reflex_setArgs(&reflex, &recorders[1]);
+    assert(Num, Reflex_Plan_scanColumns(&reflex, planOps, temp4, 5, sizeof(CModel4), Reflex_recordColumn), REFLEX_OK);
+    if ((res = Assert_Records(&recorders[0], &recorders[1], __LINE__)) != 0) {
+        return res;
+    }
+
+    // pointers, offset and primary schemas
+    memset(recorders, 0, sizeof(recorders));
+    recorders[0].BreakAt = -1;
+    recorders[0].ErrorAt = -1;
+    recorders[1].BreakAt = -1;
+    recorders[1].ErrorAt = -1;
+    Reflex_init(&reflex, &CModel3_SCHEMA);
+    Reflex_setArgs(&reflex, &recorders[0]);
+    assert(Num, Reflex_scan(&reflex, &temp3[0]), REFLEX_OK);
+    Reflex_expectColumns(&recorders[0], &recorders[0], sizeof(CModel3), 3);
+
+    assert(Num, Reflex_compile(&CModel3_SCHEMA, planOps, 256) > 0, 1);
+    Reflex_setArgs(&reflex, &recorders[1]);
+    assert(Num, Reflex_Plan_scanColumns(&reflex, planOps, temp3, 3, 0, Reflex_recordColumn), REFLEX_OK);
+    if ((res = Assert_Records(&recorders[0], &recorders[1], __LINE__)) != 0) {
+        return res;
+    }
+
+    // error stop scan
+    recorders[1].Len = 0;
+    recorders[1].ErrorAt = 4;
+    assert(Num, Reflex_Plan_scanColumns(&reflex, planOps, temp3, 3, sizeof(CModel3), Reflex_recordColumn), 5);
+    assert(Num, recorders[1].Len, 5);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_SCAN_COLUMNS
+// -------------------------- Test Parallel -------------------------
+#if REFLEX_SUPPORT_PARALLEL && REFLEX_SUPPORT_CONFIG && REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_FORMAT_MODE_PARAM
+#define PARALLEL_COUNT          1000
+
+typedef struct {
+    uint8_t     V0;
+    Model2      V1[PARALLEL_COUNT];
+} ParallelModel;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+static const Reflex_TypeParams ParallelModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Complex, PARALLEL_COUNT, 0, &Model2_SCHEMA),
+};
+#endif
+
+typedef struct {
+    Model2*         Base;
+    uint8_t         Visits[PARALLEL_COUNT];
+    Reflex_LenType  ErrorAt[2];
+} ParallelChecker;
+
+static ParallelModel parallelTemp;
+static ParallelChecker parallelChecker;
+
+Reflex_Result Reflex_checkParallel(Reflex* reflex, void* value, const void* fmt) {
+    ParallelChecker* checker = (ParallelChecker*) reflex->Args;
+    Reflex_LenType index = Reflex_getElementIndex(reflex);
+    Model2* obj = &checker->Base[index];
+    void* fields[] = { &obj->V0, &obj->V1, &obj->V2, &obj->V3 };
+
+    if (fields[Reflex_getVarIndex(reflex)] != value) {
+        return 1;
+    }
+#if REFLEX_SUPPORT_MAIN_OBJ
+    if (Reflex_getMainVariable(reflex) != obj) {
+        return 2;
+    }
+#endif
+    if (Reflex_getVarIndex(reflex) == 3) {
+        checker->Visits[index]++;
+        if (index == checker->ErrorAt[0] || index == checker->ErrorAt[1]) {
+            return (Reflex_Result) (100 + index);
+        }
+    }
+
+    return REFLEX_OK;
+}
+
+Reflex_Result Reflex_reduceSum(Reflex_Result acc, Reflex_Result result) {
+    return acc + result;
+}
+
+Test_Result Assert_Visits(ParallelChecker* checker, Reflex_LenType count, uint16_t line) {
+    Reflex_LenType index;
+
+    for (index = 0; index < count; index++) {
+        if (checker->Visits[index] != 1) {
+            PRINTF("Element %d visited %d times, Line: %d\r\n", index, checker->Visits[index], line);
+            return (Test_Result) line << 16 | index;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_Parallel(void) {
+    Reflex reflex = {0};
+    Reflex_Config config;
+    Reflex_ParallelParams params = { NULL, 4, 16 };
+    Test_Result res;
+    uint8_t round;
+
+    Reflex_init(&reflex, &Model2_SCHEMA);
+    Reflex_setCallback(&reflex, Reflex_checkParallel);
+    Reflex_setArgs(&reflex, &parallelChecker);
+    Reflex_getConfig(&reflex, &config);
+
+    // each element scanned once
+    memset(&parallelChecker, 0, sizeof(parallelChecker));
+    parallelChecker.Base = parallelTemp.V1;
+    parallelChecker.ErrorAt[0] = -1;
+    parallelChecker.ErrorAt[1] = -1;
+    assert(Num, Reflex_Parallel_scanArray(&config, parallelTemp.V1, PARALLEL_COUNT, sizeof(Model2), &params), REFLEX_OK);
+    if ((res = Assert_Visits(&parallelChecker, PARALLEL_COUNT, __LINE__)) != 0) {
+        return res;
+    }
+
+    // default params and less elements than workers
+    memset(parallelChecker.Visits, 0, sizeof(parallelChecker.Visits));
+    assert(Num, Reflex_Parallel_scanArrayRaw(&config, parallelTemp.V1, 3, sizeof(Model2), Reflex_checkParallel, NULL), REFLEX_OK);
+    if ((res = Assert_Visits(&parallelChecker, 3, __LINE__)) != 0) {
+        return res;
+    }
+    assert(Num, parallelChecker.Visits[3], 0);
+
+    // first error in index order is result
+    parallelChecker.ErrorAt[0] = 700;
+    parallelChecker.ErrorAt[1] = 300;
+    for (round = 0; round < 8; round++) {
+        assert(Num, Reflex_Parallel_scanArray(&config, parallelTemp.V1, PARALLEL_COUNT, sizeof(Model2), &params), 400);
+    }
+
+    // reduce results of all chunks, each chunk stop on it's first error
+    params.Reduce = Reflex_reduceSum;
+    assert(Num, Reflex_Parallel_scanArray(&config, parallelTemp.V1, PARALLEL_COUNT, sizeof(Model2), &params), 400 + 800);
+    params.Reduce = NULL;
+    parallelChecker.ErrorAt[0] = -1;
+    parallelChecker.ErrorAt[1] = -1;
+
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // complex array field
+    memset(parallelChecker.Visits, 0, sizeof(parallelChecker.Visits));
+    assert(Num, Reflex_Parallel_scanField(&config, parallelTemp.V1, &ParallelModel_FMT[1], sizeof(Model2), &params), REFLEX_OK);
+    if ((res = Assert_Visits(&parallelChecker, PARALLEL_COUNT, __LINE__)) != 0) {
+        return res;
+    }
+    assert(Num, Reflex_Parallel_scanField(&config, &parallelTemp.V0, &ParallelModel_FMT[0], sizeof(Model2), &params), REFLEX_ERROR);
+#endif
+
+    return 0;
+}
+#if REFLEX_SUPPORT_PACKED
+#define PARALLEL_COMPLEX_COUNT  200
+
+static uint8_t encodeSequential[PARALLEL_COUNT * sizeof(Model2)];
+static uint8_t encodeParallel[PARALLEL_COUNT * sizeof(Model2)];
+static Reflex_PtrType encodeOffsets[PARALLEL_COUNT + 1];
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+static CModel1 encodeComplex[PARALLEL_COMPLEX_COUNT];
+#endif
+
+Reflex_LenType Reflex_sizeName(Reflex* reflex, void* obj) {
+    return (Reflex_LenType) (sizeof(int32_t) + strlen(((Model2*) obj)->V1));
+}
+
+Reflex_LenType Reflex_encodeName(Reflex* reflex, void* obj, uint8_t* buf) {
+    Model2* model = (Model2*) obj;
+    Reflex_LenType len = (Reflex_LenType) strlen(model->V1);
+
+    memcpy(buf, &model->V0, sizeof(int32_t));
+    memcpy(buf + sizeof(int32_t), model->V1, len);
+
+    return (Reflex_LenType) sizeof(int32_t) + len;
+}
+
+Test_Result Assert_Encode(Reflex_PtrType len, uint16_t line) {
+    if (encodeOffsets[PARALLEL_COUNT] != len) {
+        PRINTF("Encoded size %u, expected %u, Line: %d\r\n", (unsigned) encodeOffsets[PARALLEL_COUNT], (unsigned) len, line);
+        return (Test_Result) line << 16;
+    }
+    if (memcmp(encodeSequential, encodeParallel, (size_t) len) != 0) {
+        PRINTF("Encoded bytes not match, Line: %d\r\n", line);
+        return (Test_Result) line << 16 | 1;
+    }
+
+    return 0;
+}
+
+Test_Result Test_ParallelEncode(void) {
+    Reflex reflex = {0};
+    Reflex_Config config;
+    Reflex_ParallelParams params = { NULL, 4, 16 };
+    Reflex_Encoder encoder = { Reflex_sizeName, Reflex_encodeName };
+    Reflex_PtrType len;
+    Reflex_LenType index;
+    Test_Result res;
+
+    Reflex_init(&reflex, &Model2_SCHEMA);
+    Reflex_getConfig(&reflex, &config);
+    for (index = 0; index < PARALLEL_COUNT; index++) {
+        Model2* obj = &parallelTemp.V1[index];
+        memset(obj, 0, sizeof(Model2));
+        obj->V0 = index * 7;
+        memset(obj->V1, 'A' + index % 26, index % 31);
+        obj->V2[index % 8] = (uint8_t) index;
+        obj->V3 = index * 0.5f;
+    }
+
+    // fixed size schema, sequential and parallel output are same
+    assert(Num, Reflex_Packed_size(&Model2_SCHEMA, &parallelTemp.V1[0]), Reflex_size(&Model2_SCHEMA, Reflex_SizeType_Packed));
+    for (index = 0, len = 0; index < PARALLEL_COUNT; index++) {
+        len += Reflex_Packed_encode(&Model2_SCHEMA, &parallelTemp.V1[index], encodeSequential + len);
+    }
+    memset(encodeParallel, 0, sizeof(encodeParallel));
+    assert(Num, Reflex_Parallel_encode(&config, parallelTemp.V1, PARALLEL_COUNT, sizeof(Model2), NULL, encodeParallel, sizeof(encodeParallel), encodeOffsets, &params), REFLEX_OK);
+    if ((res = Assert_Encode(len, __LINE__)) != 0) {
+        return res;
+    }
+    assert(Num, encodeOffsets[PARALLEL_COUNT / 2], (PARALLEL_COUNT / 2) * Reflex_size(&Model2_SCHEMA, Reflex_SizeType_Packed));
+
+    // output buffer is small
+    assert(Num, Reflex_Parallel_encode(&config, parallelTemp.V1, PARALLEL_COUNT, sizeof(Model2), NULL, encodeParallel, len - 1, encodeOffsets, NULL), REFLEX_ERROR);
+
+    // variable size with custom encoder
+    for (index = 0, len = 0; index < PARALLEL_COUNT; index++) {
+        len += Reflex_encodeName(&reflex, &parallelTemp.V1[index], encodeSequential + len);
+    }
+    memset(encodeParallel, 0, sizeof(encodeParallel));
+    assert(Num, Reflex_Parallel_encode(&config, parallelTemp.V1, PARALLEL_COUNT, sizeof(Model2), &encoder, encodeParallel, sizeof(encodeParallel), encodeOffsets, &params), REFLEX_OK);
+    if ((res = Assert_Encode(len, __LINE__)) != 0) {
+        return res;
+    }
+
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // complex schema use sizing phase
+    for (index = 0; index < PARALLEL_COMPLEX_COUNT; index++) {
+        encodeComplex[index].V0.V2 = index;
+        encodeComplex[index].V1 = parallelTemp.V1[index];
+    }
+    assert(Num, Reflex_Packed_size(&CModel1_SCHEMA, &encodeComplex[0]), Reflex_size(&Model1_SCHEMA, Reflex_SizeType_Packed) + Reflex_size(&Model2_SCHEMA, Reflex_SizeType_Packed));
+    for (index = 0, len = 0; index < PARALLEL_COMPLEX_COUNT; index++) {
+        len += Reflex_Packed_encode(&CModel1_SCHEMA, &encodeComplex[index], encodeSequential + len);
+    }
+    Reflex_init(&reflex, &CModel1_SCHEMA);
+    Reflex_getConfig(&reflex, &config);
+    memset(encodeParallel, 0, sizeof(encodeParallel));
+    assert(Num, Reflex_Parallel_encode(&config, encodeComplex, PARALLEL_COMPLEX_COUNT, sizeof(CModel1), NULL, encodeParallel, sizeof(encodeParallel), encodeOffsets, &params), REFLEX_OK);
+    assert(Num, encodeOffsets[PARALLEL_COMPLEX_COUNT], len);
+    assert(Num, memcmp(encodeSequential, encodeParallel, (size_t) len), 0);
+    // stride of complex schema is not known
+    assert(Num, Reflex_Parallel_encode(&config, encodeComplex, PARALLEL_COMPLEX_COUNT, 0, NULL, encodeParallel, sizeof(encodeParallel), encodeOffsets, &params), REFLEX_ERROR);
+#endif
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_PACKED
+#endif // REFLEX_SUPPORT_PARALLEL
+// -------------------------- Test Packer -------------------------
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_PACKED && REFLEX_FORMAT_MODE_PARAM && REFLEX_SUPPORT_TYPE_64BIT && REFLEX_SUPPORT_TYPE_DOUBLE
+#define PACKER_COUNT            37
+
+typedef struct {
+    uint8_t     V0;
+    uint32_t    V1;
+    int16_t     V2[3];
+    double      V3;
+    char        V4[5];
+    uint16_t    V5[20];
+    uint32_t    V6[9];
+    uint64_t    V7[5];
+    float       V8;
+} PackModel;
+static const Reflex_TypeParams PackModel_FMT[] CONST_VAR_ATTR = {
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt8),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_UInt32),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Int16, 3, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Double),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_Char, 5, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt16, 20, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt32, 9, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Array_UInt64, 5, 0),
+    REFLEX_TYPE_PARAMS(Reflex_Type_Primary_Float),
+};
+static const Reflex_Schema PackModel_SCHEMA CONST_VAR_ATTR = REFLEX_SCHEMA(Reflex_FormatMode_Param, PackModel_FMT);
+
+static PackModel packTemp[PACKER_COUNT];
+static Model2 packTemp2[20];
+static uint8_t packExpected[PACKER_COUNT * sizeof(PackModel)];
+static uint8_t packRecords[PACKER_COUNT * sizeof(PackModel)];
+
+Test_Result Assert_Packed(const Reflex_Schema* schema, const void* base, Reflex_LenType count, Reflex_LenType stride, const uint8_t* records, uint16_t line) {
+    Reflex_LenType index;
+    Reflex_LenType len;
+    const uint8_t* obj = (const uint8_t*) base;
+
+    for (index = 0; index < count; index++) {
+        len = Reflex_Packed_encode(schema, (void*) obj, packExpected);
+        if (memcmp(packExpected, records, len) != 0) {
+            PRINTF("Record %d not match, Line: %d\r\n", index, line);
+            return (Test_Result) line << 16 | index;
+        }
+        records += len;
+        obj += stride;
+    }
+
+    return 0;
+}
+
+Test_Result Test_Packer(void) {
+    Reflex_PackRun runs[9];
+    Reflex_PackRun swapRuns[9];
+    Reflex_Packer packer;
+    Reflex_Packer swapPacker;
+    Reflex_PtrType len;
+    Reflex_LenType index;
+    Reflex_LenType item;
+    Reflex_LenType byte;
+    const Reflex_PackRun* run;
+    uint8_t* records;
+    uint8_t* swapped;
+    Test_Result res;
+
+    for (index = 0; index < (Reflex_LenType) sizeof(packTemp); index++) {
+        ((uint8_t*) packTemp)[index] = (uint8_t) (index * 31 + 7);
+    }
+    memcpy(packTemp2, packTemp, sizeof(packTemp2));
+
+    // padding free records same as packed encoding
+    assert(Num, Reflex_Packer_bind(&packer, &PackModel_SCHEMA, runs, 9, 0), REFLEX_OK);
+    assert(Num, Reflex_Packer_recordSize(&packer), Reflex_size(&PackModel_SCHEMA, Reflex_SizeType_Packed));
+    assert(Num, packer.Len < 9, 1);
+    len = Reflex_Packer_encode(&packer, packTemp, PACKER_COUNT, 0, packRecords);
+    assert(Num, len, PACKER_COUNT * Reflex_Packer_recordSize(&packer));
+    if ((res = Assert_Packed(&PackModel_SCHEMA, packTemp, PACKER_COUNT, sizeof(PackModel), packRecords, __LINE__)) != 0) {
+        return res;
+    }
+
+    // byte swap reverse bytes of each item
+    assert(Num, Reflex_Packer_bind(&swapPacker, &PackModel_SCHEMA, swapRuns, 9, 1), REFLEX_OK);
+    assert(Num, Reflex_Packer_recordSize(&swapPacker), Reflex_Packer_recordSize(&packer));
+    assert(Num, Reflex_Packer_encode(&swapPacker, packTemp, PACKER_COUNT, sizeof(PackModel), packExpected), len);
+    for (index = 0; index < PACKER_COUNT; index++) {
+        records = packRecords + index * swapPacker.RecordSize;
+        swapped = packExpected + index * swapPacker.RecordSize;
+        for (run = swapPacker.Runs; run < swapPacker.Runs + swapPacker.Len; run++) {
+            for (item = run->Dst; item < run->Dst + run->Len; item += run->ItemSize) {
+                for (byte = 0; byte < run->ItemSize; byte++) {
+                    if (swapped[item + byte] != records[item + run->ItemSize - 1 - byte]) {
+                        PRINTF("Swap not match, Record: %d, Offset: %d\r\n", index, item + byte);
+                        return (Test_Result) __LINE__ << 16 | index;
+                    }
+                }
+            }
+        }
+    }
+
+    // object without padding is one run
+    assert(Num, Reflex_Packer_bind(&packer, &Model2_SCHEMA, runs, 9, 0), REFLEX_OK);
+    assert(Num, packer.Len, 1);
+    assert(Num, Reflex_Packer_encode(&packer, packTemp2, 20, 0, packRecords), 20 * sizeof(Model2));
+    if ((res = Assert_Packed(&Model2_SCHEMA, packTemp2, 20, sizeof(Model2), packRecords, __LINE__)) != 0) {
+        return res;
+    }
+#if REFLEX_FORMAT_MODE_OFFSET
+    assert(Num, Reflex_Packer_bind(&packer, &Model2_SCHEMA_OFFSET, runs, 9, 1), REFLEX_OK);
+    assert(Num, Reflex_Packer_recordSize(&packer), sizeof(Model2));
+#endif
+
+    // only flat schemas
+    assert(Num, Reflex_Packer_bind(&packer, &Model1_SCHEMA, runs, 9, 0), REFLEX_ERROR);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    assert(Num, Reflex_Packer_bind(&packer, &CModel1_SCHEMA, runs, 9, 0), REFLEX_ERROR);
+#endif
+    assert(Num, Reflex_Packer_bind(&packer, &PackModel_SCHEMA, runs, 2, 0), REFLEX_ERROR);
+
+    return 0;
+}
+#endif // REFLEX_SUPPORT_PACKER
+// -------------------------- Assert Functions -------------------------
+
+void Result_print(Test_Result result) {
+    PRINTF("Line: %u, Index: %u\r\n", result >> 16, result & 0xFFFF);
+}
+
+Test_Result Assert_Str(const char* str1, const char* str2, uint16_t line) {
+    if (strcmp(str1, str2) != 0) {
+        PRINTF("Assert Str: expected \"%s\", found \"%s\", Line: %d\r\n", str2, str1, line);
+        return (Test_Result) line << 16;
+    }
+    else {
+        return 0;
+    }
+}
 Test_Result Assert_Num(int32_t val1, int32_t val2, uint16_t line) {
     if (val1 != val2) {
         PRINTF("Assert Num: expected %d, found %d, Line: %d\r\n", val2, val1, line);
@@ -1,10 +1,16 @@
 #include "Reflex.h"
+#include <stddef.h>
+#include <string.h>
+#if REFLEX_SUPPORT_BYTE_ORDER && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    #include "ReflexSimd.h"
+#endif
 
 /* ------------------------------------ Private typedef ----------------------------------- */
 typedef void* (*Reflex_AlignAddressFn)(void* pValue, const Reflex_TypeParams* fmt);
 typedef void* (*Reflex_MoveAddressFn)(void* pValue, const Reflex_TypeParams* fmt);
 typedef Reflex_LenType (*Reflex_ItemSizeFn)(const Reflex_TypeParams* fmt);
 typedef Reflex_Result (*Reflex_ScanFn)(Reflex* reflex, void* obj, Reflex_OnFieldFn onField);
+typedef Reflex_Result (*Reflex_ScanElementFn)(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride);
 typedef Reflex_GetResult (*Reflex_GetFieldFn)(Reflex* reflex, void* obj, const void* filedFmt, Reflex_Field* field);
 typedef Reflex_Result (*Reflex_ComplexScanFn)(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField);
 typedef Reflex_GetResult (*Reflex_ComplexGetFieldFn)(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* filedFmt, Reflex_Field* field);
@@ -17,6 +23,94 @@ typedef struct {
     Reflex_MoveAddressFn     moveAddress;
     Reflex_ItemSizeFn        itemSize;
 } Reflex_Type_Helper;
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This struct hold state of plan compiler, it's mirror address state of scan functions
+ */
+typedef struct {
+    Reflex_PlanOp*           Ops;
+    uint8_t*                 PObj;
+    Reflex_LenType           Size;
+    Reflex_LenType           Len;
+    Reflex_LenType           AlignSize;
+    Reflex_LenType           Depth;
+    Reflex_LenType           Vars;              /**< number of emitted fields, it's flat VarIndex of next field */
+    Reflex_LenType           Bytes;             /**< bytes of emitted fields in memory of current object */
+    uint8_t                  Error;
+} Reflex_PlanCompiler;
+/**
+ * @brief This struct hold state of a complex field while running a plan
+ */
+typedef struct {
+    const Reflex_PlanOp*     Begin;
+    const Reflex_Schema*     Schema;
+    uint8_t*                 Parent;
+    uint8_t*                 Field;
+    Reflex_LenType           Index;
+    Reflex_LenType           Column;
+    Reflex_LenType           Row;
+} Reflex_PlanFrame;
+#endif // REFLEX_SUPPORT_PLAN
+#if REFLEX_SUPPORT_INDEX
+/**
+ * @brief This struct hold a complex field that builder is inside of it
+ */
+typedef struct {
+    const void*              Fmt;
+    void*                    Obj;
+    uint8_t*                 Base;
+    uint8_t*                 Main;
+    Reflex_LenType           BaseEntry;
+    Reflex_LenType           Entry;             /**< entry of complex field */
+    Reflex_LenType           Element;           /**< index of current element, -1 before first element */
+} Reflex_IndexFrame;
+/**
+ * @brief This struct hold state of index builder
+ */
+typedef struct {
+    Reflex_Index*            Index;
+    uint8_t*                 Base;
+    uint8_t*                 Main;
+    Reflex_LenType           BaseEntry;
+    Reflex_LenType           Depth;
+    uint8_t                  Error;
+    Reflex_IndexFrame        Frames[REFLEX_MAX_DEPTH];
+} Reflex_IndexBuilder;
+#endif // REFLEX_SUPPORT_INDEX
+#if REFLEX_SUPPORT_HASH
+/**
+ * @brief This struct hold state of streaming XXH64 hash,
+ * continuous bytes are kept in run and hashed in bulk
+ */
+typedef struct {
+    uint64_t                 V[4];
+    uint64_t                 Total;
+    const uint8_t*           Run;               /**< start of pending run */
+    const uint8_t*           RunEnd;            /**< end of pending run */
+    uint8_t                  Buffer[32];
+    uint32_t                 Len;               /**< number of bytes in buffer */
+} Reflex_HashState;
+#endif // REFLEX_SUPPORT_HASH
+// packed encoding and binary codec share same encoder
+#define __REFLEX_SUPPORT_ENCODER    ((REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN) || \
+                                     (REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER))
+#if __REFLEX_SUPPORT_ENCODER
+/**
+ * @brief This struct hold state of binary codec and packed encoding,
+ * continuous bytes of object are kept in run and copied in bulk
+ */
+typedef struct {
+    uint8_t*                 Buf;               /**< NULL means only count bytes */
+    Reflex_PtrType           Len;               /**< number of used bytes of buffer */
+    Reflex_PtrType           Cap;
+    uint8_t*                 Run;               /**< start of pending run in object */
+    uint8_t*                 RunEnd;            /**< end of pending run in object */
+    uint8_t                  ItemSize;          /**< size of items of pending run, 1 when items are not swapped */
+    uint8_t                  Swap;              /**< reverse bytes of items, without buffer object is swapped in place */
+    uint8_t                  Decode;
+    uint8_t                  Error;
+} Reflex_BinaryState;
+#endif // __REFLEX_SUPPORT_ENCODER
 /* ------------------------------------ Private Functions -------------------------------- */
 // Helper onField functions for scan
 #if REFLEX_SUPPORT_CALLBACK
@@ -33,6 +127,32 @@ typedef struct {
     #define               Reflex_alignAddress(pValue, objSize)        pValue
 #else
     static void*          Reflex_alignAddress(void* pValue, Reflex_LenType objSize);
+#endif
+// moveAddress of array fields return it when size of field not fit in address space
+#define REFLEX_ADDRESS_OVERFLOW                 ((void*) ~(Reflex_PtrType) 0)
+#if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
+    static Reflex_Result  Reflex_mulSize(Reflex_PtrType size, Reflex_LenType len, Reflex_PtrType* result);
+#endif
+#if REFLEX_SUPPORT_SIZE_FN
+    static Reflex_LenType Reflex_toLen(const void* pobj);
+    // move pobj to next address, return -1 if size of field overflowed or address wrapped around
+    #define __moveSize(NEXT)                    next = (uint8_t*) (NEXT); \
+                                                if ((void*) next == REFLEX_ADDRESS_OVERFLOW || (Reflex_PtrType) next < (Reflex_PtrType) pobj) { \
+                                                    return -1; \
+                                                } \
+                                                pobj = next
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // size of complex fields is not known without schema of field, return -1
+    #define __checkSizeComplex(FMT)             if ((FMT)->Fields.Primary == Reflex_PrimaryType_Complex) { \
+                                                    return -1; \
+                                                }
+#else
+    #define __checkSizeComplex(FMT)
+#endif
+#endif
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+    static Reflex_LenType Reflex_Packed_walk(const Reflex_Schema* schema, void* obj, void* buf);
+    static Reflex_Result  Reflex_Packed_field(Reflex* reflex, void* value, const void* fmt);
 #endif
     static Reflex_LenType Reflex_Primary_itemSize(const Reflex_TypeParams* fmt);
     static void*          Reflex_Primary_alignAddress(void* pValue, const Reflex_TypeParams* fmt);
@@ -57,6 +177,16 @@ typedef struct {
     #define               Reflex_Array2D_alignAddress       Reflex_Primary_alignAddress
     static void*          Reflex_Array2D_moveAddress(void* pValue, const Reflex_TypeParams* fmt);
 #endif
+// Scan functions of schemas, stride of element is known for elements of complex arrays with fixed layout
+#if REFLEX_FORMAT_MODE_PARAM
+    static Reflex_Result Reflex_Param_scanElement(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride);
+#endif
+#if REFLEX_FORMAT_MODE_PRIMARY
+    static Reflex_Result Reflex_Primary_scanElement(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride);
+#endif
+#if REFLEX_FORMAT_MODE_OFFSET
+    static Reflex_Result Reflex_Offset_scanElement(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride);
+#endif
 // Helper functions for scan over complex object
 #if REFLEX_SUPPORT_TYPE_COMPLEX
     // Helper function for call scan functions for 3 modes
@@ -67,6 +197,7 @@ typedef struct {
     static Reflex_Result Reflex_Complex_End_Driver(Reflex* reflex, void* obj, const void* fmt);
     static Reflex_Result Reflex_Complex_End_Compact(Reflex* reflex, void* obj, const void* fmt);
     static Reflex_Result Reflex_Complex_Primary_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt ,Reflex_OnFieldFn onField);
+    static Reflex_Result Reflex_Complex_Element_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField, Reflex_LenType stride);
 #if REFLEX_SUPPORT_TYPE_POINTER
     static Reflex_Result Reflex_Complex_Pointer_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField);
 #endif
@@ -94,26 +225,130 @@ typedef struct {
     static Reflex_GetResult Reflex_Complex_Array2D_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field);
 #endif
 #endif // REFLEX_SUPPORT_SCAN_FIELD
+#if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
+    static Reflex_LenType Reflex_Complex_stride(Reflex* reflex, void* obj, Reflex_LenType alignSize);
+#endif
+#if REFLEX_SUPPORT_SCAN_FIELD
+    static void Reflex_Complex_skip(Reflex* reflex, void* obj, Reflex_LenType stride, Reflex_LenType count);
+    static Reflex_LenType Reflex_Complex_alignSize(const Reflex_Schema* schema);
+#endif
+#if REFLEX_SUPPORT_PLAN || REFLEX_SUPPORT_CURSOR || REFLEX_SUPPORT_INDEX
+    static Reflex_LenType Reflex_Complex_elements(const Reflex_TypeParams* fmt);
+#endif
+#if REFLEX_PREFETCH_DISTANCE > 0 && (defined(__GNUC__) || defined(__clang__)) && (REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY)
+    static void Reflex_Complex_prefetch(void* const* items, Reflex_LenType index, Reflex_LenType len);
+    // prefetch objects of pointer complex fields ahead of scan
+    #define __prefetchElements(ITEMS, INDEX, LEN)       Reflex_Complex_prefetch((void* const*) (ITEMS), INDEX, LEN)
+#else
+    #define __prefetchElements(ITEMS, INDEX, LEN)
+#endif
 #endif // REFLEX_SUPPORT_TYPE_COMPLEX
-/* ---------------------------------------- Private Variables ------------------------------------- */
-// Store sizeof all primary types for accessing faster
-static const uint8_t PRIMARY_TYPE_SIZE[] = {
-    sizeof(char),
-    sizeof(uint8_t),
-    sizeof(int8_t),
-    sizeof(uint16_t),
-    sizeof(int16_t),
-    sizeof(uint32_t),
-    sizeof(int32_t),
-#if REFLEX_SUPPORT_TYPE_64BIT
-    sizeof(uint64_t),
-    sizeof(int64_t),
+// Helper functions for compile and run plan
+#if REFLEX_SUPPORT_PLAN
+    static Reflex_LenType Reflex_Plan_emit(Reflex_PlanCompiler* compiler, Reflex_PlanCode code, const void* fmt, const Reflex_TypeParams* params, Reflex_LenType offset);
+    static Reflex_LenType Reflex_Plan_compileSchema(Reflex_PlanCompiler* compiler, const Reflex_Schema* schema, uint8_t* obj);
+    static Reflex_LenType Reflex_Plan_bytes(const Reflex_Type_Helper* helper, const Reflex_TypeParams* fmt, uint8_t* pobj);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static void           Reflex_Plan_compileComplex(Reflex_PlanCompiler* compiler, const Reflex_TypeParams* fmt, uint8_t* obj, uint8_t* base);
+    static uint8_t*       Reflex_Plan_element(const Reflex_PlanFrame* frame, uint8_t* pobj, Reflex_LenType stride);
+    static uint8_t        Reflex_Plan_nextElement(Reflex* reflex, Reflex_PlanFrame* frame, Reflex_Result result);
+    static uint8_t*       Reflex_Plan_leave(const Reflex_PlanFrame* frame, uint8_t* pobj);
 #endif
-    sizeof(float),
-#if REFLEX_SUPPORT_TYPE_DOUBLE
-    sizeof(double),
+    static Reflex_OnFieldFn Reflex_Plan_resolve(const Reflex* reflex, const Reflex_PlanOp* op);
+    static Reflex_Result  Reflex_Plan_skip(Reflex* reflex, void* value, const void* fmt);
+#if REFLEX_SUPPORT_SCAN_ARRAY || REFLEX_SUPPORT_SCAN_COLUMNS
+    static Reflex_LenType Reflex_Plan_size(const Reflex_PlanOp* plan);
 #endif
-};
+#if REFLEX_SUPPORT_SCAN_MASKED
+    static Reflex_LenType Reflex_Mask_next(const uint32_t* mask, Reflex_LenType var, Reflex_LenType end);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static const Reflex_PlanOp* Reflex_Plan_tail(const Reflex_PlanOp* plan, const Reflex_PlanFrame* frame);
+#endif
+#endif
+#endif // REFLEX_SUPPORT_PLAN
+// Helper functions for hash
+#if REFLEX_SUPPORT_HASH
+    static void           Reflex_Hash_init(Reflex_HashState* state, uint64_t seed);
+    static void           Reflex_Hash_update(Reflex_HashState* state, const uint8_t* data, Reflex_PtrType len);
+    static uint64_t       Reflex_Hash_digest(Reflex_HashState* state);
+    static uint64_t       Reflex_Hash_read64(const uint8_t* data);
+    static uint32_t       Reflex_Hash_read32(const uint8_t* data);
+#if REFLEX_SUPPORT_PLAN
+    static void           Reflex_Hash_run(Reflex_HashState* state, const uint8_t* data, Reflex_LenType len);
+    static void           Reflex_Hash_flush(Reflex_HashState* state);
+    static void           Reflex_Hash_marker(Reflex_HashState* state, uint8_t marker);
+    static void           Reflex_Hash_items(Reflex_HashState* state, const uint8_t* data, Reflex_LenType itemSize, Reflex_LenType len);
+    static void           Reflex_Hash_field(Reflex_HashState* state, const Reflex_TypeParams* fmt, const uint8_t* field, Reflex_LenType bytes);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static uint8_t        Reflex_Hash_element(Reflex_HashState* state, const Reflex_PlanFrame* frame, const uint8_t* element);
+#endif
+#endif
+#endif // REFLEX_SUPPORT_HASH
+// Helper functions for compare
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN
+    static uint8_t        Reflex_Compare_field(const Reflex_TypeParams* fmt, const uint8_t* a, const uint8_t* b, Reflex_LenType bytes);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static uint8_t        Reflex_Compare_element(const Reflex_PlanFrame* frame, const uint8_t* a, const uint8_t* b);
+#endif
+#endif // REFLEX_SUPPORT_COMPARE
+// Helper functions for encoder of binary codec and packed encoding
+#if __REFLEX_SUPPORT_ENCODER
+    static void           Reflex_Binary_copy(Reflex_BinaryState* state, uint8_t* obj, Reflex_PtrType len, Reflex_LenType itemSize);
+    static void           Reflex_Binary_run(Reflex_BinaryState* state, uint8_t* obj, Reflex_PtrType len, Reflex_LenType itemSize);
+    static void           Reflex_Binary_flush(Reflex_BinaryState* state);
+    static Reflex_LenType Reflex_Binary_end(Reflex_BinaryState* state);
+#endif
+// Helper functions for binary codec
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    static Reflex_LenType Reflex_Binary_walk(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, Reflex_BinaryState* state);
+    static void           Reflex_Binary_field(Reflex_BinaryState* state, const Reflex_TypeParams* fmt, uint8_t* field, Reflex_LenType bytes);
+#if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    static uint8_t        Reflex_Binary_marker(Reflex_BinaryState* state, void** pointer);
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static uint8_t        Reflex_Binary_element(Reflex_BinaryState* state, const Reflex_PlanFrame* frame);
+#endif
+#if REFLEX_SUPPORT_BYTE_ORDER
+    static void           Reflex_ByteOrder_swap(uint8_t* dst, const uint8_t* src, Reflex_LenType itemSize, Reflex_LenType len);
+    // items must be swapped for byte order
+    #define __swapOrder(ORDER)                      ((ORDER) == Reflex_ByteOrder_Network && !REFLEX_BIG_ENDIAN)
+#endif
+#endif // REFLEX_SUPPORT_BINARY
+// Helper functions for view
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    static uint8_t              Reflex_View_step(Reflex_View* view);
+    static uint8_t              Reflex_View_skip(Reflex_View* view, const Reflex_PlanOp* op);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static uint8_t              Reflex_View_element(Reflex_View* view, const Reflex_PlanOp* begin);
+#endif
+    static const Reflex_PlanOp* Reflex_View_find(const Reflex_ViewRef* ref, const void* fmt, Reflex_LenType* varIndex);
+    static const void*          Reflex_View_typed(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index, Reflex_LenType itemSize);
+#endif // REFLEX_SUPPORT_VIEW
+// Helper functions for build and lookup index
+#if REFLEX_SUPPORT_INDEX
+    static Reflex_LenType Reflex_Index_count(const Reflex_Schema* schema, Reflex_LenType depth);
+    static Reflex_LenType Reflex_Index_hash(const void* fmt, Reflex_LenType size);
+    static Reflex_LenType Reflex_Index_find(const Reflex_Index* index, const void* fmt);
+    static Reflex_LenType Reflex_Index_add(Reflex_IndexBuilder* builder, Reflex* reflex, void* obj, void* main, const void* fmt, uint8_t complex);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static void           Reflex_Index_element(Reflex_IndexBuilder* builder, Reflex* reflex, const void* fmt);
+#endif
+    static Reflex_Result  Reflex_Index_onField(Reflex* reflex, void* obj, const void* fmt);
+    static uint8_t*       Reflex_Index_base(const Reflex_Index* index, Reflex_LenType entry, void* obj);
+    static void           Reflex_Index_fill(const Reflex_Index* index, const Reflex_IndexEntry* entry, void* obj, Reflex_Field* field);
+#endif
+// Helper functions for cursor
+#if REFLEX_SUPPORT_CURSOR
+    static void           Reflex_Cursor_fill(Reflex* reflex, Reflex_Field* field, void* obj, const void* fmt);
+    static void           Reflex_Cursor_enter(Reflex* reflex, Reflex_CursorLayer* layer, const Reflex_Schema* schema, uint8_t* obj);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    static uint8_t*       Reflex_Cursor_nextElement(Reflex* reflex, Reflex_CursorLayer* layer);
+    static Reflex_CursorEvent Reflex_Cursor_leave(Reflex_Cursor* cursor, Reflex_Field* field);
+#endif
+#endif
+/* ---------------------------------------- Private Variables ------------------------------------- */
+// Store sizeof all primary types for accessing faster
+static const uint8_t PRIMARY_TYPE_SIZE[] = REFLEX_PRIMARY_TYPE_SIZES;
 // Array of all possible FunctionMode
 static const Reflex_OnFieldFn REFLEX_ON_FIELD_FNS[3] = {
 #if REFLEX_SUPPORT_CALLBACK
@@ -138,6 +373,18 @@ static const Reflex_ScanFn REFLEX_SCAN[] = {
     Reflex_Offset_scanRaw,
 #endif
 };
+// Array of scan functions of elements, same order as REFLEX_SCAN
+static const Reflex_ScanElementFn REFLEX_SCAN_ELEMENT[] = {
+#if REFLEX_FORMAT_MODE_PARAM
+    Reflex_Param_scanElement,
+#endif
+#if REFLEX_FORMAT_MODE_PRIMARY
+    Reflex_Primary_scanElement,
+#endif
+#if REFLEX_FORMAT_MODE_OFFSET
+    Reflex_Offset_scanElement,
+#endif
+};
 // Array of all getField function 
 #if REFLEX_SUPPORT_SCAN_FIELD
 static const Reflex_GetFieldFn REFLEX_GET_FIELD[] = {
@@ -276,6 +523,21 @@ static const Reflex_ComplexGetFieldFn REFLEX_COMPLEX_GET_FIELD[] = {
     #define __endCheckComplexType(fmt, helper)      tmpSize = (helper)->itemSize(fmt); \
                                                     __updateBiggestField(tmpSize); \
                                                 }
+    // layout of elements with known stride is not computed
+    #define __endCheckComplexTypeElement(fmt, helper, stride)   if (stride == 0) { \
+                                                                    tmpSize = (helper)->itemSize(fmt); \
+                                                                    __updateBiggestField(tmpSize); \
+                                                                } \
+                                                            }
+    #define __updateBiggestFieldElement(SIZE, stride)   if (stride == 0) { \
+                                                            __updateBiggestField(SIZE); \
+                                                        }
+    #define __alignElement(obj, stride)         if (stride == 0) { \
+                                                    __alignObject(); \
+                                                } \
+                                                else { \
+                                                    reflex->PObj = (uint8_t*) (obj) + stride; \
+                                                }
 
     #define __initPObj(reflex, pobj)            reflex->PObj = pobj
 
@@ -295,6 +557,9 @@ static const Reflex_ComplexGetFieldFn REFLEX_COMPLEX_GET_FIELD[] = {
     #define __alignObject()
     #define __startCheckComplexType(CB, ...)
     #define __endCheckComplexType(fmt, helper)
+    #define __endCheckComplexTypeElement(fmt, helper, stride)
+    #define __updateBiggestFieldElement(SIZE, stride)
+    #define __alignElement(obj, stride)         (void) stride
     #define __initPObj(reflex, pobj)
     #define __initComplexParams(reflex, obj)
 #endif
@@ -341,6 +606,81 @@ static const Reflex_ComplexGetFieldFn REFLEX_COMPLEX_GET_FIELD[] = {
     #define __initMainObj(reflex, obj)
 #endif
 
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // elements after first element are aligned to their biggest field, so layout of them is fixed when AlignSize not changed
+    #define __nextElement(reflex, obj, first, stride, alignSize)    if (stride == 0 && obj != first) { \
+                                                                    stride = Reflex_Complex_stride(reflex, obj, alignSize); \
+                                                                } \
+                                                                obj = stride != 0 ? (uint8_t*) obj + stride : reflex->PObj
+#endif
+
+#if REFLEX_SUPPORT_SCAN_ARRAY && REFLEX_SUPPORT_SIZE_FN
+    #define __initArrayStride(reflex, stride)       if (stride == 0) { \
+                                                        stride = Reflex_size(reflex->Schema, Reflex_SizeType_Normal); \
+                                                        if (stride <= 0) { \
+                                                            return REFLEX_ERROR; \
+                                                        } \
+                                                    }
+#else
+    #define __initArrayStride(reflex, stride)
+#endif
+
+#if REFLEX_SUPPORT_PLAN && REFLEX_SUPPORT_TYPE_COMPLEX
+    #define __enterPlanElement(reflex, frame, obj)  __updateOffsetIndex(reflex); \
+                                                    __resetVarIndex(reflex); \
+                                                    __initMainObj(reflex, obj); \
+                                                    reflex->Schema = (frame)->Begin->Params.Schema
+#endif
+
+#if REFLEX_SUPPORT_SCAN_MASKED && REFLEX_SUPPORT_PLAN
+#if REFLEX_SUPPORT_VAR_INDEX && REFLEX_SUPPORT_TYPE_COMPLEX
+    #define __setVarIndex(reflex, VAR)              reflex->VarIndex = (VAR) - reflex->VarOffset
+#elif REFLEX_SUPPORT_VAR_INDEX
+    #define __setVarIndex(reflex, VAR)              reflex->VarIndex = (VAR)
+#else
+    #define __setVarIndex(reflex, VAR)
+#endif
+    // check any field in range of VARS fields from VAR is selected
+    #define __isMasked(mask, VAR, VARS)             (Reflex_Mask_next(mask, VAR, (VAR) + (VARS)) < (VAR) + (VARS))
+#endif
+
+#if REFLEX_SUPPORT_HASH
+    #define REFLEX_HASH_PRIME1                      0x9E3779B185EBCA87ULL
+    #define REFLEX_HASH_PRIME2                      0xC2B2AE3D27D4EB4FULL
+    #define REFLEX_HASH_PRIME3                      0x165667B19E3779F9ULL
+    #define REFLEX_HASH_PRIME4                      0x85EBCA77C2B2AE63ULL
+    #define REFLEX_HASH_PRIME5                      0x27D4EB2F165667C5ULL
+    #define __hashRotate(X, R)                      (((X) << (R)) | ((X) >> (64 - (R))))
+    #define __hashRound(ACC, INPUT)                 __hashRotate((ACC) + (INPUT) * REFLEX_HASH_PRIME2, 31) * REFLEX_HASH_PRIME1
+    // items must be reversed before hash
+    #define __hashSwap()                            (REFLEX_HASH_ENDIAN_NORMALIZE && REFLEX_BIG_ENDIAN)
+#endif
+
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN
+    // result of compare element of complex fields
+    #define REFLEX_COMPARE_SKIP                     0
+    #define REFLEX_COMPARE_ENTER                    1
+    #define REFLEX_COMPARE_CHANGED                  2
+    // frame of second object follow frame of first object
+    #define __syncFrame(DST, SRC)                   (DST)->Index = (SRC)->Index; \
+                                                    (DST)->Column = (SRC)->Column; \
+                                                    (DST)->Row = (SRC)->Row
+#endif
+
+#if REFLEX_SUPPORT_PLAN
+#if REFLEX_PLAN_THREADED
+    #define __planDispatch(op)                      goto *PLAN_LABELS[(op)->Code]
+    #define __planCase(CODE, LABEL)                 LABEL:
+    #define __planLoop(op)                          __planDispatch(op);
+    #define __planLoopEnd()
+#else
+    #define __planDispatch(op)                      continue
+    #define __planCase(CODE, LABEL)                 case CODE:
+    #define __planLoop(op)                          for (;;) switch ((op)->Code) {
+    #define __planLoopEnd()                         }
+#endif // REFLEX_PLAN_THREADED
+#endif
+
 /* -------------------------------------- Public Functions ---------------------------------- */
 /* ----------------------------------------- Main API --------------------------------------- */
 /**
@@ -480,6 +820,279 @@ void Reflex_setCompact(Reflex* reflex, const Reflex_ScanFunctions* compact) {
     reflex->FunctionMode = Reflex_FunctionMode_Compact;
 }
 #endif
+/* ---------------------------------------- Shared Config API -------------------------------------- */
+#if REFLEX_SUPPORT_CONFIG
+/**
+ * @brief This function copy immutable parameters of reflex into config
+ *
+ * @param reflex
+ * @param config
+ */
+void Reflex_getConfig(const Reflex* reflex, Reflex_Config* config) {
+    config->Schema = reflex->Schema;
+#if REFLEX_SUPPORT_CALLBACK
+    config->onField = reflex->onField;
+#elif REFLEX_SUPPORT_DRIVER
+    config->Driver = reflex->Driver;
+#else
+    config->CompactFns = reflex->CompactFns;
+#endif
+#if REFLEX_SUPPORT_ARGS
+    config->Args = reflex->Args;
+#endif
+    config->FunctionMode = reflex->FunctionMode;
+}
+/**
+ * @brief This function initialize reflex as scan context of config,
+ * scan state is reset and config is not changed by scan functions
+ *
+ * @param reflex context of scan, usually a local variable of each thread
+ * @param config shared config
+ */
+void Reflex_initContext(Reflex* reflex, const Reflex_Config* config) {
+    reflex->Schema = config->Schema;
+#if REFLEX_SUPPORT_CALLBACK
+    reflex->onField = config->onField;
+#elif REFLEX_SUPPORT_DRIVER
+    reflex->Driver = config->Driver;
+#else
+    reflex->CompactFns = config->CompactFns;
+#endif
+#if REFLEX_SUPPORT_ARGS
+    reflex->Args = config->Args;
+#endif
+#if REFLEX_SUPPORT_BUFFER
+    reflex->Buffer = NULL;
+#endif
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->VarIndex = 0;
+#endif
+    reflex->FunctionMode = config->FunctionMode;
+    reflex->BreakLayer = 0;
+    reflex->BreakLayer2D = 0;
+    reflex->Reserved = 0;
+}
+/**
+ * @brief This function scan over all fields in object with shared config,
+ * it's reentrant and mutable state of scan is kept on stack of caller
+ *
+ * @param config
+ * @param obj
+ * @param onField
+ * @return Reflex_Result
+ */
+Reflex_Result Reflex_Config_scanRaw(const Reflex_Config* config, void* obj, Reflex_OnFieldFn onField) {
+    Reflex reflex;
+
+    Reflex_initContext(&reflex, config);
+    return Reflex_scanRaw(&reflex, obj, onField);
+}
+/**
+ * @brief This function scan over all fields in object with shared config
+ *
+ * @param config
+ * @param obj
+ * @return Reflex_Result
+ */
+Reflex_Result Reflex_Config_scan(const Reflex_Config* config, void* obj) {
+    return Reflex_Config_scanRaw(config, obj, REFLEX_ON_FIELD_FNS[config->FunctionMode]);
+}
+#endif // REFLEX_SUPPORT_CONFIG
+/* ----------------------------------------- Array Scan API ----------------------------------------- */
+#if REFLEX_SUPPORT_SCAN_ARRAY
+/**
+ * @brief This function scan over array of objects with same schema and run custom function,
+ * scan function and stride resolved once for all objects, in callbacks MainObject is current object
+ * and Reflex_getElementIndex return index of it
+ * Note: if schema fit in REFLEX_SCAN_ARRAY_PLAN_SIZE ops, it's compiled once on stack
+ * and objects are scanned with plan, otherwise schema is scanned for each object
+ * 
+ * @param reflex 
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means Reflex_size of schema without complex fields
+ * @param onField 
+ * @return Reflex_Result 
+ */
+Reflex_Result Reflex_scanArrayRaw(Reflex* reflex, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnFieldFn onField) {
+    const Reflex_ScanFn scan = REFLEX_SCAN[(uint8_t) reflex->Schema->FormatMode];
+    Reflex_Result result = REFLEX_OK;
+    uint8_t* obj = (uint8_t*) base;
+#if REFLEX_SUPPORT_PLAN && REFLEX_SCAN_ARRAY_PLAN_SIZE > 0
+    Reflex_PlanOp plan[REFLEX_SCAN_ARRAY_PLAN_SIZE];
+    uint8_t planned = 0;
+#endif
+    __initArrayStride(reflex, stride);
+#if REFLEX_SUPPORT_PLAN && REFLEX_SCAN_ARRAY_PLAN_SIZE > 0
+    // compile layout once, it's only worth for more than one object
+    if (count > 1) {
+        planned = Reflex_compile(reflex->Schema, plan, REFLEX_SCAN_ARRAY_PLAN_SIZE) > 0;
+    }
+#endif
+
+    for (reflex->ElementIndex = 0; reflex->ElementIndex < count && result == REFLEX_OK; reflex->ElementIndex++) {
+    #if REFLEX_SUPPORT_PLAN && REFLEX_SCAN_ARRAY_PLAN_SIZE > 0
+        if (planned) {
+            result = Reflex_Plan_scanRaw(reflex, plan, obj, onField);
+        }
+        else
+    #endif
+        {
+            __initComplexParams(reflex, obj);
+            result = scan(reflex, obj, onField);
+        }
+        __breakScanArray(reflex);
+        obj += stride;
+    }
+
+    return result;
+}
+/**
+ * @brief This function scan over array of objects with same schema
+ * 
+ * @param reflex 
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means Reflex_size of schema without complex fields
+ * @return Reflex_Result 
+ */
+Reflex_Result Reflex_scanArray(Reflex* reflex, void* base, Reflex_LenType count, Reflex_LenType stride) {
+    return Reflex_scanArrayRaw(reflex, base, count, stride, REFLEX_ON_FIELD_FNS[reflex->FunctionMode]);
+}
+/**
+ * @brief This function return index of current object in array scan
+ * 
+ * @param reflex 
+ * @return Reflex_LenType 
+ */
+Reflex_LenType Reflex_getElementIndex(Reflex* reflex) {
+    return reflex->ElementIndex;
+}
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function scan over array of objects with a bound plan,
+ * layout of object computed once in plan and reused for all objects
+ * 
+ * @param reflex 
+ * @param plan address of plan that bound with Reflex_Plan_bind
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means size of object in plan
+ * @return Reflex_Result 
+ */
+Reflex_Result Reflex_Plan_scanArray(Reflex* reflex, const Reflex_PlanOp* plan, void* base, Reflex_LenType count, Reflex_LenType stride) {
+    Reflex_Result result = REFLEX_OK;
+    uint8_t* obj = (uint8_t*) base;
+
+    if (stride == 0) {
+        stride = Reflex_Plan_size(plan);
+    }
+
+    for (reflex->ElementIndex = 0; reflex->ElementIndex < count && result == REFLEX_OK; reflex->ElementIndex++) {
+        result = Reflex_Plan_scanBound(reflex, plan, obj);
+        __breakScanArray(reflex);
+        obj += stride;
+    }
+
+    return result;
+}
+#endif // REFLEX_SUPPORT_PLAN
+#endif // REFLEX_SUPPORT_SCAN_ARRAY
+/* ---------------------------------------- Columns Scan API ---------------------------------------- */
+#if REFLEX_SUPPORT_SCAN_COLUMNS && REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function visit fields of array of objects in field-major order,
+ * onColumn called once per field with address of field in first object, fields of
+ * complex elements are separate columns, fields behind complex pointers are not in
+ * fixed offset so pointer slots reported as one column with complex format
+ * Note: VarIndex is index of column
+ * 
+ * @param reflex 
+ * @param plan address of compiled plan
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means size of object in plan
+ * @param onColumn 
+ * @return Reflex_Result 
+ */
+Reflex_Result Reflex_Plan_scanColumns(Reflex* reflex, const Reflex_PlanOp* plan, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnColumnFn onColumn) {
+    Reflex_Result result = REFLEX_OK;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) base;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    Reflex_LenType depth = 0;
+#endif
+    if (stride == 0) {
+        stride = Reflex_Plan_size(plan);
+    }
+    __initComplexParams(reflex, base);
+    __resetVarIndex(reflex);
+    __initMainObj(reflex, base);
+
+    while (op->Code != Reflex_PlanCode_Return && result == REFLEX_OK) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                result = onColumn(reflex, pobj + op->Offset, stride, count, op->Fmt);
+                __increaseVarIndex(reflex);
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                switch (op->Params.Fields.Category) {
+                #if REFLEX_SUPPORT_TYPE_POINTER
+                    case Reflex_Category_Pointer:
+                #endif
+                #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+                    case Reflex_Category_PointerArray:
+                #endif
+                    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+                        result = onColumn(reflex, pobj + op->Offset, stride, count, op->Fmt);
+                        __increaseVarIndex(reflex);
+                        op = &plan[op->Jump + 1];
+                        break;
+                    #endif
+                    default:
+                        if (Reflex_Complex_elements(&op->Params) > 0) {
+                            // enter first element
+                            frame = &frames[depth++];
+                            frame->Begin = op;
+                            frame->Parent = pobj;
+                            frame->Index = 0;
+                            pobj += op->Offset;
+                            op++;
+                        }
+                        else {
+                            op = &plan[op->Jump + 1];
+                        }
+                        break;
+                }
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frame = &frames[depth - 1];
+                if (++frame->Index < Reflex_Complex_elements(&frame->Begin->Params)) {
+                    // enter next element
+                    pobj += op->Stride;
+                    op = &plan[op->Jump];
+                }
+                else {
+                    // leave complex field
+                    pobj = frame->Parent;
+                    op = &plan[frame->Begin->Jump + 1];
+                    depth--;
+                }
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                return REFLEX_ERROR;
+        }
+    }
+
+    return result;
+}
+#endif // REFLEX_SUPPORT_SCAN_COLUMNS
 /* ----------------------------------------- GetField API ---------------------------------------- */
 #if REFLEX_SUPPORT_SCAN_FIELD
 /**
@@ -669,6 +1282,7 @@ Reflex_LenType Reflex_size(const Reflex_Schema* schema, Reflex_SizeType type) {
  */
 Reflex_LenType Reflex_Param_sizeNormal(const Reflex_Schema* schema) {
     uint8_t* pobj = (uint8_t*) 0;
+    uint8_t* next;
     const Reflex_Type_Helper* helper;
     const Reflex_TypeParams* fmt = schema->Fmt;
     Reflex_LenType len = schema->Len;
@@ -676,21 +1290,22 @@ Reflex_LenType Reflex_Param_sizeNormal(const Reflex_Schema* schema) {
     __isCustom_init(schema);
 
     while (len-- > 0) {
+        __checkSizeComplex(fmt);
         helper = &REFLEX_HELPER[fmt->Fields.Category];
-        if (objsize < PRIMARY_TYPE_SIZE[fmt->Fields.Primary]) {
-            objsize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+        if (objsize < helper->itemSize(fmt)) {
+            objsize = helper->itemSize(fmt);
         }
         // check align
-        pobj = helper->alignAddress(pobj, fmt);
+        __moveSize(helper->alignAddress(pobj, fmt));
         // move pobj
-        pobj = helper->moveAddress(pobj, fmt);
+        __moveSize(helper->moveAddress(pobj, fmt));
         // next fmt
         __nextFmt(schema, fmt);
     }
 
-    pobj = Reflex_alignAddress(pobj, objsize);
+    __moveSize(Reflex_alignAddress(pobj, objsize));
 
-    return (Reflex_PtrType) pobj;
+    return Reflex_toLen(pobj);
 }
 /**
  * @brief This function calculate size of Param object in runtime without paddings
@@ -700,19 +1315,21 @@ Reflex_LenType Reflex_Param_sizeNormal(const Reflex_Schema* schema) {
  */
 Reflex_LenType Reflex_Param_sizePacked(const Reflex_Schema* schema) {
     uint8_t* pobj = (uint8_t*) 0;
+    uint8_t* next;
     const Reflex_Type_Helper* helper;
     const Reflex_TypeParams* fmt = schema->Fmt;
     Reflex_LenType len = schema->Len;
     __isCustom_init(schema);
 
     while (len-- > 0) {
+        __checkSizeComplex(fmt);
         helper = &REFLEX_HELPER[fmt->Fields.Category];
         // move pobj
-        pobj = helper->moveAddress(pobj, fmt);
+        __moveSize(helper->moveAddress(pobj, fmt));
         // next fmt
         __nextFmt(schema, fmt);
     }
-    return (Reflex_PtrType) pobj;
+    return Reflex_toLen(pobj);
 }
 #endif // REFLEX_FORMAT_MODE_PARAM
 #if REFLEX_FORMAT_MODE_PRIMARY
@@ -725,6 +1342,7 @@ Reflex_LenType Reflex_Param_sizePacked(const Reflex_Schema* schema) {
 Reflex_LenType Reflex_Primary_sizeNormal(const Reflex_Schema* schema) {
     Reflex_TypeParams fmt = {0};
     uint8_t* pobj = (uint8_t*) 0;
+    uint8_t* next;
     const Reflex_Type_Helper* helper;
     const uint8_t* pfmt = schema->PrimaryFmt;
     Reflex_LenType len = schema->Len;
@@ -732,19 +1350,20 @@ Reflex_LenType Reflex_Primary_sizeNormal(const Reflex_Schema* schema) {
 
     while (len-- > 0) {
         fmt.Type = *pfmt++;
+        __checkSizeComplex(&fmt);
         helper = &REFLEX_HELPER[fmt.Fields.Category];
         if (objsize < PRIMARY_TYPE_SIZE[fmt.Type]) {
             objsize = PRIMARY_TYPE_SIZE[fmt.Type];
         }
         // check align
-        pobj = helper->alignAddress(pobj, &fmt);
+        __moveSize(helper->alignAddress(pobj, &fmt));
         // move pobj
-        pobj = helper->moveAddress(pobj, &fmt);
+        __moveSize(helper->moveAddress(pobj, &fmt));
     }
 
-    pobj = Reflex_alignAddress(pobj, objsize);
+    __moveSize(Reflex_alignAddress(pobj, objsize));
 
-    return (Reflex_PtrType) pobj;
+    return Reflex_toLen(pobj);
 }
 /**
  * @brief This function calculate size of Primary object in runtime without paddings
@@ -755,17 +1374,19 @@ Reflex_LenType Reflex_Primary_sizeNormal(const Reflex_Schema* schema) {
 Reflex_LenType Reflex_Primary_sizePacked(const Reflex_Schema* schema) {
     Reflex_TypeParams fmt = {0};
     uint8_t* pobj = (uint8_t*) 0;
+    uint8_t* next;
     const Reflex_Type_Helper* helper;
     const uint8_t* pfmt = schema->PrimaryFmt;
     Reflex_LenType len = schema->Len;
 
     while (len-- > 0) {
         fmt.Type = *pfmt++;
+        __checkSizeComplex(&fmt);
         helper = &REFLEX_HELPER[fmt.Fields.Category];
         // move pobj
-        pobj = helper->moveAddress(pobj, &fmt);
+        __moveSize(helper->moveAddress(pobj, &fmt));
     }
-    return (Reflex_PtrType) pobj;
+    return Reflex_toLen(pobj);
 }
 #endif // REFLEX_FORMAT_MODE_PRIMARY
 #if REFLEX_FORMAT_MODE_OFFSET
@@ -777,6 +1398,7 @@ Reflex_LenType Reflex_Primary_sizePacked(const Reflex_Schema* schema) {
  */
 Reflex_LenType Reflex_Offset_sizeNormal(const Reflex_Schema* schema) {
     uint8_t* pobj = (uint8_t*) 0;
+    uint8_t* next;
     const Reflex_TypeParams* fmt = schema->Fmt;
     Reflex_LenType len = schema->Len;
     Reflex_LenType objsize = 0;
@@ -784,8 +1406,9 @@ Reflex_LenType Reflex_Offset_sizeNormal(const Reflex_Schema* schema) {
     __isCustom_init(schema);
 
     while (len-- > 0) {
-        if (objsize < PRIMARY_TYPE_SIZE[fmt->Fields.Primary]) {
-            objsize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+        __checkSizeComplex(fmt);
+        if (objsize < REFLEX_HELPER[fmt->Fields.Category].itemSize(fmt)) {
+            objsize = REFLEX_HELPER[fmt->Fields.Category].itemSize(fmt);
         }
         // find max offset
         if (maxOffset->Offset < fmt->Offset) {
@@ -794,12 +1417,13 @@ Reflex_LenType Reflex_Offset_sizeNormal(const Reflex_Schema* schema) {
         // next fmt
         __nextFmt(schema, fmt);
     }
-    // max offset + size
-    pobj = (uint8_t*) ((Reflex_PtrType) maxOffset->Offset + REFLEX_HELPER[maxOffset->Fields.Category].itemSize(maxOffset));
+    // max offset + size of whole field
+    pobj = (uint8_t*) (Reflex_PtrType) maxOffset->Offset;
+    __moveSize(REFLEX_HELPER[maxOffset->Fields.Category].moveAddress(pobj, maxOffset));
     // align to biggest field
-    pobj = Reflex_alignAddress(pobj, objsize);
+    __moveSize(Reflex_alignAddress(pobj, objsize));
 
-    return (Reflex_PtrType) pobj;
+    return Reflex_toLen(pobj);
 }
 /**
  * @brief This function calculate size of Offset object in runtime without paddings
@@ -809,22 +1433,102 @@ Reflex_LenType Reflex_Offset_sizeNormal(const Reflex_Schema* schema) {
  */
 Reflex_LenType Reflex_Offset_sizePacked(const Reflex_Schema* schema) {
     uint8_t* pobj = (uint8_t*) 0;
+    uint8_t* next;
     const Reflex_Type_Helper* helper;
     const Reflex_TypeParams* fmt = schema->Fmt;
     Reflex_LenType len = schema->Len;
     __isCustom_init(schema);
 
     while (len-- > 0) {
+        __checkSizeComplex(fmt);
         helper = &REFLEX_HELPER[fmt->Fields.Category];
         // move pobj
-        pobj = helper->moveAddress(pobj, fmt);
+        __moveSize(helper->moveAddress(pobj, fmt));
         // next fmt
         __nextFmt(schema, fmt);
     }
-    return (Reflex_PtrType) pobj;
+    return Reflex_toLen(pobj);
 }
 #endif // REFLEX_FORMAT_MODE_OFFSET
 #endif // REFLEX_SUPPORT_SIZE_FN
+/* ---------------------------------------- Packed API ---------------------------------------- */
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+/**
+ * @brief This function calculate size of packed encoding of object in runtime,
+ * packed encoding is bytes of all fields in order of scan without paddings,
+ * pointer complex fields are followed, so it's work for schemas with variable size
+ * Note: for schemas without complex fields it's same as Reflex_size with Reflex_SizeType_Packed
+ * 
+ * @param schema 
+ * @param obj 
+ * @return Reflex_LenType size of encoded object, -1 if size not fit in Reflex_LenType
+ */
+Reflex_LenType Reflex_Packed_size(const Reflex_Schema* schema, void* obj) {
+    return Reflex_Packed_walk(schema, obj, NULL);
+}
+/**
+ * @brief This function encode object into buffer with packed encoding,
+ * buffer must have at least Reflex_Packed_size bytes
+ * 
+ * @param schema 
+ * @param obj 
+ * @param buf 
+ * @return Reflex_LenType number of written bytes, -1 if size not fit in Reflex_LenType
+ */
+Reflex_LenType Reflex_Packed_encode(const Reflex_Schema* schema, void* obj, void* buf) {
+    return Reflex_Packed_walk(schema, obj, buf);
+}
+/**
+ * @brief This function scan object and pass bytes of fields to encoder of binary codec,
+ * continuous fields are copied with a single memcpy
+ * 
+ * @param schema 
+ * @param obj 
+ * @param buf NULL means only count bytes
+ * @return Reflex_LenType number of encoded bytes, -1 if size not fit in Reflex_LenType
+ */
+static Reflex_LenType Reflex_Packed_walk(const Reflex_Schema* schema, void* obj, void* buf) {
+    Reflex reflex = {0};
+    Reflex_BinaryState state = {0};
+
+    state.Buf = (uint8_t*) buf;
+    state.Cap = (Reflex_PtrType) ~(Reflex_PtrType) 0;
+    Reflex_init(&reflex, schema);
+    Reflex_setCallback(&reflex, Reflex_Packed_field);
+    Reflex_setBuffer(&reflex, &state);
+    if (Reflex_scan(&reflex, obj) != REFLEX_OK) {
+        return -1;
+    }
+
+    return Reflex_Binary_end(&state);
+}
+/**
+ * @brief This callback add bytes of field to encoder, complex fields only have begin and end
+ * 
+ * @param reflex 
+ * @param value 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Packed_field(Reflex* reflex, void* value, const void* fmt) {
+    const Reflex_TypeParams* param = (const Reflex_TypeParams*) fmt;
+    Reflex_BinaryState* state = (Reflex_BinaryState*) reflex->Buffer;
+    void* next;
+
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    if (param->Fields.Primary == Reflex_PrimaryType_Complex) {
+        return REFLEX_OK;
+    }
+#endif
+    next = REFLEX_HELPER[param->Fields.Category].moveAddress(NULL, param);
+    if (next == REFLEX_ADDRESS_OVERFLOW) {
+        return REFLEX_ERROR;
+    }
+    Reflex_Binary_run(state, (uint8_t*) value, (Reflex_PtrType) next, 1);
+
+    return state->Error ? REFLEX_ERROR : REFLEX_OK;
+}
+#endif // REFLEX_SUPPORT_PACKED
 /* ------------------------------------ LowLevel Scan API ------------------------------------- */
 #if REFLEX_FORMAT_MODE_PARAM
 /**
@@ -836,6 +1540,19 @@ Reflex_LenType Reflex_Offset_sizePacked(const Reflex_Schema* schema) {
  * @return Reflex_Result 
  */
 Reflex_Result Reflex_Param_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn onField) {
+    return Reflex_Param_scanElement(reflex, obj, onField, 0);
+}
+/**
+ * @brief This function scan over Param schema, if stride is known layout of fields is not computed
+ * and object is moved by stride
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param onField 
+ * @param stride size of object, 0 if it's unknown
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Param_scanElement(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride) {
     Reflex_Result result = REFLEX_OK;
     uint8_t* pobj = (uint8_t*) obj;
     const Reflex_Type_Helper* helper;
@@ -860,11 +1577,11 @@ Reflex_Result Reflex_Param_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn o
         pobj = helper->moveAddress(pobj, fmt);
         __increaseVarIndex(reflex);
         // end check complex type
-        __endCheckComplexType(fmt, helper);
+        __endCheckComplexTypeElement(fmt, helper, stride);
         // next fmt
         __nextFmt(reflex->Schema, fmt);
     }
-    __alignObject();
+    __alignElement(obj, stride);
 
     return result;
 }
@@ -889,6 +1606,19 @@ Reflex_Result Reflex_Param_scan(Reflex* reflex, void* obj) {
  * @return Reflex_Result 
  */
 Reflex_Result Reflex_Primary_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn onField) {
+    return Reflex_Primary_scanElement(reflex, obj, onField, 0);
+}
+/**
+ * @brief This function scan over Primary schema, if stride is known layout of fields is not computed
+ * and object is moved by stride
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param onField 
+ * @param stride size of object, 0 if it's unknown
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Primary_scanElement(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride) {
     Reflex_Result result = REFLEX_OK;
     Reflex_TypeParams fmt = {0};
     uint8_t* pobj = (uint8_t*) obj;
@@ -908,12 +1638,12 @@ Reflex_Result Reflex_Primary_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn
         if (onField) {
             result = onField(reflex, pobj, &fmt);
         }
-        __updateBiggestField(PRIMARY_TYPE_SIZE[fmt.Fields.Primary]);
+        __updateBiggestFieldElement(PRIMARY_TYPE_SIZE[fmt.Fields.Primary], stride);
         __increaseVarIndex(reflex);
         // move pobj
         pobj = helper->moveAddress(pobj, &fmt);
     }
-    __alignObject();
+    __alignElement(obj, stride);
 
     return result;
 }
@@ -938,7 +1668,20 @@ Reflex_Result Reflex_Primary_scan(Reflex* reflex, void* obj) {
  * @return Reflex_Result 
  */
 Reflex_Result Reflex_Offset_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn onField) {
-    Reflex_Result result = REFLEX_OK;
+    return Reflex_Offset_scanElement(reflex, obj, onField, 0);
+}
+/**
+ * @brief This function scan over Offset schema, if stride is known layout of fields is not computed
+ * and object is moved by stride
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param onField 
+ * @param stride size of object, 0 if it's unknown
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Offset_scanElement(Reflex* reflex, void* obj, Reflex_OnFieldFn onField, Reflex_LenType stride) {
+    Reflex_Result result = REFLEX_OK;
     uint8_t* pobj = (uint8_t*) obj;
     const Reflex_TypeParams* fmt = reflex->Schema->Fmt;
     Reflex_LenType len = reflex->Schema->Len;
@@ -958,11 +1701,11 @@ Reflex_Result Reflex_Offset_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn
         }
         __increaseVarIndex(reflex);
         // end check complex type
-        __endCheckComplexType(fmt, &REFLEX_HELPER[fmt->Fields.Category]);
+        __endCheckComplexTypeElement(fmt, &REFLEX_HELPER[fmt->Fields.Category], stride);
         // next fmt
         __nextFmt(reflex->Schema, fmt);
     }
-    __alignObject();
+    __alignElement(obj, stride);
 
     return result;
 }
@@ -1170,8 +1913,7 @@ Reflex_GetResult Reflex_Complex_getField(Reflex* reflex, void* obj, const Reflex
     if (fmt == fieldFmt) {
         // fill field
         field->Fmt = fmt;
-        fmt = fmt->Schema->Fmt;
-        field->Object = Reflex_alignAddress(obj, REFLEX_HELPER[fmt->Fields.Category].itemSize(fmt));
+        field->Object = Reflex_alignAddress(obj, Reflex_Complex_alignSize(fmt->Schema));
         __initMainObj(field, reflex->MainObject);
         __initVarIndex(field, reflex);
         return Reflex_GetResult_Ok;
@@ -1187,479 +1929,4151 @@ Reflex_GetResult Reflex_Complex_getField(Reflex* reflex, void* obj, const Reflex
 }
 #endif // REFLEX_SUPPORT_TYPE_COMPLEX
 #endif // REFLEX_SUPPORT_SCAN_FIELD
-/* ---------------------- Private Functions (Implementation) ----------------------- */
-#if REFLEX_ARCH != REFLEX_ARCH_8BIT
+/* ------------------------------------------- Plan API ------------------------------------------- */
+#if REFLEX_SUPPORT_PLAN
 /**
- * @brief This function align address of field,
- * it is prevent hard fault
- * 
- * @param pValue 
- * @param objSize objSize must be 2^x, ex: 1, 2, 4, 8
- * @return void* 
+ * @brief This function compile schema into a flat plan with pre-resolved offsets,
+ * nested complex fields are flattened into Begin/End blocks that loop over elements
+ * Note: obj that scan with plan must be aligned same as struct that schema describe
+ * Note 2: if plan is NULL it's only return number of required ops
+ *
+ * @param schema address of schema
+ * @param plan address of ops array, can be NULL
+ * @param planSize length of ops array
+ * @return Reflex_LenType number of ops in plan, -1 if plan is small or nested depth is more than REFLEX_MAX_DEPTH
  */
-static void* Reflex_alignAddress(void* pValue, Reflex_LenType objSize) {
-    Reflex_PtrType pobj = (Reflex_PtrType) pValue;
-    Reflex_PtrType pad;
+Reflex_LenType Reflex_compile(const Reflex_Schema* schema, Reflex_PlanOp* plan, Reflex_LenType planSize) {
+    Reflex_PlanCompiler compiler = {0};
+    Reflex_TypeParams params = {0};
+    Reflex_LenType ret;
 
-#if REFLEX_ARCH != REFLEX_ARCH_64BIT
-    if (objSize > REFLEX_ARCH_BYTES) {
-        objSize = REFLEX_ARCH_BYTES;
+    compiler.Ops = plan;
+    compiler.Size = planSize;
+    compiler.AlignSize = 1;
+    // compile fields
+    Reflex_Plan_compileSchema(&compiler, schema, (uint8_t*) 0);
+    ret = Reflex_Plan_emit(&compiler, Reflex_PlanCode_Return, NULL, &params, 0);
+    // size of object
+    if (plan != NULL && ret < planSize) {
+        plan[ret].Stride = (Reflex_LenType) (Reflex_PtrType) compiler.PObj;
+        plan[ret].Vars = compiler.Vars;
+        plan[ret].Bytes = compiler.Bytes;
     }
-#endif
 
-    if ((pad = pobj & ((Reflex_PtrType) objSize - 1)) != 0) {
-        pobj += objSize - pad;
+    if (compiler.Error || (plan != NULL && compiler.Len > planSize)) {
+        return -1;
+    }
+    // length of continuous fields, masked scan jump over them
+    while (plan != NULL && ret-- > 0) {
+        if (plan[ret].Code == Reflex_PlanCode_Field && plan[ret + 1].Code == Reflex_PlanCode_Field) {
+            plan[ret].Vars += plan[ret + 1].Vars;
+        }
     }
 
-    return (void*) pobj;
+    return compiler.Len;
 }
-#endif // REFLEX_ARCH
 /**
- * @brief This function return item size
- * 
- * @param fmt 
- * @return Reflex_LenType 
+ * @brief This function scan over fields of object with compiled plan
+ * it's give same callbacks, VarIndex and VarOffset as scan functions
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param onField
+ * @return Reflex_Result
  */
-static Reflex_LenType Reflex_Primary_itemSize(const Reflex_TypeParams* fmt) {
-    return PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+Reflex_Result Reflex_Plan_scanRaw(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, Reflex_OnFieldFn onField) {
+    Reflex_Result result = REFLEX_OK;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) obj;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    Reflex_LenType depth = 0;
+#endif
+    __initComplexParams(reflex, obj);
+    __resetVarIndex(reflex);
+    __initMainObj(reflex, obj);
+
+    while (op->Code != Reflex_PlanCode_Return) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                // onField
+                if (onField) {
+                    result = onField(reflex, pobj + op->Offset, op->Fmt);
+                }
+                __increaseVarIndex(reflex);
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                frame = &frames[depth++];
+                frame->Begin = op;
+                frame->Schema = reflex->Schema;
+                frame->Parent = pobj;
+                frame->Field = pobj + op->Offset;
+                frame->Index = 0;
+                frame->Column = 0;
+                frame->Row = 0;
+                // Call begin callback
+                REFLEX_COMPLEX_BEGIN[reflex->FunctionMode](reflex, frame->Field, op->Fmt);
+                __increaseLayerIndex(reflex);
+                if (Reflex_Complex_elements(&op->Params) > 0) {
+                    // enter first element
+                    pobj = Reflex_Plan_element(frame, frame->Field, 0);
+                    __enterPlanElement(reflex, frame, pobj);
+                    op++;
+                }
+                else {
+                    pobj = frame->Parent;
+                    op = &plan[op->Jump];
+                    goto leave;
+                }
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frame = &frames[depth - 1];
+                if (Reflex_Plan_nextElement(reflex, frame, result)) {
+                    // enter next element
+                    pobj = Reflex_Plan_element(frame, pobj, op->Stride);
+                    __enterPlanElement(reflex, frame, pobj);
+                    op = &plan[op->Jump];
+                    break;
+                }
+                pobj = Reflex_Plan_leave(frame, pobj + op->Stride);
+                op = &plan[frame->Begin->Jump];
+            leave:
+                // leave complex field
+                reflex->Schema = frame->Schema;
+                __initMainObj(reflex, pobj);
+                __decreaseLayerIndex(reflex);
+                // Call end callback
+                REFLEX_COMPLEX_END[reflex->FunctionMode](reflex, frame->Field, op->Fmt);
+                depth--;
+                op++;
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                return REFLEX_ERROR;
+        }
+
+        if (result != REFLEX_OK) {
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            if (depth == 0) {
+                break;
+            }
+            // skip rest of element and leave complex fields
+            if (op->Code != Reflex_PlanCode_Next && op->Code != Reflex_PlanCode_End) {
+                op = &plan[frames[depth - 1].Begin->Jump];
+            }
+        #else
+            break;
+        #endif
+        }
+    }
+
+    return result;
 }
 /**
- * @brief This function align address of field
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function scan over fields of object with compiled plan
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @return Reflex_Result
  */
-static void* Reflex_Primary_alignAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    return Reflex_alignAddress(pValue, PRIMARY_TYPE_SIZE[fmt->Fields.Primary]);
+Reflex_Result Reflex_Plan_scan(Reflex* reflex, const Reflex_PlanOp* plan, void* obj) {
+    return Reflex_Plan_scanRaw(reflex, plan, obj, REFLEX_ON_FIELD_FNS[reflex->FunctionMode]);
 }
 /**
- * @brief This function move address of field based on field format
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function resolve final callback of each op of plan for current FunctionMode of reflex,
+ * call it again after change callback, driver or compact functions
+ * Note: ops without callback are bound to an empty callback, so complex fields without
+ * begin/end callbacks are only entered, but fields must have callback
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @return Reflex_Result REFLEX_OK, REFLEX_ERROR if a field has no callback, plan is still safe to scan
+ * and fields without callback are skipped
  */
-static void* Reflex_Primary_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    uint8_t objSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
-    return (uint8_t*) pValue + objSize;
+Reflex_Result Reflex_Plan_bind(const Reflex* reflex, Reflex_PlanOp* plan) {
+    Reflex_PlanOp* op = plan;
+    Reflex_Result result = REFLEX_OK;
+
+    while (op->Code != Reflex_PlanCode_Return) {
+        op->Fn = Reflex_Plan_resolve(reflex, op);
+        if (op->Fn == NULL) {
+            if (op->Code == Reflex_PlanCode_Field) {
+                result = REFLEX_ERROR;
+            }
+            op->Fn = Reflex_Plan_skip;
+        }
+        op++;
+    }
+
+    return result;
 }
-#if REFLEX_SUPPORT_TYPE_POINTER
 /**
- * @brief This function return item size
- * 
- * @param fmt 
- * @return Reflex_LenType 
+ * @brief This function scan over fields of object with a bound plan,
+ * callbacks are called directly from ops without any lookup, result is same as Reflex_Plan_scan
+ *
+ * @param reflex
+ * @param plan address of plan that bound with Reflex_Plan_bind
+ * @param obj
+ * @return Reflex_Result
  */
-static Reflex_LenType Reflex_Pointer_itemSize(const Reflex_TypeParams* fmt) {
-    return sizeof(void*);
+Reflex_Result Reflex_Plan_scanBound(Reflex* reflex, const Reflex_PlanOp* plan, void* obj) {
+#if REFLEX_PLAN_THREADED
+    static const void* const PLAN_LABELS[] = {
+        &&op_field,
+        &&op_begin,
+        &&op_next,
+        &&op_end,
+        &&op_return,
+    };
+#endif
+    Reflex_Result result = REFLEX_OK;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) obj;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    Reflex_LenType depth = 0;
+#endif
+    __initComplexParams(reflex, obj);
+    __resetVarIndex(reflex);
+    __initMainObj(reflex, obj);
+
+    __planLoop(op)
+    __planCase(Reflex_PlanCode_Field, op_field)
+        result = op->Fn(reflex, pobj + op->Offset, op->Fmt);
+        __increaseVarIndex(reflex);
+        op++;
+        if (result != REFLEX_OK) {
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            if (depth == 0) {
+                return result;
+            }
+            // skip rest of element and leave complex fields
+            if (op->Code != Reflex_PlanCode_Next && op->Code != Reflex_PlanCode_End) {
+                op = &plan[frames[depth - 1].Begin->Jump];
+            }
+        #else
+            return result;
+        #endif
+        }
+        __planDispatch(op);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    __planCase(Reflex_PlanCode_Begin, op_begin)
+        frame = &frames[depth++];
+        frame->Begin = op;
+        frame->Schema = reflex->Schema;
+        frame->Parent = pobj;
+        frame->Field = pobj + op->Offset;
+        frame->Index = 0;
+        frame->Column = 0;
+        frame->Row = 0;
+        op->Fn(reflex, frame->Field, op->Fmt);
+        __increaseLayerIndex(reflex);
+        if (Reflex_Complex_elements(&op->Params) > 0) {
+            // enter first element
+            pobj = Reflex_Plan_element(frame, frame->Field, 0);
+            __enterPlanElement(reflex, frame, pobj);
+            op++;
+            __planDispatch(op);
+        }
+        pobj = frame->Parent;
+        op = &plan[op->Jump];
+        goto leave;
+    __planCase(Reflex_PlanCode_Next, op_next)
+    __planCase(Reflex_PlanCode_End, op_end)
+        frame = &frames[depth - 1];
+        if (Reflex_Plan_nextElement(reflex, frame, result)) {
+            // enter next element
+            pobj = Reflex_Plan_element(frame, pobj, op->Stride);
+            __enterPlanElement(reflex, frame, pobj);
+            op = &plan[op->Jump];
+            __planDispatch(op);
+        }
+        pobj = Reflex_Plan_leave(frame, pobj + op->Stride);
+        op = &plan[frame->Begin->Jump];
+    leave:
+        // leave complex field
+        reflex->Schema = frame->Schema;
+        __initMainObj(reflex, pobj);
+        __decreaseLayerIndex(reflex);
+        op->Fn(reflex, frame->Field, op->Fmt);
+        depth--;
+        op++;
+        if (result != REFLEX_OK) {
+            if (depth == 0) {
+                return result;
+            }
+            // skip rest of element and leave complex fields
+            if (op->Code != Reflex_PlanCode_Next && op->Code != Reflex_PlanCode_End) {
+                op = &plan[frames[depth - 1].Begin->Jump];
+            }
+        }
+        __planDispatch(op);
+#else
+    __planCase(Reflex_PlanCode_Begin, op_begin)
+    __planCase(Reflex_PlanCode_Next, op_next)
+    __planCase(Reflex_PlanCode_End, op_end)
+        return REFLEX_ERROR;
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+    __planCase(Reflex_PlanCode_Return, op_return)
+        return result;
+    __planLoopEnd()
 }
+#if REFLEX_SUPPORT_SCAN_MASKED
 /**
- * @brief This function align address of pointer field
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function return number of fields of plan, it's size of mask in bits
+ *
+ * @param plan address of compiled plan
+ * @return Reflex_LenType
  */
-static void* Reflex_Pointer_alignAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    return Reflex_alignAddress(pValue, sizeof(void*));
+Reflex_LenType Reflex_Plan_vars(const Reflex_PlanOp* plan) {
+    while (plan->Code != Reflex_PlanCode_Return) {
+        plan++;
+    }
+    return plan->Vars;
 }
 /**
- * @brief This function move address of field
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function scan only fields that selected in mask,
+ * bit i of mask select field with flat VarIndex i, same as Reflex_getVarIndex in scan functions
+ * it's jump directly over continuous fields that not selected and skip complex fields and elements
+ * that have no selected field without any callback, so begin/end callbacks only called for
+ * complex fields that have selected fields
+ * Note: flat VarIndex of fields are same as scan, real VarIndex is only valid for selected fields
+ * Note 2: mask must have REFLEX_MASK_LEN(Reflex_Plan_vars(plan)) words
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param mask bitmap of selected fields
+ * @return Reflex_Result
  */
-static void* Reflex_Pointer_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    uint8_t objSize = sizeof(void*);
-    return (uint8_t*) pValue + objSize;
+Reflex_Result Reflex_Plan_scanMasked(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, const uint32_t* mask) {
+    Reflex_OnFieldFn onField = REFLEX_ON_FIELD_FNS[reflex->FunctionMode];
+    Reflex_Result result = REFLEX_OK;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) obj;
+    Reflex_LenType var = 0;
+    Reflex_LenType next;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    const Reflex_PlanOp* end;
+    Reflex_LenType depth = 0;
+#endif
+    __initComplexParams(reflex, obj);
+    __resetVarIndex(reflex);
+    __initMainObj(reflex, obj);
+
+    while (op->Code != Reflex_PlanCode_Return) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                next = Reflex_Mask_next(mask, var, var + op->Vars);
+                // jump over fields that not selected
+                op += next - var;
+                var = next;
+                if (op->Code == Reflex_PlanCode_Field) {
+                    __setVarIndex(reflex, var);
+                    if (onField) {
+                        result = onField(reflex, pobj + op->Offset, op->Fmt);
+                    }
+                    var++;
+                    op++;
+                }
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                if (!__isMasked(mask, var, op->Vars)) {
+                    // there is no selected field in complex field
+                    var += op->Vars;
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                frame = &frames[depth++];
+                frame->Begin = op;
+                frame->Schema = reflex->Schema;
+                frame->Parent = pobj;
+                frame->Field = pobj + op->Offset;
+                frame->Index = 0;
+                frame->Column = 0;
+                frame->Row = 0;
+                // Call begin callback
+                __setVarIndex(reflex, var);
+                REFLEX_COMPLEX_BEGIN[reflex->FunctionMode](reflex, frame->Field, op->Fmt);
+                __increaseLayerIndex(reflex);
+                // enter first element
+                pobj = Reflex_Plan_element(frame, frame->Field, 0);
+                __enterPlanElement(reflex, frame, pobj);
+                end = &plan[op->Jump];
+                if (__isMasked(mask, var, end->Vars)) {
+                    op++;
+                }
+                else {
+                    // there is no selected field in first element
+                    var += end->Vars;
+                    op = Reflex_Plan_tail(plan, frame);
+                }
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frame = &frames[depth - 1];
+                end = &plan[frame->Begin->Jump];
+                while (Reflex_Plan_nextElement(reflex, frame, result)) {
+                    // enter next element
+                    pobj = Reflex_Plan_element(frame, pobj, op->Stride);
+                    __setVarIndex(reflex, var);
+                    __enterPlanElement(reflex, frame, pobj);
+                    if (__isMasked(mask, var, end->Vars)) {
+                        op = &plan[op->Jump];
+                        break;
+                    }
+                    // there is no selected field in element
+                    var += end->Vars;
+                    op = end;
+                }
+                if (op->Code == Reflex_PlanCode_Next || op->Code == Reflex_PlanCode_End) {
+                    pobj = Reflex_Plan_leave(frame, pobj + op->Stride);
+                    // leave complex field
+                    reflex->Schema = frame->Schema;
+                    __initMainObj(reflex, pobj);
+                    __decreaseLayerIndex(reflex);
+                    // Call end callback
+                    __setVarIndex(reflex, var);
+                    REFLEX_COMPLEX_END[reflex->FunctionMode](reflex, frame->Field, end->Fmt);
+                    depth--;
+                    op = end + 1;
+                }
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                return REFLEX_ERROR;
+        }
+
+        if (result != REFLEX_OK) {
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            if (depth == 0) {
+                break;
+            }
+            // skip rest of element and leave complex fields
+            if (op->Code != Reflex_PlanCode_Next && op->Code != Reflex_PlanCode_End) {
+                op = &plan[frames[depth - 1].Begin->Jump];
+            }
+        #else
+            break;
+        #endif
+        }
+    }
+
+    return result;
 }
-#endif // REFLEX_SUPPORT_TYPE_POINTER
-#if REFLEX_SUPPORT_TYPE_ARRAY
+#endif // REFLEX_SUPPORT_SCAN_MASKED
+#if REFLEX_SUPPORT_SCAN_RUNS
 /**
- * @brief This function move address of array field
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function scan over runs of continuous bytes of fields in order of fields,
+ * fields without padding between them are merged into one run, complex fields
+ * without any padding and pointer are passed as one run without scan of elements,
+ * pointers break runs and objects of complex pointers are scanned as separate runs
+ * Note: copy of runs is same as copy of fields one by one
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param onRun
+ * @return Reflex_Result
  */
-static void* Reflex_Array_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    uint8_t objSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary] * fmt->Len;
-    return (uint8_t*) pValue + objSize;
+Reflex_Result Reflex_Plan_scanRuns(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, Reflex_OnRunFn onRun) {
+    Reflex_Result result = REFLEX_OK;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) obj;
+    uint8_t* run = NULL;
+    uint8_t* runEnd = NULL;
+    uint8_t* addr;
+    Reflex_LenType len;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    Reflex_LenType depth = 0;
+#endif
+
+    while (op->Code != Reflex_PlanCode_Return) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                addr = pobj + op->Offset;
+                len = op->Bytes;
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                addr = pobj + op->Offset;
+                len = 0;
+                if (op->Bytes == op->Stride) {
+                    // there is no padding and pointer in complex field
+                    len = op->Bytes;
+                    op = &plan[op->Jump + 1];
+                }
+                else if (Reflex_Complex_elements(&op->Params) > 0) {
+                    frame = &frames[depth++];
+                    frame->Begin = op;
+                    frame->Parent = pobj;
+                    frame->Field = addr;
+                    frame->Index = 0;
+                    frame->Column = 0;
+                    frame->Row = 0;
+                    // enter first element
+                    pobj = Reflex_Plan_element(frame, frame->Field, 0);
+                    op++;
+                }
+                else {
+                    op = &plan[op->Jump + 1];
+                }
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frame = &frames[depth - 1];
+                addr = NULL;
+                len = 0;
+                if (Reflex_Plan_nextElement(reflex, frame, REFLEX_OK)) {
+                    // enter next element
+                    pobj = Reflex_Plan_element(frame, pobj, op->Stride);
+                    op = &plan[op->Jump];
+                }
+                else {
+                    // leave complex field
+                    pobj = Reflex_Plan_leave(frame, pobj + op->Stride);
+                    op = &plan[frame->Begin->Jump + 1];
+                    depth--;
+                }
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                return REFLEX_ERROR;
+        }
+
+        if (len == 0) {
+            continue;
+        }
+        if (addr != runEnd) {
+            if (runEnd != run) {
+                result = onRun(reflex, run, (Reflex_LenType) (runEnd - run));
+                if (result != REFLEX_OK) {
+                    return result;
+                }
+            }
+            // start new run
+            run = addr;
+            runEnd = addr;
+        }
+        runEnd += len;
+    }
+    // last run
+    if (runEnd != run) {
+        result = onRun(reflex, run, (Reflex_LenType) (runEnd - run));
+    }
+
+    return result;
 }
-#endif // REFLEX_SUPPORT_TYPE_ARRAY
-#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+#endif // REFLEX_SUPPORT_SCAN_RUNS
+#endif // REFLEX_SUPPORT_PLAN
+/* ------------------------------------------- Hash API ------------------------------------------- */
+#if REFLEX_SUPPORT_HASH
 /**
- * @brief This function move address of pointer array field
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function return XXH64 hash of bytes
+ *
+ * @param data
+ * @param len
+ * @param seed
+ * @return uint64_t
  */
-static void* Reflex_PointerArray_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    uint8_t objSize = sizeof(void*) * fmt->Len;
-    return (uint8_t*) pValue + objSize;
+uint64_t Reflex_hashBytes(const void* data, Reflex_PtrType len, uint64_t seed) {
+    Reflex_HashState state;
+
+    Reflex_Hash_init(&state, seed);
+    Reflex_Hash_update(&state, (const uint8_t*) data, len);
+
+    return Reflex_Hash_digest(&state);
 }
-#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
-#if REFLEX_SUPPORT_TYPE_ARRAY_2D
+#if REFLEX_SUPPORT_PLAN
 /**
- * @brief This function move address of 2D array field
- * 
- * @param pValue 
- * @param fmt 
- * @return void* 
+ * @brief This function return 64-bit hash of content of object, paddings and address of pointers are not hashed,
+ * for pointers a byte that show pointer is not NULL is hashed and after that it's object,
+ * continuous fields are hashed in bulk, result is same as Reflex_hashBytes over all meaningful bytes in order of fields
+ * Note: each pointer of primary types point to one item
+ * Note 2: with REFLEX_HASH_ENDIAN_NORMALIZE hash is same on little endian and big endian hosts
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param seed
+ * @return uint64_t
  */
-static void* Reflex_Array2D_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
-    uint8_t objSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary] * fmt->Len * fmt->MLen;
-    return (uint8_t*) pValue + objSize;
-}
-#endif
+uint64_t Reflex_Plan_hash(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, uint64_t seed) {
+    Reflex_HashState state;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) obj;
 #if REFLEX_SUPPORT_TYPE_COMPLEX
-#if REFLEX_SUPPORT_DRIVER
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    Reflex_LenType depth = 0;
+#endif
+    Reflex_Hash_init(&state, seed);
+
+    while (op->Code != Reflex_PlanCode_Return) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                Reflex_Hash_field(&state, &op->Params, pobj + op->Offset, op->Bytes);
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                if (op->Bytes == op->Stride && !__hashSwap()) {
+                    // there is no padding and pointer in complex field
+                    Reflex_Hash_run(&state, pobj + op->Offset, op->Bytes);
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                else if (Reflex_Complex_elements(&op->Params) == 0) {
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                frame = &frames[depth++];
+                frame->Begin = op;
+                frame->Parent = pobj;
+                frame->Field = pobj + op->Offset;
+                frame->Index = 0;
+                frame->Column = 0;
+                frame->Row = 0;
+                // enter first element, fields of NULL objects are skipped
+                pobj = Reflex_Plan_element(frame, frame->Field, 0);
+                op = Reflex_Hash_element(&state, frame, pobj) ? op + 1 : &plan[op->Jump];
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frame = &frames[depth - 1];
+                if (Reflex_Plan_nextElement(reflex, frame, REFLEX_OK)) {
+                    // enter next element
+                    pobj = Reflex_Plan_element(frame, pobj, op->Stride);
+                    op = Reflex_Hash_element(&state, frame, pobj) ? &plan[op->Jump] : &plan[frame->Begin->Jump];
+                    break;
+                }
+                // leave complex field
+                pobj = Reflex_Plan_leave(frame, pobj + op->Stride);
+                op = &plan[frame->Begin->Jump + 1];
+                depth--;
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                op++;
+                break;
+        }
+    }
+    Reflex_Hash_flush(&state);
+
+    return Reflex_Hash_digest(&state);
+}
+#endif // REFLEX_SUPPORT_PLAN
+#endif // REFLEX_SUPPORT_HASH
+/* ------------------------------------------- Compare API ------------------------------------------ */
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN
 /**
- * @brief This is a helper function for call begin driver callback
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @return Reflex_Result 
+ * @brief This function check content of two objects are equal, paddings and address of pointers are not compared,
+ * continuous fields are merged into runs and compared with a single memcmp, complex fields without
+ * padding and pointer are compared as one block, it's return on first difference
+ * Note: fields are compared bitwise, so 0.0 and -0.0 are different and same NaN are equal
+ * Note 2: both objects must be aligned same as object that plan compiled for
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param a first object
+ * @param b second object
+ * @return uint8_t 1 if objects are equal
  */
-static Reflex_Result Reflex_Complex_Begin_Driver(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->Driver->Category[((const Reflex_TypeParams*) fmt)->Fields.Category]->fnComplexBegin(reflex, obj, fmt);
+uint8_t Reflex_Plan_equals(Reflex* reflex, const Reflex_PlanOp* plan, void* a, void* b) {
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pa = (uint8_t*) a;
+    uint8_t* pb = (uint8_t*) b;
+    uint8_t* runA = NULL;
+    uint8_t* runB = NULL;
+    Reflex_LenType runLen = 0;
+    uint8_t* addrA;
+    uint8_t* addrB;
+    Reflex_LenType len;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame framesA[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame framesB[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frameA;
+    Reflex_PlanFrame* frameB;
+    Reflex_LenType depth = 0;
+    uint8_t state;
+#endif
+
+    while (op->Code != Reflex_PlanCode_Return) {
+        addrA = pa + op->Offset;
+        addrB = pb + op->Offset;
+        len = 0;
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                if (op->Bytes > 0) {
+                    len = op->Bytes;
+                }
+                else if (!Reflex_Compare_field(&op->Params, addrA, addrB, 0)) {
+                    return 0;
+                }
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                if (op->Bytes == op->Stride || Reflex_Complex_elements(&op->Params) == 0) {
+                    // there is no padding and pointer in complex field
+                    len = op->Bytes;
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                frameA = &framesA[depth];
+                frameB = &framesB[depth++];
+                frameA->Begin = op;
+                frameA->Parent = pa;
+                frameA->Field = addrA;
+                frameA->Index = 0;
+                frameA->Column = 0;
+                frameA->Row = 0;
+                *frameB = *frameA;
+                frameB->Parent = pb;
+                frameB->Field = addrB;
+                // enter first element
+                pa = Reflex_Plan_element(frameA, frameA->Field, 0);
+                pb = Reflex_Plan_element(frameB, frameB->Field, 0);
+                state = Reflex_Compare_element(frameA, pa, pb);
+                if (state == REFLEX_COMPARE_CHANGED) {
+                    return 0;
+                }
+                op = state == REFLEX_COMPARE_ENTER ? op + 1 : &plan[op->Jump];
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frameA = &framesA[depth - 1];
+                frameB = &framesB[depth - 1];
+                if (Reflex_Plan_nextElement(reflex, frameA, REFLEX_OK)) {
+                    __syncFrame(frameB, frameA);
+                    // enter next element
+                    pa = Reflex_Plan_element(frameA, pa, op->Stride);
+                    pb = Reflex_Plan_element(frameB, pb, op->Stride);
+                    state = Reflex_Compare_element(frameA, pa, pb);
+                    if (state == REFLEX_COMPARE_CHANGED) {
+                        return 0;
+                    }
+                    op = state == REFLEX_COMPARE_ENTER ? &plan[op->Jump] : &plan[frameA->Begin->Jump];
+                    break;
+                }
+                __syncFrame(frameB, frameA);
+                // leave complex field
+                pa = Reflex_Plan_leave(frameA, pa + op->Stride);
+                pb = Reflex_Plan_leave(frameB, pb + op->Stride);
+                op = &plan[frameA->Begin->Jump + 1];
+                depth--;
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                op++;
+                break;
+        }
+
+        if (len == 0) {
+            continue;
+        }
+        if (addrA != runA + runLen || addrB != runB + runLen) {
+            if (runLen > 0 && memcmp(runA, runB, runLen) != 0) {
+                return 0;
+            }
+            // start new run
+            runA = addrA;
+            runB = addrB;
+            runLen = 0;
+        }
+        runLen += len;
+    }
+    // last run
+    return runLen == 0 || memcmp(runA, runB, runLen) == 0;
 }
 /**
- * @brief This is a helper function for call end driver callback
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @return Reflex_Result 
+ * @brief This function call onChanged for each field that is different in two objects,
+ * complex fields without padding and pointer are compared as one block first and their elements
+ * are visited only if block is changed, objects of pointers are compared instead of pointers
+ * Note: fields are compared bitwise, arrays of primary types are one field
+ * Note 2: both objects must be aligned same as object that plan compiled for
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param a first object
+ * @param b second object
+ * @param onChanged
+ * @return Reflex_Result
  */
-static Reflex_Result Reflex_Complex_End_Driver(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->Driver->Category[((const Reflex_TypeParams*) fmt)->Fields.Category]->fnComplexEnd(reflex, obj, fmt);
+Reflex_Result Reflex_Plan_diff(Reflex* reflex, const Reflex_PlanOp* plan, void* a, void* b, Reflex_OnChangedFn onChanged) {
+    Reflex_Result result = REFLEX_OK;
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pa = (uint8_t*) a;
+    uint8_t* pb = (uint8_t*) b;
+    Reflex_LenType var = 0;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame framesA[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame framesB[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frameA;
+    Reflex_PlanFrame* frameB;
+    const Reflex_PlanOp* end;
+    Reflex_LenType depth = 0;
+    uint8_t state;
+#endif
+
+    while (op->Code != Reflex_PlanCode_Return && result == REFLEX_OK) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                if (!Reflex_Compare_field(&op->Params, pa + op->Offset, pb + op->Offset, op->Bytes)) {
+                    result = onChanged(reflex, pa + op->Offset, pb + op->Offset, op->Fmt, var);
+                }
+                var++;
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                if (Reflex_Complex_elements(&op->Params) == 0 ||
+                    (op->Bytes == op->Stride && memcmp(pa + op->Offset, pb + op->Offset, op->Bytes) == 0)
+                ) {
+                    // there is no changed field in complex field
+                    var += op->Vars;
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                frameA = &framesA[depth];
+                frameB = &framesB[depth++];
+                frameA->Begin = op;
+                frameA->Parent = pa;
+                frameA->Field = pa + op->Offset;
+                frameA->Index = 0;
+                frameA->Column = 0;
+                frameA->Row = 0;
+                *frameB = *frameA;
+                frameB->Parent = pb;
+                frameB->Field = pb + op->Offset;
+                // enter first element
+                pa = Reflex_Plan_element(frameA, frameA->Field, 0);
+                pb = Reflex_Plan_element(frameB, frameB->Field, 0);
+                state = Reflex_Compare_element(frameA, pa, pb);
+                if (state == REFLEX_COMPARE_ENTER) {
+                    op++;
+                    break;
+                }
+                if (state == REFLEX_COMPARE_CHANGED) {
+                    result = onChanged(reflex, pa, pb, op->Fmt, var);
+                }
+                // skip fields of element
+                end = &plan[op->Jump];
+                var += end->Vars;
+                op = end;
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frameA = &framesA[depth - 1];
+                frameB = &framesB[depth - 1];
+                end = &plan[frameA->Begin->Jump];
+                if (Reflex_Plan_nextElement(reflex, frameA, REFLEX_OK)) {
+                    __syncFrame(frameB, frameA);
+                    // enter next element
+                    pa = Reflex_Plan_element(frameA, pa, op->Stride);
+                    pb = Reflex_Plan_element(frameB, pb, op->Stride);
+                    state = Reflex_Compare_element(frameA, pa, pb);
+                    if (state == REFLEX_COMPARE_ENTER) {
+                        op = &plan[op->Jump];
+                        break;
+                    }
+                    if (state == REFLEX_COMPARE_CHANGED) {
+                        result = onChanged(reflex, pa, pb, frameA->Begin->Fmt, var);
+                    }
+                    // skip fields of element
+                    var += end->Vars;
+                    op = end;
+                    break;
+                }
+                __syncFrame(frameB, frameA);
+                // leave complex field
+                pa = Reflex_Plan_leave(frameA, pa + op->Stride);
+                pb = Reflex_Plan_leave(frameB, pb + op->Stride);
+                op = end + 1;
+                depth--;
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                return REFLEX_ERROR;
+        }
+    }
+
+    return result;
 }
-#endif // REFLEX_SUPPORT_DRIVER
-#if REFLEX_SUPPORT_COMPACT
+#endif // REFLEX_SUPPORT_COMPARE
+/* ------------------------------------------- Binary API ------------------------------------------- */
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
 /**
- * @brief This is a helper function for call begin compact callback
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @return Reflex_Result 
+ * @brief This function return size of binary encoding of plan if it's same for all objects,
+ * it's same as Reflex_size with Reflex_SizeType_Packed and also work for complex fields
+ *
+ * @param plan address of compiled plan
+ * @return Reflex_LenType size of encoded object, -1 if plan has pointer fields
  */
-static Reflex_Result Reflex_Complex_Begin_Compact(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->CompactFns->fnComplexBegin(reflex, obj, fmt);
+Reflex_LenType Reflex_Binary_sizeFixed(const Reflex_PlanOp* plan) {
+    while (plan->Code != Reflex_PlanCode_Return) {
+        switch (plan->Params.Fields.Category) {
+        #if REFLEX_SUPPORT_TYPE_POINTER
+            case Reflex_Category_Pointer:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            case Reflex_Category_PointerArray:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+                return -1;
+        #endif
+            default:
+                plan++;
+                break;
+        }
+    }
+    return plan->Bytes;
 }
 /**
- * @brief This is a helper function for call end compact callback
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @return Reflex_Result 
+ * @brief This function calculate size of binary encoding of object in runtime,
+ * objects of pointers are followed, so it's work for schemas with variable size
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @return Reflex_LenType size of encoded object, -1 if size not fit in Reflex_LenType
  */
-static Reflex_Result Reflex_Complex_End_Compact(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->CompactFns->fnComplexEnd(reflex, obj, fmt);
+Reflex_LenType Reflex_Binary_size(Reflex* reflex, const Reflex_PlanOp* plan, void* obj) {
+    Reflex_BinaryState state = {0};
+
+    state.Cap = REFLEX_LEN_MAX;
+
+    return Reflex_Binary_walk(reflex, plan, obj, &state);
 }
-#endif // REFLEX_SUPPORT_COMPACT
 /**
- * @brief This function run scan function over a complex field
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param onField 
- * @return Reflex_Result 
+ * @brief This function encode object into buffer with packed layout, bytes of fields in order of fields
+ * without paddings in byte order of host, continuous fields and complex fields without padding and pointer
+ * are copied with a single memcpy, for pointers a byte that show pointer is not NULL is written
+ * and after that it's object
+ * Note: each pointer of primary types point to one item
+ * Note 2: for schemas without pointers it's same as Reflex_Packed_encode
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param out
+ * @param cap size of out buffer
+ * @return Reflex_LenType number of written bytes, -1 if buffer is not enough or size not fit in Reflex_LenType
  */
-static Reflex_Result Reflex_Complex_Primary_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt ,Reflex_OnFieldFn onField) {
-    Reflex_Result res;
-    const Reflex_Schema* tmpSchema = reflex->Schema;
+Reflex_LenType Reflex_Binary_encode(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, void* out, Reflex_PtrType cap) {
+    Reflex_BinaryState state = {0};
 
-    __updateOffsetIndex(reflex);
-    reflex->Schema = fmt->Schema;
-    res = REFLEX_SCAN[(uint8_t) reflex->Schema->FormatMode](reflex, obj, onField);
-    reflex->Schema = tmpSchema;
+    state.Buf = (uint8_t*) out;
+    state.Cap = cap;
 
-    return res;
+    return Reflex_Binary_walk(reflex, plan, obj, &state);
 }
-#if REFLEX_SUPPORT_TYPE_POINTER
 /**
- * @brief This function run scan function over a complex pointer field
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param onField 
- * @return Reflex_Result 
+ * @brief This function decode object from buffer that encoded with Reflex_Binary_encode,
+ * objects of pointers are not allocated, they are decoded into objects that pointers of obj point to,
+ * pointers that are NULL in buffer are set to NULL
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param in
+ * @param len size of in buffer
+ * @return Reflex_LenType number of read bytes, -1 if buffer is not enough or pointer of obj is NULL
  */
-static Reflex_Result Reflex_Complex_Pointer_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
-    Reflex_Result res;
-    const Reflex_Schema* tmpSchema = reflex->Schema;
+Reflex_LenType Reflex_Binary_decode(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, const void* in, Reflex_PtrType len) {
+    Reflex_BinaryState state = {0};
 
-    __updateOffsetIndex(reflex);
-    reflex->Schema = fmt->Schema;
-    res = REFLEX_SCAN[(uint8_t) reflex->Schema->FormatMode](reflex, *(void**) obj, onField);
-    reflex->Schema = tmpSchema;
-    __initMainObj(reflex, obj);
-    // move obj
-    reflex->PObj = Reflex_Pointer_moveAddress(obj, fmt);
+    state.Buf = (uint8_t*) in;
+    state.Cap = len;
+    state.Decode = 1;
 
-    return res;
+    return Reflex_Binary_walk(reflex, plan, obj, &state);
 }
-#endif // REFLEX_SUPPORT_TYPE_POINTER
-#if REFLEX_SUPPORT_TYPE_ARRAY
+#if REFLEX_SUPPORT_BYTE_ORDER
 /**
- * @brief This function run scan function over a complex array field
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param onField 
- * @return Reflex_Result 
+ * @brief This function encode object into buffer same as Reflex_Binary_encode in given byte order,
+ * items of arrays and continuous fields with same item size are swapped in bulk with SIMD instructions,
+ * if byte order is same as host it's same as Reflex_Binary_encode
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param out
+ * @param cap size of out buffer
+ * @param order byte order of buffer
+ * @return Reflex_LenType number of written bytes, -1 if buffer is not enough
  */
-static Reflex_Result Reflex_Complex_Array_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
-    Reflex_Result res = REFLEX_OK;
-    Reflex_LenType len = fmt->Len;
+Reflex_LenType Reflex_Binary_encodeOrder(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, void* out, Reflex_PtrType cap, Reflex_ByteOrder order) {
+    Reflex_BinaryState state = {0};
 
-    while (len-- > 0 && res == REFLEX_OK) {
-        res = Reflex_Complex_Primary_scan(reflex, obj, fmt, onField);
-        obj = reflex->PObj;
-        __breakScanArray(reflex);
-    }
+    state.Buf = (uint8_t*) out;
+    state.Cap = cap;
+    state.Swap = __swapOrder(order);
 
-    return res;
+    return Reflex_Binary_walk(reflex, plan, obj, &state);
 }
-#endif // REFLEX_SUPPORT_TYPE_ARRAY
-#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
 /**
- * @brief This function run scan function over a complex pointer array field
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param onField 
- * @return Reflex_Result 
+ * @brief This function decode object from buffer that encoded with Reflex_Binary_encodeOrder in given byte order
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param in
+ * @param len size of in buffer
+ * @param order byte order of buffer
+ * @return Reflex_LenType number of read bytes, -1 if buffer is not enough or pointer of obj is NULL
  */
-static Reflex_Result Reflex_Complex_PointerArray_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
-    Reflex_Result res = REFLEX_OK;
-    Reflex_LenType len = fmt->Len;
+Reflex_LenType Reflex_Binary_decodeOrder(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, const void* in, Reflex_PtrType len, Reflex_ByteOrder order) {
+    Reflex_BinaryState state = {0};
 
-    while (len-- > 0 && res == REFLEX_OK) {
-        res = Reflex_Complex_Pointer_scan(reflex, obj, fmt, onField);
-        obj = reflex->PObj;
-        __breakScanArray(reflex);
-    }
+    state.Buf = (uint8_t*) in;
+    state.Cap = len;
+    state.Decode = 1;
+    state.Swap = __swapOrder(order);
 
-    return res;
+    return Reflex_Binary_walk(reflex, plan, obj, &state);
 }
-#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
-#if REFLEX_SUPPORT_TYPE_ARRAY_2D
 /**
- * @brief This function run scan function over a complex 2D array field
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param onField 
- * @return Reflex_Result 
+ * @brief This function convert items of all fields of object to network byte order in place,
+ * objects of pointers are converted too, on big endian hosts it's do nothing,
+ * Reflex_Plan_fromNetworkOrder is same function because swap is reversible
+ * Note: objects that shared between many pointers are converted more than once
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @return Reflex_Result
  */
-static Reflex_Result Reflex_Complex_Array2D_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
-    Reflex_Result res = REFLEX_OK;
-    Reflex_LenType len;
-    Reflex_LenType mlen = fmt->MLen;
+Reflex_Result Reflex_Plan_toNetworkOrder(Reflex* reflex, const Reflex_PlanOp* plan, void* obj) {
+    Reflex_BinaryState state = {0};
+    Reflex_LenType size;
 
-    while (mlen-- > 0 && res == REFLEX_OK) {
-        len = fmt->Len;
-        while (len-- > 0 && res == REFLEX_OK) {
-            res = Reflex_Complex_Primary_scan(reflex, obj, fmt, onField);
-            obj = reflex->PObj;
-            __breakScanArray(reflex);
+    state.Swap = __swapOrder(Reflex_ByteOrder_Network);
+    if (!state.Swap) {
+        return REFLEX_OK;
+    }
+    // pass is limited to bytes of object, objects of pointers are only known in runtime
+    size = Reflex_Binary_sizeFixed(plan);
+    if (size < 0) {
+        size = Reflex_Binary_size(reflex, plan, obj);
+        if (size < 0) {
+            return REFLEX_ERROR;
         }
-        __breakScanArray2D(reflex);
     }
+    state.Cap = (Reflex_PtrType) size;
 
-    return res;
+    return Reflex_Binary_walk(reflex, plan, obj, &state) == size ? REFLEX_OK : REFLEX_ERROR;
 }
-#endif // REFLEX_SUPPORT_TYPE_ARRAY_2D
-#if REFLEX_SUPPORT_SCAN_FIELD
+#endif // REFLEX_SUPPORT_BYTE_ORDER
+#endif // REFLEX_SUPPORT_BINARY
+/* ------------------------------------------- View API ------------------------------------------- */
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
 /**
- * @brief This function find a field in complex object
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param fieldFmt 
- * @param field 
- * @return Reflex_GetResult 
+ * @brief This macro define typed getter of view, item is loaded with memcpy because buffer has no alignment
  */
-static Reflex_GetResult Reflex_Complex_Primary_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
-    Reflex_GetResult res;
-    const Reflex_Schema* tmpSchema = reflex->Schema;
+#define __viewGetFn(NAME, TYPE)             TYPE NAME(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index) { \
+                                                const void* item = Reflex_View_typed(view, varIndex, index, (Reflex_LenType) sizeof(TYPE)); \
+                                                TYPE value = 0; \
+                                                if (item != NULL) { \
+                                                    memcpy(&value, item, sizeof(TYPE)); \
+                                                } \
+                                                return value; \
+                                            }
+/**
+ * @brief This function bind view to a buffer that encoded with Reflex_Binary_encode in byte order of host,
+ * nothing is read here, fields are found on first access and their offsets are cached in entries,
+ * so each byte of buffer is walked at most once
+ *
+ * @param view
+ * @param plan address of compiled plan
+ * @param buf encoded buffer, it must be valid while view is used
+ * @param len size of buffer
+ * @param entries cache of fields, one entry per field
+ * @param size size of entries array, it must be at least number of fields of plan
+ * @return Reflex_Result REFLEX_OK, REFLEX_ERROR if entries array is small
+ */
+Reflex_Result Reflex_View_init(Reflex_View* view, const Reflex_PlanOp* plan, const void* buf, Reflex_LenType len, Reflex_ViewEntry* entries, Reflex_LenType size) {
+    const Reflex_PlanOp* ret = plan;
 
-    __updateOffsetIndex(reflex);
-    reflex->Schema = fmt->Schema;
-    res = REFLEX_GET_FIELD[(uint8_t) reflex->Schema->FormatMode](reflex, obj, fieldFmt, field);
-    reflex->Schema = tmpSchema;
+    while (ret->Code != Reflex_PlanCode_Return) {
+        ret++;
+    }
+    view->Plan = plan;
+    view->Buf = (const uint8_t*) buf;
+    view->Entries = entries;
+    view->Len = len;
+    view->Vars = ret->Vars;
+    view->Resolved = 0;
+    view->Op = 0;
+    view->Pos = 0;
+    view->Depth = 0;
+    view->Error = size < ret->Vars;
 
-    return res;
+    return view->Error ? REFLEX_ERROR : REFLEX_OK;
 }
-#if REFLEX_SUPPORT_TYPE_POINTER
 /**
- * @brief This function find a field in complex pointer object
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param fieldFmt 
- * @param field 
- * @return Reflex_GetResult 
+ * @brief This function return scope of main object
+ *
+ * @param view
+ * @return Reflex_ViewRef
  */
-static Reflex_GetResult Reflex_Complex_Pointer_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
-    Reflex_GetResult res;
-    const Reflex_Schema* tmpSchema = reflex->Schema;
+Reflex_ViewRef Reflex_View_root(Reflex_View* view) {
+    Reflex_ViewRef ref;
 
-    __updateOffsetIndex(reflex);
-    reflex->Schema = fmt->Schema;
-    res = REFLEX_GET_FIELD[(uint8_t) reflex->Schema->FormatMode](reflex, *(void**) obj, fieldFmt, field);
-    reflex->Schema = tmpSchema;
-    __initMainObj(reflex, obj);
-    // move obj
-    reflex->PObj = Reflex_Pointer_moveAddress(obj, fmt);
+    ref.View = view;
+    ref.Op = 0;
+    ref.Var = 0;
 
-    return res;
+    return ref;
 }
-#endif // REFLEX_SUPPORT_TYPE_POINTER
-#if REFLEX_SUPPORT_TYPE_ARRAY
 /**
- * @brief This function find a field in complex array object
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param fieldFmt 
- * @param field 
- * @return Reflex_GetResult 
+ * @brief This function find a complex field in scope and return scope of an element of it,
+ * fields of element are not read, only presence byte of complex pointers is checked
+ *
+ * @param ref scope of complex field
+ * @param fmt format of complex field
+ * @param index index of element
+ * @param child scope of element
+ * @return uint8_t 1 if element found and it's not NULL, elements of complex pointers without fields are
+ * never found because their presence is not cached
  */
-static Reflex_GetResult Reflex_Complex_Array_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
-    Reflex_GetResult res = Reflex_GetResult_NotFound;
-    Reflex_LenType len = fmt->Len;
+uint8_t Reflex_View_child(const Reflex_ViewRef* ref, const void* fmt, Reflex_LenType index, Reflex_ViewRef* child) {
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    const Reflex_PlanOp* plan = ref->View->Plan;
+    const Reflex_PlanOp* op;
+    Reflex_LenType var;
+    Reflex_LenType vars;
 
-    while (len-- > 0 && res != Reflex_GetResult_Ok) {
-        res = Reflex_Complex_Primary_getField(reflex, obj, fmt, fieldFmt, field);
-        obj = reflex->PObj;
-    #if REFLEX_SUPPORT_BREAK_LAYER
-        if (reflex->BreakLayer) {
-            reflex->BreakLayer = 0;
-            break;
+    op = Reflex_View_find(ref, fmt, &var);
+    if (op == NULL || op->Code != Reflex_PlanCode_Begin || index < 0 || index >= Reflex_Complex_elements(&op->Params)) {
+        return 0;
+    }
+    // all elements have same fields, so ops of first element are used for all of them
+    vars = plan[op->Jump].Vars;
+    child->View = ref->View;
+    child->Op = (Reflex_LenType) (op - plan) + 1;
+    child->Var = var + index * vars;
+    if (vars == 0) {
+        switch (op->Params.Fields.Category) {
+        #if REFLEX_SUPPORT_TYPE_POINTER
+            case Reflex_Category_Pointer:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            case Reflex_Category_PointerArray:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+                // object may be NULL
+                return 0;
+        #endif
+            default:
+                return 1;
         }
-    #endif
     }
 
-    return res;
+    return Reflex_View_offset(ref->View, child->Var) >= 0;
+#else
+    return 0;
+#endif
 }
-#endif // REFLEX_SUPPORT_TYPE_ARRAY
-#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
 /**
- * @brief This function find a field in complex pointer array object
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param fieldFmt 
- * @param field 
- * @return Reflex_GetResult 
+ * @brief This function find a field in scope and return it's flat VarIndex,
+ * fields of complex fields are not in scope, use Reflex_View_child for them
+ *
+ * @param ref scope of field
+ * @param fmt format of field
+ * @return Reflex_LenType flat VarIndex, -1 if field not found
  */
-static Reflex_GetResult Reflex_Complex_PointerArray_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
-    Reflex_GetResult res = Reflex_GetResult_NotFound;
-    Reflex_LenType len = fmt->Len;
+Reflex_LenType Reflex_View_var(const Reflex_ViewRef* ref, const void* fmt) {
+    Reflex_LenType var;
+    const Reflex_PlanOp* op = Reflex_View_find(ref, fmt, &var);
 
-    while (len-- > 0 && res != Reflex_GetResult_Ok) {
-        res = Reflex_Complex_Pointer_getField(reflex, obj, fmt, fieldFmt, field);
-        obj = reflex->PObj;
-    #if REFLEX_SUPPORT_BREAK_LAYER
-        if (reflex->BreakLayer) {
-            reflex->BreakLayer = 0;
-            break;
-        }
-    #endif
+    return op != NULL && op->Code == Reflex_PlanCode_Field ? var : -1;
+}
+/**
+ * @brief This function return offset of field in buffer, buffer is walked until field
+ *
+ * @param view
+ * @param varIndex flat VarIndex of field
+ * @return Reflex_LenType offset of field, -1 if field not found, object of complex pointer is NULL or buffer is not valid
+ */
+Reflex_LenType Reflex_View_offset(Reflex_View* view, Reflex_LenType varIndex) {
+    if (varIndex < 0 || varIndex >= view->Vars) {
+        return -1;
+    }
+    while (view->Resolved <= varIndex && Reflex_View_step(view)) {
+        // walk until field is cached
     }
 
-    return res;
+    return view->Resolved > varIndex ? view->Entries[varIndex].Offset : -1;
 }
-#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
-#if REFLEX_SUPPORT_TYPE_ARRAY_2D
 /**
- * @brief This function find a field in complex 2D array object
- * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @param fieldFmt 
- * @param field 
- * @return Reflex_GetResult 
+ * @brief This function return address of an item of field in buffer,
+ * address is not aligned, use memcpy or typed getters for read it
+ *
+ * @param view
+ * @param varIndex flat VarIndex of field
+ * @param index index of item for arrays and pointer arrays, 0 for other fields
+ * @return const void* address of item, NULL if item not found or pointer is NULL
  */
-static Reflex_GetResult Reflex_Complex_Array2D_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
-    Reflex_GetResult res = Reflex_GetResult_NotFound;
-    Reflex_LenType len;
-    Reflex_LenType mlen = fmt->MLen;
+const void* Reflex_View_item(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index) {
+    Reflex_LenType offset = Reflex_View_offset(view, varIndex);
+    const Reflex_PlanOp* op;
+    Reflex_LenType itemSize;
+    Reflex_LenType len = 1;
 
-    while (mlen-- > 0 && res != Reflex_GetResult_Ok) {
-        len = fmt->Len;
-        while (len-- > 0 && res != Reflex_GetResult_Ok) {
-            res = Reflex_Complex_Primary_getField(reflex, obj, fmt, fieldFmt, field);
-            obj = reflex->PObj;
-        #if REFLEX_SUPPORT_BREAK_LAYER
-            if (reflex->BreakLayer) {
-                reflex->BreakLayer = 0;
+    if (offset < 0 || index < 0) {
+        return NULL;
+    }
+    op = &view->Plan[view->Entries[varIndex].Op];
+    itemSize = PRIMARY_TYPE_SIZE[op->Params.Fields.Primary];
+    switch (op->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (op->Params.Fields.Category == Reflex_Category_PointerArray) {
+                len = op->Params.Len;
+            }
+        #endif
+            if (index >= len) {
+                return NULL;
+            }
+            // presence bytes are checked when field is cached
+            while (index-- > 0) {
+                offset += view->Buf[offset] ? 1 + itemSize : 1;
+            }
+            return view->Buf[offset] ? &view->Buf[offset + 1] : NULL;
+    #endif
+        default:
+            return index < op->Bytes / itemSize ? &view->Buf[offset + index * itemSize] : NULL;
+    }
+}
+/**
+ * @brief These functions return an item of field, 0 if item not found or size of type is not same as field
+ *
+ * @param view
+ * @param varIndex flat VarIndex of field
+ * @param index index of item for arrays and pointer arrays, 0 for other fields
+ */
+__viewGetFn(Reflex_View_getChar, char)
+__viewGetFn(Reflex_View_getUInt8, uint8_t)
+__viewGetFn(Reflex_View_getInt8, int8_t)
+__viewGetFn(Reflex_View_getUInt16, uint16_t)
+__viewGetFn(Reflex_View_getInt16, int16_t)
+__viewGetFn(Reflex_View_getUInt32, uint32_t)
+__viewGetFn(Reflex_View_getInt32, int32_t)
+#if REFLEX_SUPPORT_TYPE_64BIT
+__viewGetFn(Reflex_View_getUInt64, uint64_t)
+__viewGetFn(Reflex_View_getInt64, int64_t)
+#endif
+__viewGetFn(Reflex_View_getFloat, float)
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+__viewGetFn(Reflex_View_getDouble, double)
+#endif
+#endif // REFLEX_SUPPORT_VIEW
+/* ------------------------------------------- Index API ------------------------------------------ */
+#if REFLEX_SUPPORT_INDEX
+/**
+ * @brief This function build index of fields of schema, after that getField is constant time
+ * fields of all elements of complex arrays are in index in scan order, getField find first occurrence
+ * of field same as Reflex_getField and getFieldAt find any field by flat VarIndex
+ * Note: obj is used for follow complex pointers, offsets are valid for objects that aligned same as obj
+ * Note 2: if entries is NULL, it's return maximum number of entries that index need
+ *
+ * @param index address of index object
+ * @param schema
+ * @param obj address of a valid object
+ * @param entries address of entries array
+ * @param size size of entries array
+ * @return Reflex_LenType number of entries, -1 if size is not enough or schema is too deep
+ */
+Reflex_LenType Reflex_Index_build(Reflex_Index* index, const Reflex_Schema* schema, void* obj, Reflex_IndexEntry* entries, Reflex_LenType size) {
+    Reflex reflex = {0};
+    Reflex_IndexBuilder builder = {0};
+    Reflex_LenType bucket;
+
+    if (entries == NULL) {
+        return Reflex_Index_count(schema, 0);
+    }
+
+    index->Schema = schema;
+    index->Entries = entries;
+    index->Len = 0;
+    index->Size = size;
+    for (bucket = 0; bucket < size; bucket++) {
+        entries[bucket].Head = -1;
+    }
+
+    builder.Index = index;
+    builder.Base = (uint8_t*) obj;
+    builder.Main = (uint8_t*) obj;
+    builder.BaseEntry = -1;
+    Reflex_init(&reflex, schema);
+    Reflex_setCallback(&reflex, Reflex_Index_onField);
+    Reflex_setArgs(&reflex, &builder);
+
+    if (Reflex_scan(&reflex, obj) != REFLEX_OK || builder.Error) {
+        return -1;
+    }
+
+    return index->Len;
+}
+/**
+ * @brief This function find a field with index in constant time
+ * it's fill field same as Reflex_getField
+ *
+ * @param index
+ * @param obj
+ * @param fieldFmt
+ * @param field
+ * @return Reflex_GetResult
+ */
+Reflex_GetResult Reflex_Index_getField(const Reflex_Index* index, void* obj, const void* fieldFmt, Reflex_Field* field) {
+    Reflex_LenType entry = Reflex_Index_find(index, fieldFmt);
+
+    if (entry < 0) {
+        return Reflex_GetResult_NotFound;
+    }
+    Reflex_Index_fill(index, &index->Entries[entry], obj, field);
+
+    return Reflex_GetResult_Ok;
+}
+#if REFLEX_SUPPORT_VAR_INDEX
+/**
+ * @brief This function find a field by flat VarIndex, it's value of Reflex_getVarIndex in scan
+ *
+ * @param index
+ * @param obj
+ * @param varIndex
+ * @param field
+ * @return Reflex_GetResult
+ */
+Reflex_GetResult Reflex_Index_getFieldAt(const Reflex_Index* index, void* obj, Reflex_LenType varIndex, Reflex_Field* field) {
+    const Reflex_IndexEntry* entries = index->Entries;
+    Reflex_LenType low = 0;
+    Reflex_LenType high = index->Len;
+    Reflex_LenType mid;
+
+    // entries are in scan order, so flat VarIndex is sorted
+    while (low < high) {
+        mid = low + ((high - low) >> 1);
+        if (entries[mid].VarIndex + entries[mid].VarOffset < varIndex) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    // complex fields have same VarIndex as their first field
+    while (low < index->Len && entries[low].Complex && entries[low].VarIndex + entries[low].VarOffset == varIndex) {
+        low++;
+    }
+    if (low >= index->Len || entries[low].VarIndex + entries[low].VarOffset != varIndex) {
+        return Reflex_GetResult_NotFound;
+    }
+    Reflex_Index_fill(index, &entries[low], obj, field);
+
+    return Reflex_GetResult_Ok;
+}
+#endif // REFLEX_SUPPORT_VAR_INDEX
+/**
+ * @brief This function scan over a single field that found with index
+ *
+ * @param reflex
+ * @param index
+ * @param obj
+ * @param fieldFmt
+ * @return Reflex_Result
+ */
+Reflex_Result Reflex_Index_scanField(Reflex* reflex, const Reflex_Index* index, void* obj, const void* fieldFmt) {
+    Reflex_Field field = {0};
+    Reflex_Result result = REFLEX_ERROR;
+
+    if (Reflex_Index_getField(index, obj, fieldFmt, &field) == Reflex_GetResult_Ok) {
+        result = Reflex_scanFieldRaw(reflex, &field, REFLEX_ON_FIELD_FNS[reflex->FunctionMode]);
+    }
+
+    return result;
+}
+#endif // REFLEX_SUPPORT_INDEX
+/* ------------------------------------------- Cursor API ----------------------------------------- */
+#if REFLEX_SUPPORT_CURSOR
+/**
+ * @brief This function initialize cursor for iterate over fields of object
+ * Note: cursor use reflex object same as scan functions, VarIndex, LayerIndex, MainObject and Break API are valid
+ *
+ * @param cursor
+ * @param reflex
+ * @param obj
+ */
+void Reflex_Cursor_begin(Reflex_Cursor* cursor, Reflex* reflex, void* obj) {
+    cursor->Handler = reflex;
+    cursor->Depth = 0;
+    cursor->Pending = 0;
+    cursor->Layers[0].Complex = NULL;
+    cursor->Layers[0].Entered = 1;
+    __initComplexParams(reflex, obj);
+    Reflex_Cursor_enter(reflex, &cursor->Layers[0], reflex->Schema, (uint8_t*) obj);
+}
+/**
+ * @brief This function move cursor to next field of object,
+ * fields, begin and end of complex fields come in same order as scan functions
+ *
+ * @param cursor
+ * @param field filled with address and format of field
+ * @return Reflex_CursorEvent Done when there is no more fields
+ */
+Reflex_CursorEvent Reflex_Cursor_next(Reflex_Cursor* cursor, Reflex_Field* field) {
+    Reflex* reflex = cursor->Handler;
+    Reflex_CursorLayer* layer;
+    const Reflex_TypeParams* fmt;
+    const Reflex_Type_Helper* helper;
+    uint8_t* pobj;
+    Reflex_LenType size;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_CursorLayer* child;
+#endif
+
+    if (cursor->Pending) {
+        cursor->Pending = 0;
+        __increaseVarIndex(reflex);
+    }
+    while (cursor->Depth >= 0) {
+        layer = &cursor->Layers[cursor->Depth];
+    #if REFLEX_SUPPORT_TYPE_COMPLEX
+        if (!layer->Entered) {
+            // enter first element after begin event
+            layer->Entered = 1;
+            __increaseLayerIndex(reflex);
+            if (Reflex_Complex_elements(layer->Complex) > 0) {
+                Reflex_Cursor_enter(reflex, layer, layer->Complex->Schema, layer->Field);
+                continue;
+            }
+            return Reflex_Cursor_leave(cursor, field);
+        }
+    #endif
+        if (layer->Len > 0) {
+            fmt = (const Reflex_TypeParams*) layer->Fmt;
+        #if REFLEX_FORMAT_MODE_PRIMARY
+            if (layer->Schema->FormatMode == Reflex_FormatMode_Primary) {
+                layer->Primary.Type = *(const uint8_t*) layer->Fmt;
+                fmt = &layer->Primary;
+            }
+            else
+        #endif
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            if (fmt->Fields.Primary == Reflex_PrimaryType_Complex) {
+                if (cursor->Depth >= REFLEX_MAX_DEPTH) {
+                    return Reflex_CursorEvent_Error;
+                }
+                child = &cursor->Layers[++cursor->Depth];
+                child->Complex = fmt;
+                child->Field = layer->PObj;
+                child->Index = 0;
+                child->Row = 0;
+                child->Entered = 0;
+                Reflex_Cursor_fill(reflex, field, child->Field, fmt);
+                return Reflex_CursorEvent_Begin;
+            }
+            else
+        #endif
+            {}
+            helper = &REFLEX_HELPER[fmt->Fields.Category];
+        #if REFLEX_FORMAT_MODE_OFFSET
+            if (layer->Schema->FormatMode == Reflex_FormatMode_Offset) {
+                pobj = layer->Obj + fmt->Offset;
+                layer->PObj = pobj;
+            }
+            else
+        #endif
+            {
+                pobj = helper->alignAddress(layer->PObj, fmt);
+                layer->PObj = helper->moveAddress(pobj, fmt);
+            }
+            Reflex_Cursor_fill(reflex, field, pobj, fmt);
+        #if REFLEX_FORMAT_MODE_PRIMARY
+            if (layer->Schema->FormatMode == Reflex_FormatMode_Primary) {
+                size = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+            }
+            else
+        #endif
+            {
+                size = helper->itemSize(fmt);
+            }
+            if (layer->BiggestField < size) {
+                layer->BiggestField = size;
+            }
+            // VarIndex increase in next call, same as after onField callback
+            cursor->Pending = 1;
+            // next fmt
+            layer->Fmt = (const uint8_t*) layer->Fmt + layer->FmtSize;
+            layer->Len--;
+            return Reflex_CursorEvent_Field;
+        }
+        // end of object
+    #if REFLEX_SUPPORT_TYPE_COMPLEX
+        reflex->PObj = Reflex_alignAddress(layer->PObj, layer->BiggestField);
+        if (reflex->AlignSize < layer->BiggestField) {
+            reflex->AlignSize = layer->BiggestField;
+        }
+        if (cursor->Depth > 0) {
+            pobj = Reflex_Cursor_nextElement(reflex, layer);
+            if (pobj != NULL) {
+                Reflex_Cursor_enter(reflex, layer, layer->Complex->Schema, pobj);
+                continue;
+            }
+            return Reflex_Cursor_leave(cursor, field);
+        }
+    #endif
+        cursor->Depth = -1;
+    }
+
+    return Reflex_CursorEvent_Done;
+}
+/**
+ * @brief This function leave innermost complex field of cursor without visit rest of it's fields,
+ * call it until return Done for leave all of complex fields, end events come in same order as scan functions
+ *
+ * @param cursor
+ * @param field filled with address and format of complex field
+ * @return Reflex_CursorEvent End for each open complex field, then Done
+ */
+Reflex_CursorEvent Reflex_Cursor_abort(Reflex_Cursor* cursor, Reflex_Field* field) {
+    Reflex* reflex = cursor->Handler;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_CursorLayer* layer;
+#endif
+
+    if (cursor->Pending) {
+        cursor->Pending = 0;
+        __increaseVarIndex(reflex);
+    }
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    if (cursor->Depth > 0) {
+        layer = &cursor->Layers[cursor->Depth];
+        if (layer->Entered) {
+            reflex->Schema = (layer - 1)->Schema;
+        }
+        else {
+            layer->Entered = 1;
+            __increaseLayerIndex(reflex);
+        }
+        return Reflex_Cursor_leave(cursor, field);
+    }
+#endif
+    cursor->Depth = -1;
+
+    return Reflex_CursorEvent_Done;
+}
+#endif // REFLEX_SUPPORT_CURSOR
+/* ------------------------------------------- Stack Scan API ----------------------------------------- */
+#if REFLEX_SUPPORT_STACK_SCAN
+/**
+ * @brief This function scan over all fields in object same as Reflex_scanRaw,
+ * nested complex fields kept in a bounded stack instead of recursion
+ * Note: begin and end callbacks, LayerIndex, VarOffset and Break API are same as Reflex_scanRaw
+ *
+ * @param reflex
+ * @param obj
+ * @param onField
+ * @return Reflex_Result REFLEX_ERROR if complex fields are deeper than REFLEX_MAX_DEPTH
+ */
+Reflex_Result Reflex_Stack_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn onField) {
+    Reflex_Result result = REFLEX_OK;
+    Reflex_Cursor cursor;
+    Reflex_Field field;
+    Reflex_CursorEvent event;
+
+    Reflex_Cursor_begin(&cursor, reflex, obj);
+    while (result == REFLEX_OK && (event = Reflex_Cursor_next(&cursor, &field)) != Reflex_CursorEvent_Done) {
+        switch (event) {
+            case Reflex_CursorEvent_Field:
+                if (onField) {
+                    result = onField(reflex, field.Object, field.Fmt);
+                }
                 break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_CursorEvent_Begin:
+                REFLEX_COMPLEX_BEGIN[reflex->FunctionMode](reflex, field.Object, field.Fmt);
+                break;
+            case Reflex_CursorEvent_End:
+                REFLEX_COMPLEX_END[reflex->FunctionMode](reflex, field.Object, field.Fmt);
+                break;
+        #endif
+            default:
+                result = REFLEX_ERROR;
+                break;
+        }
+    }
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // leave open complex fields, end callbacks called same as returning from recursive scan
+    while (Reflex_Cursor_abort(&cursor, &field) == Reflex_CursorEvent_End) {
+        REFLEX_COMPLEX_END[reflex->FunctionMode](reflex, field.Object, field.Fmt);
+    }
+#endif
+
+    return result;
+}
+/**
+ * @brief This function scan over all fields in object same as Reflex_scan,
+ * nested complex fields kept in a bounded stack instead of recursion
+ *
+ * @param reflex
+ * @param obj
+ * @return Reflex_Result
+ */
+Reflex_Result Reflex_Stack_scan(Reflex* reflex, void* obj) {
+    return Reflex_Stack_scanRaw(reflex, obj, REFLEX_ON_FIELD_FNS[reflex->FunctionMode]);
+}
+#endif // REFLEX_SUPPORT_STACK_SCAN
+/* ------------------------------------------- Batch Scan API ----------------------------------------- */
+#if REFLEX_SUPPORT_BATCH
+/**
+ * @brief This function scan over all fields in object and pass them to onFields in batches,
+ * fields are collected in a loop without any callback, so consumer can process them in a tight loop
+ * Note: begin and end of complex fields are not reported, break API is not supported
+ *
+ * @param reflex
+ * @param obj
+ * @param events buffer for events of each batch
+ * @param size number of events in buffer
+ * @param onFields
+ * @return Reflex_Result REFLEX_ERROR if complex fields are deeper than REFLEX_MAX_DEPTH or parameters are not valid
+ */
+Reflex_Result Reflex_Batch_scanRaw(Reflex* reflex, void* obj, Reflex_FieldEvent* events, Reflex_LenType size, Reflex_OnFieldsFn onFields) {
+    Reflex_Result result = REFLEX_OK;
+    Reflex_Cursor cursor;
+    Reflex_Field field;
+    Reflex_CursorEvent event;
+    Reflex_FieldEvent* pevent = events;
+    Reflex_FieldEvent* end;
+
+    if (events == NULL || size <= 0 || onFields == NULL) {
+        return REFLEX_ERROR;
+    }
+    end = events + size;
+
+    Reflex_Cursor_begin(&cursor, reflex, obj);
+    while ((event = Reflex_Cursor_next(&cursor, &field)) != Reflex_CursorEvent_Done) {
+        if (event == Reflex_CursorEvent_Field) {
+        #if REFLEX_FORMAT_MODE_PRIMARY
+            if (cursor.Layers[cursor.Depth].Schema->FormatMode == Reflex_FormatMode_Primary) {
+                // cursor already move to next type
+                pevent->PrimaryFmt = (const uint8_t*) cursor.Layers[cursor.Depth].Fmt - 1;
+            }
+            else
+        #endif
+            {
+                pevent->CustomFmt = field.CustomFmt;
             }
+            pevent->Object = field.Object;
+        #if REFLEX_SUPPORT_VAR_INDEX
+            pevent->VarIndex = Reflex_Field_getVarIndex(&field);
         #endif
+            pevent->Type = field.Fmt->Type;
+            if (++pevent == end) {
+                result = onFields(reflex, events, size);
+                pevent = events;
+                if (result != REFLEX_OK) {
+                    break;
+                }
+            }
+        }
+        else if (event == Reflex_CursorEvent_Error) {
+            result = REFLEX_ERROR;
+            break;
         }
     }
+    if (result == REFLEX_OK && pevent != events) {
+        result = onFields(reflex, events, (Reflex_LenType)(pevent - events));
+    }
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    // restore schema and layer index of reflex
+    while (Reflex_Cursor_abort(&cursor, &field) == Reflex_CursorEvent_End) {}
+#endif
 
-    return res;
+    return result;
 }
-#endif //REFLEX_SUPPORT_TYPE_ARRAY_2D
-#endif // REFLEX_SUPPORT_SCAN_FIELD
-#endif // REFLEX_SUPPORT_TYPE_COMPLEX
-#if REFLEX_SUPPORT_CALLBACK
 /**
- * @brief This is a helper function that call onField callback
+ * @brief This function scan over all fields in object and pass them to onFields in batches of REFLEX_BATCH_SIZE
+ *
+ * @param reflex
+ * @param obj
+ * @param onFields
+ * @return Reflex_Result
+ */
+Reflex_Result Reflex_Batch_scan(Reflex* reflex, void* obj, Reflex_OnFieldsFn onFields) {
+    Reflex_FieldEvent events[REFLEX_BATCH_SIZE];
+
+    return Reflex_Batch_scanRaw(reflex, obj, events, REFLEX_BATCH_SIZE, onFields);
+}
+#endif // REFLEX_SUPPORT_BATCH
+/* ---------------------- Private Functions (Implementation) ----------------------- */
+#if REFLEX_ARCH != REFLEX_ARCH_8BIT
+/**
+ * @brief This function align address of field,
+ * it is prevent hard fault
  * 
- * @param reflex 
- * @param obj 
- * @param fmt 
- * @return Reflex_Result 
+ * @param pValue 
+ * @param objSize objSize must be 2^x, ex: 1, 2, 4, 8
+ * @return void* 
  */
-static Reflex_Result Reflex_scan_Callback(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->onField(reflex, obj, fmt);
+static void* Reflex_alignAddress(void* pValue, Reflex_LenType objSize) {
+    Reflex_PtrType pobj = (Reflex_PtrType) pValue;
+    Reflex_PtrType pad;
+
+#if REFLEX_ARCH != REFLEX_ARCH_64BIT
+    if (objSize > REFLEX_ARCH_BYTES) {
+        objSize = REFLEX_ARCH_BYTES;
+    }
+#endif
+
+    if ((pad = pobj & ((Reflex_PtrType) objSize - 1)) != 0) {
+        pobj += objSize - pad;
+    }
+
+    return (void*) pobj;
 }
-#endif // REFLEX_SUPPORT_CALLBACK
-#if REFLEX_SUPPORT_DRIVER
+#endif // REFLEX_ARCH
+#if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
 /**
- * @brief This is a helper function that call callback of Driver
+ * @brief This function multiply size by len without overflow
+ * 
+ * @param size 
+ * @param len 
+ * @param result size * len
+ * @return Reflex_Result REFLEX_ERROR on overflow or negative len
+ */
+static Reflex_Result Reflex_mulSize(Reflex_PtrType size, Reflex_LenType len, Reflex_PtrType* result) {
+    if (len < 0 || (size != 0 && (Reflex_PtrType) len > ((Reflex_PtrType) ~0) / size)) {
+        return REFLEX_ERROR;
+    }
+    *result = size * (Reflex_PtrType) len;
+    return REFLEX_OK;
+}
+#endif
+#if REFLEX_SUPPORT_SIZE_FN
+/**
+ * @brief This function convert end address of object to size,
+ * return -1 if size not fit in Reflex_LenType
+ * 
+ * @param pobj 
+ * @return Reflex_LenType 
+ */
+static Reflex_LenType Reflex_toLen(const void* pobj) {
+    Reflex_PtrType size = (Reflex_PtrType) pobj;
+
+    if (size == (Reflex_PtrType) ~0 || (uint64_t) size > (uint64_t) REFLEX_LEN_MAX) {
+        return -1;
+    }
+    return (Reflex_LenType) size;
+}
+#endif // REFLEX_SUPPORT_SIZE_FN
+/**
+ * @brief This function return item size
  * 
- * @param reflex 
- * @param obj 
  * @param fmt 
- * @return Reflex_Result 
+ * @return Reflex_LenType 
  */
-static Reflex_Result Reflex_scan_Driver(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->Driver->Category[((const Reflex_TypeParams*) fmt)->Fields.Category]->fn[((const Reflex_TypeParams*) fmt)->Fields.Primary](reflex, obj, fmt);
+static Reflex_LenType Reflex_Primary_itemSize(const Reflex_TypeParams* fmt) {
+    return PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
 }
-#endif // REFLEX_SUPPORT_DRIVER
-#if REFLEX_SUPPORT_COMPACT
 /**
- * @brief This is a helper function that call callback of Compact functions
+ * @brief This function align address of field
  * 
- * @param reflex 
- * @param obj 
+ * @param pValue 
  * @param fmt 
- * @return Reflex_Result 
+ * @return void* 
  */
-static Reflex_Result Reflex_scan_Compact(Reflex* reflex, void* obj, const void* fmt) {
-    return reflex->CompactFns->fn[((const Reflex_TypeParams*) fmt)->Fields.Primary](reflex, obj, fmt);
+static void* Reflex_Primary_alignAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    return Reflex_alignAddress(pValue, PRIMARY_TYPE_SIZE[fmt->Fields.Primary]);
 }
-#endif //REFLEX_SUPPORT_COMPACT
+/**
+ * @brief This function move address of field based on field format
+ * 
+ * @param pValue 
+ * @param fmt 
+ * @return void* 
+ */
+static void* Reflex_Primary_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    Reflex_PtrType objSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+    return (uint8_t*) pValue + objSize;
+}
+#if REFLEX_SUPPORT_TYPE_POINTER
+/**
+ * @brief This function return item size
+ * 
+ * @param fmt 
+ * @return Reflex_LenType 
+ */
+static Reflex_LenType Reflex_Pointer_itemSize(const Reflex_TypeParams* fmt) {
+    return sizeof(void*);
+}
+/**
+ * @brief This function align address of pointer field
+ * 
+ * @param pValue 
+ * @param fmt 
+ * @return void* 
+ */
+static void* Reflex_Pointer_alignAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    return Reflex_alignAddress(pValue, sizeof(void*));
+}
+/**
+ * @brief This function move address of field
+ * 
+ * @param pValue 
+ * @param fmt 
+ * @return void* 
+ */
+static void* Reflex_Pointer_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    Reflex_PtrType objSize = sizeof(void*);
+    return (uint8_t*) pValue + objSize;
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER
+#if REFLEX_SUPPORT_TYPE_ARRAY
+/**
+ * @brief This function move address of array field
+ * 
+ * @param pValue 
+ * @param fmt 
+ * @return void* REFLEX_ADDRESS_OVERFLOW if size of field overflowed
+ */
+static void* Reflex_Array_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    Reflex_PtrType objSize;
+    if (Reflex_mulSize(PRIMARY_TYPE_SIZE[fmt->Fields.Primary], fmt->Len, &objSize) != REFLEX_OK) {
+        return REFLEX_ADDRESS_OVERFLOW;
+    }
+    return (uint8_t*) pValue + objSize;
+}
+#endif // REFLEX_SUPPORT_TYPE_ARRAY
+#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+/**
+ * @brief This function move address of pointer array field
+ * 
+ * @param pValue 
+ * @param fmt 
+ * @return void* REFLEX_ADDRESS_OVERFLOW if size of field overflowed
+ */
+static void* Reflex_PointerArray_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    Reflex_PtrType objSize;
+    if (Reflex_mulSize(sizeof(void*), fmt->Len, &objSize) != REFLEX_OK) {
+        return REFLEX_ADDRESS_OVERFLOW;
+    }
+    return (uint8_t*) pValue + objSize;
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+#if REFLEX_SUPPORT_TYPE_ARRAY_2D
+/**
+ * @brief This function move address of 2D array field
+ * 
+ * @param pValue 
+ * @param fmt 
+ * @return void* REFLEX_ADDRESS_OVERFLOW if size of field overflowed
+ */
+static void* Reflex_Array2D_moveAddress(void* pValue, const Reflex_TypeParams* fmt) {
+    Reflex_PtrType objSize;
+    if (Reflex_mulSize(PRIMARY_TYPE_SIZE[fmt->Fields.Primary], fmt->Len, &objSize) != REFLEX_OK ||
+        Reflex_mulSize(objSize, fmt->MLen, &objSize) != REFLEX_OK) {
+        return REFLEX_ADDRESS_OVERFLOW;
+    }
+    return (uint8_t*) pValue + objSize;
+}
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+#if REFLEX_SUPPORT_DRIVER
+/**
+ * @brief This is a helper function for call begin driver callback
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Begin_Driver(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->Driver->Category[((const Reflex_TypeParams*) fmt)->Fields.Category]->fnComplexBegin(reflex, obj, fmt);
+}
+/**
+ * @brief This is a helper function for call end driver callback
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_End_Driver(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->Driver->Category[((const Reflex_TypeParams*) fmt)->Fields.Category]->fnComplexEnd(reflex, obj, fmt);
+}
+#endif // REFLEX_SUPPORT_DRIVER
+#if REFLEX_SUPPORT_COMPACT
+/**
+ * @brief This is a helper function for call begin compact callback
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Begin_Compact(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->CompactFns->fnComplexBegin(reflex, obj, fmt);
+}
+/**
+ * @brief This is a helper function for call end compact callback
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_End_Compact(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->CompactFns->fnComplexEnd(reflex, obj, fmt);
+}
+#endif // REFLEX_SUPPORT_COMPACT
+/**
+ * @brief This function run scan function over a complex field
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param onField 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Primary_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt ,Reflex_OnFieldFn onField) {
+    return Reflex_Complex_Element_scan(reflex, obj, fmt, onField, 0);
+}
+/**
+ * @brief This function run scan function over an element of complex field,
+ * for elements with fixed layout stride is known and layout of element is not computed again
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param onField 
+ * @param stride distance between elements, 0 if it's unknown
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Element_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField, Reflex_LenType stride) {
+    Reflex_Result res;
+    const Reflex_Schema* tmpSchema = reflex->Schema;
+
+    __updateOffsetIndex(reflex);
+    reflex->Schema = fmt->Schema;
+    res = REFLEX_SCAN_ELEMENT[(uint8_t) reflex->Schema->FormatMode](reflex, obj, onField, stride);
+    reflex->Schema = tmpSchema;
+
+    return res;
+}
+#if REFLEX_SUPPORT_TYPE_POINTER
+/**
+ * @brief This function run scan function over a complex pointer field
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param onField 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Pointer_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
+    Reflex_Result res;
+    const Reflex_Schema* tmpSchema = reflex->Schema;
+
+    // elements of pointer arrays are prefetched before
+    if (fmt->Fields.Category == Reflex_Category_Pointer) {
+        __prefetchElements(obj, 0, 1);
+    }
+    __updateOffsetIndex(reflex);
+    reflex->Schema = fmt->Schema;
+    res = REFLEX_SCAN[(uint8_t) reflex->Schema->FormatMode](reflex, *(void**) obj, onField);
+    reflex->Schema = tmpSchema;
+    __initMainObj(reflex, obj);
+    // move obj
+    reflex->PObj = Reflex_Pointer_moveAddress(obj, fmt);
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER
+#if REFLEX_SUPPORT_TYPE_ARRAY
+/**
+ * @brief This function run scan function over a complex array field
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param onField 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Array_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
+    Reflex_Result res = REFLEX_OK;
+    Reflex_LenType len = fmt->Len;
+    Reflex_LenType stride = 0;
+    Reflex_LenType alignSize;
+    void* first = obj;
+
+    while (len-- > 0 && res == REFLEX_OK) {
+        alignSize = reflex->AlignSize;
+        res = Reflex_Complex_Element_scan(reflex, obj, fmt, onField, stride);
+        __nextElement(reflex, obj, first, stride, alignSize);
+        __breakScanArray(reflex);
+    }
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_ARRAY
+#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+/**
+ * @brief This function run scan function over a complex pointer array field
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param onField 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_PointerArray_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
+    Reflex_Result res = REFLEX_OK;
+    Reflex_LenType len = fmt->Len;
+    void* const* items = (void* const*) obj;
+
+    while (len-- > 0 && res == REFLEX_OK) {
+        __prefetchElements(items, (Reflex_LenType) ((void* const*) obj - items), fmt->Len);
+        res = Reflex_Complex_Pointer_scan(reflex, obj, fmt, onField);
+        obj = (uint8_t*) obj + sizeof(void*);
+        __breakScanArray(reflex);
+    }
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+#if REFLEX_SUPPORT_TYPE_ARRAY_2D
+/**
+ * @brief This function run scan function over a complex 2D array field
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param onField 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_Complex_Array2D_scan(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, Reflex_OnFieldFn onField) {
+    Reflex_Result res = REFLEX_OK;
+    Reflex_LenType len;
+    Reflex_LenType mlen = fmt->MLen;
+    Reflex_LenType stride = 0;
+    Reflex_LenType alignSize;
+    void* first = obj;
+
+    while (mlen-- > 0 && res == REFLEX_OK) {
+        len = fmt->Len;
+        while (len-- > 0 && res == REFLEX_OK) {
+            alignSize = reflex->AlignSize;
+            res = Reflex_Complex_Element_scan(reflex, obj, fmt, onField, stride);
+            __nextElement(reflex, obj, first, stride, alignSize);
+            __breakScanArray(reflex);
+        }
+        __breakScanArray2D(reflex);
+    }
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_ARRAY_2D
+#if REFLEX_SUPPORT_SCAN_FIELD
+/**
+ * @brief This function find a field in complex object
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param fieldFmt 
+ * @param field 
+ * @return Reflex_GetResult 
+ */
+static Reflex_GetResult Reflex_Complex_Primary_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
+    Reflex_GetResult res;
+    const Reflex_Schema* tmpSchema = reflex->Schema;
+
+    __updateOffsetIndex(reflex);
+    reflex->Schema = fmt->Schema;
+    res = REFLEX_GET_FIELD[(uint8_t) reflex->Schema->FormatMode](reflex, obj, fieldFmt, field);
+    reflex->Schema = tmpSchema;
+
+    return res;
+}
+#if REFLEX_SUPPORT_TYPE_POINTER
+/**
+ * @brief This function find a field in complex pointer object
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param fieldFmt 
+ * @param field 
+ * @return Reflex_GetResult 
+ */
+static Reflex_GetResult Reflex_Complex_Pointer_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
+    Reflex_GetResult res;
+    const Reflex_Schema* tmpSchema = reflex->Schema;
+
+    __updateOffsetIndex(reflex);
+    reflex->Schema = fmt->Schema;
+    res = REFLEX_GET_FIELD[(uint8_t) reflex->Schema->FormatMode](reflex, *(void**) obj, fieldFmt, field);
+    reflex->Schema = tmpSchema;
+    __initMainObj(reflex, obj);
+    // move obj
+    reflex->PObj = Reflex_Pointer_moveAddress(obj, fmt);
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER
+#if REFLEX_SUPPORT_TYPE_ARRAY
+/**
+ * @brief This function find a field in complex array object
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param fieldFmt 
+ * @param field 
+ * @return Reflex_GetResult 
+ */
+static Reflex_GetResult Reflex_Complex_Array_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
+    Reflex_GetResult res = Reflex_GetResult_NotFound;
+    Reflex_LenType len = fmt->Len;
+    Reflex_LenType stride;
+    Reflex_LenType alignSize;
+    void* first = obj;
+
+    while (len-- > 0 && res != Reflex_GetResult_Ok) {
+        alignSize = reflex->AlignSize;
+        res = Reflex_Complex_Primary_getField(reflex, obj, fmt, fieldFmt, field);
+        // all elements have same fields, skip rest of elements when layout is fixed
+        if (res == Reflex_GetResult_NotFound && len > 0 && obj != first &&
+            (stride = Reflex_Complex_stride(reflex, obj, alignSize)) != 0) {
+            Reflex_Complex_skip(reflex, reflex->PObj, stride, len);
+            return res;
+        }
+        obj = reflex->PObj;
+    #if REFLEX_SUPPORT_BREAK_LAYER
+        if (reflex->BreakLayer) {
+            reflex->BreakLayer = 0;
+            break;
+        }
+    #endif
+    }
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_ARRAY
+#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+/**
+ * @brief This function find a field in complex pointer array object
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param fieldFmt 
+ * @param field 
+ * @return Reflex_GetResult 
+ */
+static Reflex_GetResult Reflex_Complex_PointerArray_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
+    Reflex_GetResult res = Reflex_GetResult_NotFound;
+    Reflex_LenType len = fmt->Len;
+
+    while (len-- > 0 && res != Reflex_GetResult_Ok) {
+        res = Reflex_Complex_Pointer_getField(reflex, obj, fmt, fieldFmt, field);
+        // all elements have same fields, skip rest of pointers
+        if (res == Reflex_GetResult_NotFound && len > 0) {
+            Reflex_Complex_skip(reflex, reflex->PObj, sizeof(void*), len);
+            return res;
+        }
+        obj = reflex->PObj;
+    #if REFLEX_SUPPORT_BREAK_LAYER
+        if (reflex->BreakLayer) {
+            reflex->BreakLayer = 0;
+            break;
+        }
+    #endif
+    }
+
+    return res;
+}
+#endif // REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+#if REFLEX_SUPPORT_TYPE_ARRAY_2D
+/**
+ * @brief This function find a field in complex 2D array object
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @param fieldFmt 
+ * @param field 
+ * @return Reflex_GetResult 
+ */
+static Reflex_GetResult Reflex_Complex_Array2D_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field) {
+    Reflex_GetResult res = Reflex_GetResult_NotFound;
+    Reflex_LenType len;
+    Reflex_LenType mlen = fmt->MLen;
+    Reflex_LenType stride;
+    Reflex_LenType alignSize;
+    void* first = obj;
+
+    while (mlen-- > 0 && res != Reflex_GetResult_Ok) {
+        len = fmt->Len;
+        while (len-- > 0 && res != Reflex_GetResult_Ok) {
+            alignSize = reflex->AlignSize;
+            res = Reflex_Complex_Primary_getField(reflex, obj, fmt, fieldFmt, field);
+            // all elements have same fields, skip rest of elements when layout is fixed
+            if (res == Reflex_GetResult_NotFound && (len > 0 || mlen > 0) && obj != first &&
+                (stride = Reflex_Complex_stride(reflex, obj, alignSize)) != 0) {
+                Reflex_Complex_skip(reflex, reflex->PObj, stride, len + mlen * fmt->Len);
+                return res;
+            }
+            obj = reflex->PObj;
+        #if REFLEX_SUPPORT_BREAK_LAYER
+            if (reflex->BreakLayer) {
+                reflex->BreakLayer = 0;
+                break;
+            }
+        #endif
+        }
+    }
+
+    return res;
+}
+#endif //REFLEX_SUPPORT_TYPE_ARRAY_2D
+/**
+ * @brief This function skip rest of elements of a complex array in getField
+ * it's update reflex parameters same as getField over each element
+ * 
+ * @param reflex 
+ * @param obj address of first skipped element
+ * @param stride distance between elements
+ * @param count number of skipped elements
+ */
+static void Reflex_Complex_skip(Reflex* reflex, void* obj, Reflex_LenType stride, Reflex_LenType count) {
+    __initMainObj(reflex, (uint8_t*) obj + (Reflex_PtrType) stride * (count - 1));
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->VarOffset += reflex->VarIndex * count;
+#endif
+    reflex->PObj = (uint8_t*) obj + (Reflex_PtrType) stride * count;
+}
+/**
+ * @brief This function return alignment of first element of complex field, it's item size of first field
+ * of schema, elements that begin with a complex field are not aligned
+ * 
+ * @param schema schema of complex field
+ * @return Reflex_LenType 
+ */
+static Reflex_LenType Reflex_Complex_alignSize(const Reflex_Schema* schema) {
+    const Reflex_TypeParams* fmt = schema->Fmt;
+
+    if (schema->Len <= 0) {
+        return 1;
+    }
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (schema->FormatMode == Reflex_FormatMode_Primary) {
+        Reflex_TypeParams primary = {0};
+        primary.Type = schema->PrimaryFmt[0];
+        return PRIMARY_TYPE_SIZE[primary.Fields.Primary];
+    }
+#endif
+    if (fmt->Fields.Primary == Reflex_PrimaryType_Complex) {
+        return 1;
+    }
+
+    return REFLEX_HELPER[fmt->Fields.Category].itemSize(fmt);
+}
+#endif // REFLEX_SUPPORT_SCAN_FIELD
+#if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
+/**
+ * @brief This function return distance between scanned element and next element of complex array
+ * if layout of next elements is fixed, otherwise return 0
+ * Note: elements after first element start at end of previous element, so they are aligned to their biggest field
+ * and layout of them is fixed when AlignSize not changed, it must not be called for first element
+ * 
+ * @param reflex 
+ * @param obj address of scanned element
+ * @param alignSize value of reflex->AlignSize before scan element
+ * @return Reflex_LenType 
+ */
+static Reflex_LenType Reflex_Complex_stride(Reflex* reflex, void* obj, Reflex_LenType alignSize) {
+    if (reflex->AlignSize != alignSize) {
+        return 0;
+    }
+
+    return (Reflex_LenType) ((uint8_t*) reflex->PObj - (uint8_t*) obj);
+}
+#endif // REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
+#if REFLEX_SUPPORT_PLAN || REFLEX_SUPPORT_CURSOR
+/**
+ * @brief This function return number of elements of complex field
+ *
+ * @param fmt
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Complex_elements(const Reflex_TypeParams* fmt) {
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            return fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            return fmt->Len * fmt->MLen;
+    #endif
+        default:
+            return 1;
+    }
+}
+#endif // REFLEX_SUPPORT_PLAN || REFLEX_SUPPORT_CURSOR || REFLEX_SUPPORT_INDEX
+#if REFLEX_PREFETCH_DISTANCE > 0 && (defined(__GNUC__) || defined(__clang__)) && (REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY)
+/**
+ * @brief This function prefetch first cache lines of objects of a pointer complex field,
+ * on first element objects of element until element + REFLEX_PREFETCH_DISTANCE are prefetched,
+ * on next elements only object at distance is new
+ *
+ * @param items address of first pointer
+ * @param index index of current element
+ * @param len number of elements
+ */
+static void Reflex_Complex_prefetch(void* const* items, Reflex_LenType index, Reflex_LenType len) {
+    Reflex_LenType next = index == 0 ? 0 : index + REFLEX_PREFETCH_DISTANCE;
+    Reflex_LenType end = index + REFLEX_PREFETCH_DISTANCE < len ? index + REFLEX_PREFETCH_DISTANCE : len - 1;
+    Reflex_PtrType addr;
+    Reflex_LenType line;
+
+    for (; next <= end; next++) {
+        addr = (Reflex_PtrType) items[next];
+        if (addr != 0) {
+            for (line = 0; line < REFLEX_PREFETCH_LINES; line++) {
+                __builtin_prefetch((const void*) (addr + (Reflex_PtrType) line * REFLEX_CACHE_LINE_SIZE), 0, 3);
+            }
+        }
+    }
+}
+#endif // REFLEX_PREFETCH_DISTANCE
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+#if REFLEX_SUPPORT_CALLBACK
+/**
+ * @brief This is a helper function that call onField callback
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_scan_Callback(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->onField(reflex, obj, fmt);
+}
+#endif // REFLEX_SUPPORT_CALLBACK
+#if REFLEX_SUPPORT_DRIVER
+/**
+ * @brief This is a helper function that call callback of Driver
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_scan_Driver(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->Driver->Category[((const Reflex_TypeParams*) fmt)->Fields.Category]->fn[((const Reflex_TypeParams*) fmt)->Fields.Primary](reflex, obj, fmt);
+}
+#endif // REFLEX_SUPPORT_DRIVER
+#if REFLEX_SUPPORT_COMPACT
+/**
+ * @brief This is a helper function that call callback of Compact functions
+ * 
+ * @param reflex 
+ * @param obj 
+ * @param fmt 
+ * @return Reflex_Result 
+ */
+static Reflex_Result Reflex_scan_Compact(Reflex* reflex, void* obj, const void* fmt) {
+    return reflex->CompactFns->fn[((const Reflex_TypeParams*) fmt)->Fields.Primary](reflex, obj, fmt);
+}
+#endif //REFLEX_SUPPORT_COMPACT
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function append an op into plan, if plan is full it's only count ops
+ *
+ * @param compiler
+ * @param code Reflex_PlanCode
+ * @param fmt address of field format, NULL means use copy of params
+ * @param params
+ * @param offset offset of field from base of current object
+ * @return Reflex_LenType index of op
+ */
+static Reflex_LenType Reflex_Plan_emit(Reflex_PlanCompiler* compiler, Reflex_PlanCode code, const void* fmt, const Reflex_TypeParams* params, Reflex_LenType offset) {
+    Reflex_PlanOp* op;
+
+    if (compiler->Ops != NULL && compiler->Len < compiler->Size) {
+        op = &compiler->Ops[compiler->Len];
+        op->Params = *params;
+        op->Fmt = fmt != NULL ? fmt : &op->Params;
+        op->Offset = offset;
+        op->Stride = 0;
+        op->Jump = compiler->Len + 1;
+        op->Vars = code == Reflex_PlanCode_Field;
+        op->Bytes = 0;
+        op->Code = (uint8_t) code;
+    }
+    if (code == Reflex_PlanCode_Field) {
+        compiler->Vars++;
+    }
+
+    return compiler->Len++;
+}
+/**
+ * @brief This function compile fields of schema, it's mirror address calculation of scan functions
+ *
+ * @param compiler
+ * @param schema
+ * @param obj address of object, offsets are relative to it
+ * @return Reflex_LenType biggest field of object
+ */
+static Reflex_LenType Reflex_Plan_compileSchema(Reflex_PlanCompiler* compiler, const Reflex_Schema* schema, uint8_t* obj) {
+    Reflex_TypeParams primaryFmt = {0};
+    uint8_t* pobj = obj;
+    const Reflex_Type_Helper* helper;
+    const Reflex_TypeParams* fmt = schema->Fmt;
+    const Reflex_TypeParams* fieldFmt;
+    Reflex_LenType index;
+    Reflex_LenType biggestField = 1;
+    Reflex_LenType tmpSize;
+    Reflex_LenType op;
+    __isCustom_init(schema);
+
+    for (index = 0; index < schema->Len; index++) {
+        fieldFmt = fmt;
+    #if REFLEX_FORMAT_MODE_PRIMARY
+        if (schema->FormatMode == Reflex_FormatMode_Primary) {
+            primaryFmt.Type = schema->PrimaryFmt[index];
+            fmt = &primaryFmt;
+            fieldFmt = NULL;
+        }
+    #endif
+        helper = &REFLEX_HELPER[fmt->Fields.Category];
+    #if REFLEX_SUPPORT_TYPE_COMPLEX
+        if (fieldFmt != NULL && fmt->Fields.Primary == Reflex_PrimaryType_Complex) {
+            Reflex_Plan_compileComplex(compiler, fmt, pobj, obj);
+            __updateBiggestField(compiler->AlignSize);
+            pobj = compiler->PObj;
+        }
+        else
+    #endif
+        {
+        #if REFLEX_FORMAT_MODE_OFFSET
+            if (schema->FormatMode == Reflex_FormatMode_Offset) {
+                pobj = obj + fmt->Offset;
+            }
+            else
+        #endif
+            {
+                pobj = helper->alignAddress(pobj, fmt);
+            }
+            op = Reflex_Plan_emit(compiler, Reflex_PlanCode_Field, fieldFmt, fmt, (Reflex_LenType) (pobj - obj));
+            tmpSize = Reflex_Plan_bytes(helper, fmt, pobj);
+            compiler->Bytes += tmpSize;
+            if (compiler->Ops != NULL && op < compiler->Size) {
+                compiler->Ops[op].Bytes = tmpSize;
+            }
+        #if REFLEX_FORMAT_MODE_OFFSET
+            if (schema->FormatMode != Reflex_FormatMode_Offset)
+        #endif
+            {
+                pobj = helper->moveAddress(pobj, fmt);
+            }
+            tmpSize = fieldFmt != NULL ? helper->itemSize(fmt) : PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+            __updateBiggestField(tmpSize);
+        }
+        // next fmt
+        if (fieldFmt != NULL) {
+            __nextFmt(schema, fmt);
+        }
+    }
+    // align object
+    compiler->PObj = Reflex_alignAddress(pobj, biggestField);
+    if (compiler->AlignSize < biggestField) {
+        compiler->AlignSize = biggestField;
+    }
+
+    return biggestField;
+}
+/**
+ * @brief This function return bytes of field in memory of object,
+ * pointers are not counted because they are not copyable
+ *
+ * @param helper
+ * @param fmt
+ * @param pobj address of field
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Plan_bytes(const Reflex_Type_Helper* helper, const Reflex_TypeParams* fmt, uint8_t* pobj) {
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            return 0;
+    #endif
+        default:
+            return (Reflex_LenType) ((uint8_t*) helper->moveAddress(pobj, fmt) - pobj);
+    }
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function compile a complex field into Begin, element ops and End,
+ * if first element of array has different layout it's compiled separately and followed by Next op
+ *
+ * @param compiler
+ * @param fmt format of complex field
+ * @param obj address of complex field
+ * @param base address of current object
+ */
+static void Reflex_Plan_compileComplex(Reflex_PlanCompiler* compiler, const Reflex_TypeParams* fmt, uint8_t* obj, uint8_t* base) {
+    Reflex_LenType begin;
+    Reflex_LenType next = -1;
+    Reflex_LenType body;
+    Reflex_LenType end;
+    Reflex_LenType count = Reflex_Complex_elements(fmt);
+    Reflex_LenType biggestField;
+    Reflex_LenType stride = 0;
+    Reflex_LenType firstStride = 0;
+    Reflex_LenType vars = compiler->Vars;
+    Reflex_LenType fields = 0;
+    Reflex_LenType bytes = compiler->Bytes;
+    Reflex_LenType fieldsBytes = 0;
+    uint8_t* pobj;
+
+    if (++compiler->Depth > REFLEX_MAX_DEPTH) {
+        compiler->Error = 1;
+    }
+    begin = Reflex_Plan_emit(compiler, Reflex_PlanCode_Begin, fmt, fmt, (Reflex_LenType) (obj - base));
+    body = compiler->Len;
+
+    if (count > 0) {
+        switch (fmt->Fields.Category) {
+        #if REFLEX_SUPPORT_TYPE_POINTER
+            case Reflex_Category_Pointer:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            case Reflex_Category_PointerArray:
+        #endif
+            #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+                // all elements are separate objects
+                Reflex_Plan_compileSchema(compiler, fmt->Schema, (uint8_t*) 0);
+                fields = compiler->Vars - vars;
+                compiler->PObj = obj + sizeof(void*) * count;
+                break;
+            #endif
+            default:
+                biggestField = Reflex_Plan_compileSchema(compiler, fmt->Schema, obj);
+                fields = compiler->Vars - vars;
+                fieldsBytes = compiler->Bytes - bytes;
+                pobj = compiler->PObj;
+                stride = (Reflex_LenType) (pobj - obj);
+                if (count > 1 && ((Reflex_PtrType) obj & ((Reflex_PtrType) biggestField - 1)) != 0) {
+                    // first element is not aligned, other elements have same layout as second one
+                    firstStride = stride;
+                    next = Reflex_Plan_emit(compiler, Reflex_PlanCode_Next, fmt, fmt, (Reflex_LenType) (obj - base));
+                    body = compiler->Len;
+                    Reflex_Plan_compileSchema(compiler, fmt->Schema, pobj);
+                    stride = (Reflex_LenType) (compiler->PObj - pobj);
+                }
+                compiler->PObj = pobj + stride * (count - 1);
+                break;
+        }
+    }
+    // fields of all elements, objects of pointers are not in memory of complex field so fieldsBytes is zero for them
+    compiler->Vars = vars + fields * count;
+    compiler->Bytes = bytes + fieldsBytes * count;
+    // size of all elements
+    if (compiler->Ops != NULL && begin < compiler->Size) {
+        compiler->Ops[begin].Stride = (Reflex_LenType) (compiler->PObj - obj);
+        compiler->Ops[begin].Vars = fields * count;
+        compiler->Ops[begin].Bytes = fieldsBytes * count;
+    }
+
+    end = Reflex_Plan_emit(compiler, Reflex_PlanCode_End, fmt, fmt, (Reflex_LenType) (obj - base));
+    // link ops
+    if (compiler->Ops != NULL && end < compiler->Size) {
+        compiler->Ops[begin].Jump = end;
+        compiler->Ops[end].Stride = stride;
+        compiler->Ops[end].Jump = body;
+        compiler->Ops[end].Vars = fields;
+        if (next >= 0) {
+            compiler->Ops[next].Stride = firstStride;
+            compiler->Ops[next].Vars = fields;
+        }
+    }
+    compiler->Depth--;
+}
+/**
+ * @brief This function return address of current element of complex field
+ *
+ * @param frame
+ * @param pobj address of previous element
+ * @param stride distance between previous element and current element
+ * @return uint8_t*
+ */
+static uint8_t* Reflex_Plan_element(const Reflex_PlanFrame* frame, uint8_t* pobj, Reflex_LenType stride) {
+    switch (frame->Begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            __prefetchElements(frame->Field, frame->Index, Reflex_Complex_elements(&frame->Begin->Params));
+            return (uint8_t*) ((void**) frame->Field)[frame->Index];
+    #endif
+        default:
+            return pobj + stride;
+    }
+}
+/**
+ * @brief This function check there is another element in complex field,
+ * it's follow break layer rules of complex scan functions
+ *
+ * @param reflex
+ * @param frame
+ * @param result result of last element
+ * @return uint8_t 1 if next element must be scanned
+ */
+static uint8_t Reflex_Plan_nextElement(Reflex* reflex, Reflex_PlanFrame* frame, Reflex_Result result) {
+    const Reflex_TypeParams* fmt = &frame->Begin->Params;
+
+    frame->Index++;
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        #if REFLEX_SUPPORT_BREAK_LAYER
+            if (reflex->BreakLayer) {
+                reflex->BreakLayer = 0;
+                return 0;
+            }
+        #endif
+            return result == REFLEX_OK && frame->Index < fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+        #if REFLEX_SUPPORT_BREAK_LAYER
+            if (reflex->BreakLayer) {
+                reflex->BreakLayer = 0;
+                frame->Column = fmt->Len;
+            }
+            else
+        #endif
+            {
+                frame->Column++;
+            }
+            if (frame->Column >= fmt->Len || result != REFLEX_OK) {
+                // end of row
+                frame->Column = 0;
+                frame->Row++;
+            #if REFLEX_SUPPORT_BREAK_LAYER
+                if (reflex->BreakLayer2D) {
+                    reflex->BreakLayer = 0;
+                    reflex->BreakLayer2D = 0;
+                    return 0;
+                }
+            #endif
+                return result == REFLEX_OK && frame->Row < fmt->MLen;
+            }
+            return 1;
+    #endif
+        default:
+            return 0;
+    }
+}
+/**
+ * @brief This function return address of parent object after leave complex field,
+ * if scan of elements was broken, next fields move back same as scan functions
+ *
+ * @param frame
+ * @param pobj address of next element
+ * @return uint8_t*
+ */
+static uint8_t* Reflex_Plan_leave(const Reflex_PlanFrame* frame, uint8_t* pobj) {
+    switch (frame->Begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            return frame->Parent;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            return frame->Parent + (Reflex_LenType) sizeof(void*) * (frame->Index - frame->Begin->Params.Len);
+    #endif
+        default:
+            return frame->Parent + (pobj - (frame->Field + frame->Begin->Stride));
+    }
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function return final callback of op for FunctionMode of reflex,
+ * it's same callback that scan functions find for each field
+ *
+ * @param reflex
+ * @param op
+ * @return Reflex_OnFieldFn NULL for ops without callback
+ */
+static Reflex_OnFieldFn Reflex_Plan_resolve(const Reflex* reflex, const Reflex_PlanOp* op) {
+    const Reflex_TypeParams* fmt = &op->Params;
+
+    switch (reflex->FunctionMode) {
+    #if REFLEX_SUPPORT_CALLBACK
+        case Reflex_FunctionMode_Callback:
+            return op->Code == Reflex_PlanCode_Next ? NULL : reflex->onField;
+    #endif
+    #if REFLEX_SUPPORT_DRIVER
+        case Reflex_FunctionMode_Driver:
+            switch (op->Code) {
+                case Reflex_PlanCode_Field:
+                    return reflex->Driver->Category[fmt->Fields.Category]->fn[fmt->Fields.Primary];
+            #if REFLEX_SUPPORT_TYPE_COMPLEX
+                case Reflex_PlanCode_Begin:
+                    return reflex->Driver->Category[fmt->Fields.Category]->fnComplexBegin;
+                case Reflex_PlanCode_End:
+                    return reflex->Driver->Category[fmt->Fields.Category]->fnComplexEnd;
+            #endif
+                default:
+                    return NULL;
+            }
+    #endif
+    #if REFLEX_SUPPORT_COMPACT
+        case Reflex_FunctionMode_Compact:
+            switch (op->Code) {
+                case Reflex_PlanCode_Field:
+                    return reflex->CompactFns->fn[fmt->Fields.Primary];
+            #if REFLEX_SUPPORT_TYPE_COMPLEX
+                case Reflex_PlanCode_Begin:
+                    return reflex->CompactFns->fnComplexBegin;
+                case Reflex_PlanCode_End:
+                    return reflex->CompactFns->fnComplexEnd;
+            #endif
+                default:
+                    return NULL;
+            }
+    #endif
+        default:
+            return NULL;
+    }
+}
+/**
+ * @brief This callback do nothing, it's bound to ops without callback
+ *
+ * @param reflex
+ * @param value
+ * @param fmt
+ * @return Reflex_Result REFLEX_OK
+ */
+static Reflex_Result Reflex_Plan_skip(Reflex* reflex, void* value, const void* fmt) {
+    (void) reflex;
+    (void) value;
+    (void) fmt;
+
+    return REFLEX_OK;
+}
+#if REFLEX_SUPPORT_SCAN_ARRAY || REFLEX_SUPPORT_SCAN_COLUMNS
+/**
+ * @brief This function return size of object of compiled plan, it's stored in Return op
+ *
+ * @param plan
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Plan_size(const Reflex_PlanOp* plan) {
+    while (plan->Code != Reflex_PlanCode_Return) {
+        plan++;
+    }
+    return plan->Stride;
+}
+#endif
+#if REFLEX_SUPPORT_SCAN_MASKED
+/**
+ * @brief This function find first selected field in range of flat VarIndex,
+ * it's check 32 fields in each step
+ *
+ * @param mask
+ * @param var first flat VarIndex
+ * @param end end of range
+ * @return Reflex_LenType flat VarIndex of selected field, end if there is no selected field
+ */
+static Reflex_LenType Reflex_Mask_next(const uint32_t* mask, Reflex_LenType var, Reflex_LenType end) {
+    uint32_t word;
+
+    if (var >= end) {
+        return end;
+    }
+    word = mask[var >> 5] & ((uint32_t) 0xFFFFFFFF << (var & 31));
+    var &= ~31;
+    while (word == 0) {
+        var += 32;
+        if (var >= end) {
+            return end;
+        }
+        word = mask[var >> 5];
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    var += (Reflex_LenType) __builtin_ctz(word);
+#else
+    while ((word & 1) == 0) {
+        word >>= 1;
+        var++;
+    }
+#endif
+
+    return var < end ? var : end;
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function return last op of current element of complex field,
+ * it's Next op for first element if it has different layout, otherwise End op
+ *
+ * @param plan
+ * @param frame
+ * @return const Reflex_PlanOp*
+ */
+static const Reflex_PlanOp* Reflex_Plan_tail(const Reflex_PlanOp* plan, const Reflex_PlanFrame* frame) {
+    const Reflex_PlanOp* end = &plan[frame->Begin->Jump];
+
+    if (frame->Index == 0 && plan[end->Jump - 1].Code == Reflex_PlanCode_Next) {
+        return &plan[end->Jump - 1];
+    }
+    return end;
+}
+#endif
+#endif // REFLEX_SUPPORT_SCAN_MASKED
+#endif // REFLEX_SUPPORT_PLAN
+#if REFLEX_SUPPORT_HASH
+/**
+ * @brief This function init state of hash with seed
+ *
+ * @param state
+ * @param seed
+ */
+static void Reflex_Hash_init(Reflex_HashState* state, uint64_t seed) {
+    state->V[0] = seed + REFLEX_HASH_PRIME1 + REFLEX_HASH_PRIME2;
+    state->V[1] = seed + REFLEX_HASH_PRIME2;
+    state->V[2] = seed;
+    state->V[3] = seed - REFLEX_HASH_PRIME1;
+    state->Total = 0;
+    state->Run = NULL;
+    state->RunEnd = NULL;
+    state->Len = 0;
+}
+/**
+ * @brief This function add bytes to hash, full stripes of 32 bytes are hashed directly from data
+ *
+ * @param state
+ * @param data
+ * @param len
+ */
+static void Reflex_Hash_update(Reflex_HashState* state, const uint8_t* data, Reflex_PtrType len) {
+    const uint8_t* end = data + len;
+    uint32_t fill;
+
+    state->Total += len;
+    if (state->Len + len < sizeof(state->Buffer)) {
+        memcpy(&state->Buffer[state->Len], data, len);
+        state->Len += (uint32_t) len;
+        return;
+    }
+    if (state->Len > 0) {
+        // complete buffer
+        fill = sizeof(state->Buffer) - state->Len;
+        memcpy(&state->Buffer[state->Len], data, fill);
+        data += fill;
+        state->V[0] = __hashRound(state->V[0], Reflex_Hash_read64(&state->Buffer[0]));
+        state->V[1] = __hashRound(state->V[1], Reflex_Hash_read64(&state->Buffer[8]));
+        state->V[2] = __hashRound(state->V[2], Reflex_Hash_read64(&state->Buffer[16]));
+        state->V[3] = __hashRound(state->V[3], Reflex_Hash_read64(&state->Buffer[24]));
+        state->Len = 0;
+    }
+    while (end - data >= 32) {
+        state->V[0] = __hashRound(state->V[0], Reflex_Hash_read64(data));
+        state->V[1] = __hashRound(state->V[1], Reflex_Hash_read64(data + 8));
+        state->V[2] = __hashRound(state->V[2], Reflex_Hash_read64(data + 16));
+        state->V[3] = __hashRound(state->V[3], Reflex_Hash_read64(data + 24));
+        data += 32;
+    }
+    state->Len = (uint32_t) (end - data);
+    memcpy(state->Buffer, data, state->Len);
+}
+/**
+ * @brief This function return final hash, state must not be used after it
+ *
+ * @param state
+ * @return uint64_t
+ */
+static uint64_t Reflex_Hash_digest(Reflex_HashState* state) {
+    const uint8_t* data = state->Buffer;
+    const uint8_t* end = data + state->Len;
+    uint64_t hash;
+    uint8_t index;
+
+    if (state->Total >= 32) {
+        hash = __hashRotate(state->V[0], 1) + __hashRotate(state->V[1], 7) +
+               __hashRotate(state->V[2], 12) + __hashRotate(state->V[3], 18);
+        for (index = 0; index < 4; index++) {
+            hash ^= __hashRound(0, state->V[index]);
+            hash = hash * REFLEX_HASH_PRIME1 + REFLEX_HASH_PRIME4;
+        }
+    }
+    else {
+        // V[2] is seed
+        hash = state->V[2] + REFLEX_HASH_PRIME5;
+    }
+    hash += state->Total;
+
+    while (end - data >= 8) {
+        hash ^= __hashRound(0, Reflex_Hash_read64(data));
+        hash = __hashRotate(hash, 27) * REFLEX_HASH_PRIME1 + REFLEX_HASH_PRIME4;
+        data += 8;
+    }
+    if (end - data >= 4) {
+        hash ^= (uint64_t) Reflex_Hash_read32(data) * REFLEX_HASH_PRIME1;
+        hash = __hashRotate(hash, 23) * REFLEX_HASH_PRIME2 + REFLEX_HASH_PRIME3;
+        data += 4;
+    }
+    while (data < end) {
+        hash ^= *data++ * REFLEX_HASH_PRIME5;
+        hash = __hashRotate(hash, 11) * REFLEX_HASH_PRIME1;
+    }
+    // avalanche
+    hash ^= hash >> 33;
+    hash *= REFLEX_HASH_PRIME2;
+    hash ^= hash >> 29;
+    hash *= REFLEX_HASH_PRIME3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+/**
+ * @brief This function read 64-bit little endian value
+ *
+ * @param data
+ * @return uint64_t
+ */
+static uint64_t Reflex_Hash_read64(const uint8_t* data) {
+#if REFLEX_BIG_ENDIAN
+    return (uint64_t) Reflex_Hash_read32(data) | (uint64_t) Reflex_Hash_read32(data + 4) << 32;
+#else
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+#endif
+}
+/**
+ * @brief This function read 32-bit little endian value
+ *
+ * @param data
+ * @return uint32_t
+ */
+static uint32_t Reflex_Hash_read32(const uint8_t* data) {
+#if REFLEX_BIG_ENDIAN
+    return (uint32_t) data[0] | (uint32_t) data[1] << 8 | (uint32_t) data[2] << 16 | (uint32_t) data[3] << 24;
+#else
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+#endif
+}
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function add bytes into pending run, if bytes are not after run, run is hashed
+ *
+ * @param state
+ * @param data
+ * @param len
+ */
+static void Reflex_Hash_run(Reflex_HashState* state, const uint8_t* data, Reflex_LenType len) {
+    if (data != state->RunEnd) {
+        Reflex_Hash_flush(state);
+        state->Run = data;
+        state->RunEnd = data;
+    }
+    state->RunEnd += len;
+}
+/**
+ * @brief This function hash pending run
+ *
+ * @param state
+ */
+static void Reflex_Hash_flush(Reflex_HashState* state) {
+    if (state->RunEnd != state->Run) {
+        Reflex_Hash_update(state, state->Run, (Reflex_PtrType) (state->RunEnd - state->Run));
+    }
+    state->Run = NULL;
+    state->RunEnd = NULL;
+}
+/**
+ * @brief This function hash a byte that not exist in object, ex: pointer is not NULL
+ *
+ * @param state
+ * @param marker
+ */
+static void Reflex_Hash_marker(Reflex_HashState* state, uint8_t marker) {
+    Reflex_Hash_flush(state);
+    Reflex_Hash_update(state, &marker, 1);
+}
+/**
+ * @brief This function hash continuous items, on big endian hosts bytes of items are reversed
+ *
+ * @param state
+ * @param data
+ * @param itemSize
+ * @param len number of items
+ */
+static void Reflex_Hash_items(Reflex_HashState* state, const uint8_t* data, Reflex_LenType itemSize, Reflex_LenType len) {
+    uint8_t item[8];
+    Reflex_LenType index;
+
+    if (!__hashSwap() || itemSize <= 1) {
+        Reflex_Hash_run(state, data, itemSize * len);
+        return;
+    }
+    Reflex_Hash_flush(state);
+    while (len-- > 0) {
+        for (index = 0; index < itemSize; index++) {
+            item[index] = data[itemSize - 1 - index];
+        }
+        Reflex_Hash_update(state, item, itemSize);
+        data += itemSize;
+    }
+}
+/**
+ * @brief This function hash a field of plan, for pointers objects are hashed
+ *
+ * @param state
+ * @param fmt
+ * @param field address of field
+ * @param bytes bytes of field in memory of object
+ */
+static void Reflex_Hash_field(Reflex_HashState* state, const Reflex_TypeParams* fmt, const uint8_t* field, Reflex_LenType bytes) {
+    Reflex_LenType itemSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+#if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    const uint8_t* const* items = (const uint8_t* const*) field;
+    Reflex_LenType len = 1;
+#endif
+
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            len = fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            while (len-- > 0) {
+                Reflex_Hash_marker(state, *items != NULL);
+                if (*items != NULL) {
+                    Reflex_Hash_items(state, *items, itemSize, 1);
+                }
+                items++;
+            }
+            break;
+    #endif
+        default:
+            Reflex_Hash_items(state, field, itemSize, bytes / itemSize);
+            break;
+    }
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function hash a byte that show element of complex pointers is not NULL
+ *
+ * @param state
+ * @param frame
+ * @param element address of element
+ * @return uint8_t 0 if element is NULL and it's fields must be skipped
+ */
+static uint8_t Reflex_Hash_element(Reflex_HashState* state, const Reflex_PlanFrame* frame, const uint8_t* element) {
+    switch (frame->Begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            Reflex_Hash_marker(state, element != NULL);
+            return element != NULL;
+    #endif
+        default:
+            return 1;
+    }
+}
+#endif
+#endif // REFLEX_SUPPORT_PLAN
+#endif // REFLEX_SUPPORT_HASH
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function compare a field of plan, for pointers objects are compared
+ *
+ * @param fmt
+ * @param a address of field in first object
+ * @param b address of field in second object
+ * @param bytes bytes of field in memory of object
+ * @return uint8_t 1 if fields are equal
+ */
+static uint8_t Reflex_Compare_field(const Reflex_TypeParams* fmt, const uint8_t* a, const uint8_t* b, Reflex_LenType bytes) {
+#if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    Reflex_LenType itemSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+    const uint8_t* const* itemsA = (const uint8_t* const*) a;
+    const uint8_t* const* itemsB = (const uint8_t* const*) b;
+    Reflex_LenType len = 1;
+#endif
+
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            len = fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            while (len-- > 0) {
+                if (*itemsA != *itemsB &&
+                    (*itemsA == NULL || *itemsB == NULL || memcmp(*itemsA, *itemsB, itemSize) != 0)
+                ) {
+                    return 0;
+                }
+                itemsA++;
+                itemsB++;
+            }
+            return 1;
+    #endif
+        default:
+            return memcmp(a, b, bytes) == 0;
+    }
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function check elements of complex field must be compared,
+ * elements of complex pointers that point to same object or both are NULL are skipped
+ *
+ * @param frame
+ * @param a address of element in first object
+ * @param b address of element in second object
+ * @return uint8_t REFLEX_COMPARE_SKIP, REFLEX_COMPARE_ENTER or REFLEX_COMPARE_CHANGED if only one element is NULL
+ */
+static uint8_t Reflex_Compare_element(const Reflex_PlanFrame* frame, const uint8_t* a, const uint8_t* b) {
+    switch (frame->Begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (a == b) {
+                return REFLEX_COMPARE_SKIP;
+            }
+            else if (a == NULL || b == NULL) {
+                return REFLEX_COMPARE_CHANGED;
+            }
+            return REFLEX_COMPARE_ENTER;
+    #endif
+        default:
+            return REFLEX_COMPARE_ENTER;
+    }
+}
+#endif
+#endif // REFLEX_SUPPORT_COMPARE
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function walk over plan and copy fields between object and buffer of state
+ *
+ * @param reflex
+ * @param plan address of compiled plan
+ * @param obj
+ * @param state
+ * @return Reflex_LenType number of used bytes of buffer, -1 on error
+ */
+static Reflex_LenType Reflex_Binary_walk(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, Reflex_BinaryState* state) {
+    const Reflex_PlanOp* op = plan;
+    uint8_t* pobj = (uint8_t*) obj;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_PlanFrame frames[REFLEX_MAX_DEPTH];
+    Reflex_PlanFrame* frame;
+    Reflex_LenType depth = 0;
+#endif
+
+    while (op->Code != Reflex_PlanCode_Return && !state->Error) {
+        switch (op->Code) {
+            case Reflex_PlanCode_Field:
+                Reflex_Binary_field(state, &op->Params, pobj + op->Offset, op->Bytes);
+                op++;
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+                if (op->Bytes == op->Stride && !state->Swap) {
+                    // there is no padding and pointer in complex field
+                    Reflex_Binary_run(state, pobj + op->Offset, op->Bytes, 1);
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                else if (Reflex_Complex_elements(&op->Params) == 0) {
+                    op = &plan[op->Jump + 1];
+                    break;
+                }
+                frame = &frames[depth++];
+                frame->Begin = op;
+                frame->Parent = pobj;
+                frame->Field = pobj + op->Offset;
+                frame->Index = 0;
+                frame->Column = 0;
+                frame->Row = 0;
+                // enter first element, fields of NULL objects are skipped
+                op = Reflex_Binary_element(state, frame) ? op + 1 : &plan[op->Jump];
+                pobj = Reflex_Plan_element(frame, frame->Field, 0);
+                break;
+            case Reflex_PlanCode_Next:
+            case Reflex_PlanCode_End:
+                frame = &frames[depth - 1];
+                if (Reflex_Plan_nextElement(reflex, frame, REFLEX_OK)) {
+                    // enter next element
+                    pobj = Reflex_Plan_element(frame, pobj, op->Stride);
+                    op = Reflex_Binary_element(state, frame) ? &plan[op->Jump] : &plan[frame->Begin->Jump];
+                    break;
+                }
+                // leave complex field
+                pobj = Reflex_Plan_leave(frame, pobj + op->Stride);
+                op = &plan[frame->Begin->Jump + 1];
+                depth--;
+                break;
+        #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+            default:
+                state->Error = 1;
+                break;
+        }
+    }
+
+    return Reflex_Binary_end(state);
+}
+#endif // REFLEX_SUPPORT_BINARY
+#if __REFLEX_SUPPORT_ENCODER
+/**
+ * @brief This function copy bytes between object and buffer, items are swapped if byte order is different
+ *
+ * @param state
+ * @param obj
+ * @param len
+ * @param itemSize
+ */
+static void Reflex_Binary_copy(Reflex_BinaryState* state, uint8_t* obj, Reflex_PtrType len, Reflex_LenType itemSize) {
+    (void) itemSize;
+
+    if (state->Cap - state->Len < len) {
+        state->Error = 1;
+        return;
+    }
+#if REFLEX_SUPPORT_BYTE_ORDER && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    if (state->Swap && itemSize > 1) {
+        if (state->Buf == NULL) {
+            Reflex_ByteOrder_swap(obj, obj, itemSize, len);
+        }
+        else if (state->Decode) {
+            Reflex_ByteOrder_swap(obj, state->Buf + state->Len, itemSize, len);
+        }
+        else {
+            Reflex_ByteOrder_swap(state->Buf + state->Len, obj, itemSize, len);
+        }
+    }
+    else
+#endif
+    if (state->Buf != NULL) {
+        if (state->Decode) {
+            memcpy(obj, state->Buf + state->Len, (size_t) len);
+        }
+        else {
+            memcpy(state->Buf + state->Len, obj, (size_t) len);
+        }
+    }
+    state->Len += len;
+}
+/**
+ * @brief This function add bytes of object to pending run, if bytes are not continuous with run
+ * or they have different item size when items are swapped, run is copied and new run is started
+ *
+ * @param state
+ * @param obj
+ * @param len
+ * @param itemSize
+ */
+static void Reflex_Binary_run(Reflex_BinaryState* state, uint8_t* obj, Reflex_PtrType len, Reflex_LenType itemSize) {
+    if (!state->Swap) {
+        itemSize = 1;
+    }
+    if (obj != state->RunEnd || itemSize != state->ItemSize) {
+        Reflex_Binary_flush(state);
+        state->Run = obj;
+        state->RunEnd = obj;
+        state->ItemSize = (uint8_t) itemSize;
+    }
+    state->RunEnd += len;
+}
+/**
+ * @brief This function copy pending run
+ *
+ * @param state
+ */
+static void Reflex_Binary_flush(Reflex_BinaryState* state) {
+    if (state->RunEnd != state->Run) {
+        Reflex_Binary_copy(state, state->Run, (Reflex_PtrType) (state->RunEnd - state->Run), state->ItemSize);
+        state->Run = state->RunEnd;
+    }
+}
+/**
+ * @brief This function copy pending run and return number of used bytes of buffer
+ *
+ * @param state
+ * @return Reflex_LenType number of used bytes, -1 on error or if it's not fit in Reflex_LenType
+ */
+static Reflex_LenType Reflex_Binary_end(Reflex_BinaryState* state) {
+    Reflex_Binary_flush(state);
+
+    return state->Error || state->Len > (Reflex_PtrType) REFLEX_LEN_MAX ? -1 : (Reflex_LenType) state->Len;
+}
+#endif // __REFLEX_SUPPORT_ENCODER
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function copy a field of plan, for pointers objects are copied
+ *
+ * @param state
+ * @param fmt
+ * @param field address of field
+ * @param bytes bytes of field in memory of object
+ */
+static void Reflex_Binary_field(Reflex_BinaryState* state, const Reflex_TypeParams* fmt, uint8_t* field, Reflex_LenType bytes) {
+#if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    Reflex_LenType itemSize = PRIMARY_TYPE_SIZE[fmt->Fields.Primary];
+    void** items = (void**) field;
+    Reflex_LenType len = 1;
+#endif
+
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            len = fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            while (len-- > 0) {
+                if (Reflex_Binary_marker(state, items)) {
+                    Reflex_Binary_copy(state, (uint8_t*) *items, itemSize, itemSize);
+                }
+                items++;
+            }
+            break;
+    #endif
+        default:
+            Reflex_Binary_run(state, field, bytes, PRIMARY_TYPE_SIZE[fmt->Fields.Primary]);
+            break;
+    }
+}
+#if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+/**
+ * @brief This function copy a byte that show pointer is not NULL,
+ * in decode pointer is set to NULL if it's NULL in buffer
+ *
+ * @param state
+ * @param pointer address of pointer
+ * @return uint8_t 1 if object of pointer must be copied
+ */
+static uint8_t Reflex_Binary_marker(Reflex_BinaryState* state, void** pointer) {
+    uint8_t marker = *pointer != NULL;
+
+    Reflex_Binary_flush(state);
+    Reflex_Binary_copy(state, &marker, 1, 1);
+    if (state->Decode && !state->Error) {
+        if (marker == 0) {
+            *pointer = NULL;
+        }
+        else if (marker != 1 || *pointer == NULL) {
+            // invalid marker or there is no object for decode
+            state->Error = 1;
+        }
+    }
+
+    return marker == 1 && !state->Error;
+}
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function copy a byte that show current element of complex pointers is not NULL
+ *
+ * @param state
+ * @param frame
+ * @return uint8_t 0 if element is NULL and it's fields must be skipped
+ */
+static uint8_t Reflex_Binary_element(Reflex_BinaryState* state, const Reflex_PlanFrame* frame) {
+    switch (frame->Begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            return Reflex_Binary_marker(state, &((void**) frame->Field)[frame->Index]);
+    #endif
+        default:
+            return 1;
+    }
+}
+#endif
+#if REFLEX_SUPPORT_BYTE_ORDER
+/**
+ * @brief This macro swap items of a type, items are swapped in vectors and rest of them one by one
+ */
+#if REFLEX_SIMD_VECTOR_SIZE
+    #define __swapVectors(SWAP_VECTOR)              for (; index + REFLEX_SIMD_VECTOR_SIZE <= len; index += REFLEX_SIMD_VECTOR_SIZE) { \
+                                                        __storeVector(dst + index, SWAP_VECTOR(__loadVector(src + index))); \
+                                                    }
+#else
+    #define __swapVectors(SWAP_VECTOR)
+#endif
+#define __swapItems(TYPE, SWAP, SWAP_VECTOR)        { \
+                                                        TYPE value; \
+                                                        __swapVectors(SWAP_VECTOR) \
+                                                        for (; index < len; index += (Reflex_LenType) sizeof(TYPE)) { \
+                                                            memcpy(&value, src + index, sizeof(TYPE)); \
+                                                            value = SWAP(value); \
+                                                            memcpy(dst + index, &value, sizeof(TYPE)); \
+                                                        } \
+                                                    }
+/**
+ * @brief This function copy items and reverse bytes of each item, dst can be same as src
+ *
+ * @param dst
+ * @param src
+ * @param itemSize size of items, 2, 4 or 8
+ * @param len number of bytes, it's multiple of item size
+ */
+static void Reflex_ByteOrder_swap(uint8_t* dst, const uint8_t* src, Reflex_LenType itemSize, Reflex_LenType len) {
+    Reflex_LenType index = 0;
+
+    switch (itemSize) {
+        case 2:
+            __swapItems(uint16_t, __swap16, __swapVector16);
+            break;
+        case 4:
+            __swapItems(uint32_t, __swap32, __swapVector32);
+            break;
+        case 8:
+            __swapItems(uint64_t, __swap64, __swapVector64);
+            break;
+        default:
+            if (dst != src) {
+                memcpy(dst, src, (size_t) len);
+            }
+            break;
+    }
+}
+#endif // REFLEX_SUPPORT_BYTE_ORDER
+#endif // REFLEX_SUPPORT_BINARY
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function run next op of plan over buffer of view and cache entry of fields,
+ * it's same walk as Reflex_Binary_walk without object
+ *
+ * @param view
+ * @return uint8_t 0 if plan is finished or buffer is not valid
+ */
+static uint8_t Reflex_View_step(Reflex_View* view) {
+    const Reflex_PlanOp* plan = view->Plan;
+    const Reflex_PlanOp* op = &plan[view->Op];
+    Reflex_ViewEntry* entry;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    const Reflex_PlanOp* begin;
+    Reflex_ViewFrame* frame;
+#endif
+
+    if (view->Error) {
+        return 0;
+    }
+    switch (op->Code) {
+        case Reflex_PlanCode_Field:
+            entry = &view->Entries[view->Resolved];
+            entry->Offset = view->Pos;
+            entry->Op = view->Op;
+            if (!Reflex_View_skip(view, op)) {
+                view->Error = 1;
+                break;
+            }
+            view->Resolved++;
+            view->Op++;
+            break;
+    #if REFLEX_SUPPORT_TYPE_COMPLEX
+        case Reflex_PlanCode_Begin:
+            if (Reflex_Complex_elements(&op->Params) == 0) {
+                view->Op = op->Jump + 1;
+                break;
+            }
+            frame = &view->Frames[view->Depth++];
+            frame->Begin = view->Op;
+            frame->Index = 0;
+            // enter first element, fields of NULL objects are skipped
+            view->Op = Reflex_View_element(view, op) ? view->Op + 1 : op->Jump;
+            break;
+        case Reflex_PlanCode_Next:
+        case Reflex_PlanCode_End:
+            frame = &view->Frames[view->Depth - 1];
+            begin = &plan[frame->Begin];
+            if (++frame->Index < Reflex_Complex_elements(&begin->Params)) {
+                // enter next element
+                view->Op = Reflex_View_element(view, begin) ? op->Jump : begin->Jump;
+                break;
+            }
+            // leave complex field
+            view->Op = begin->Jump + 1;
+            view->Depth--;
+            break;
+    #endif // REFLEX_SUPPORT_TYPE_COMPLEX
+        default:
+            return 0;
+    }
+
+    return !view->Error;
+}
+/**
+ * @brief This function move position of view after a field, presence bytes of pointers are checked
+ *
+ * @param view
+ * @param op Field op
+ * @return uint8_t 0 if buffer is not valid
+ */
+static uint8_t Reflex_View_skip(Reflex_View* view, const Reflex_PlanOp* op) {
+    Reflex_LenType bytes = op->Bytes;
+#if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    Reflex_LenType len = 1;
+    uint8_t marker;
+#endif
+
+    switch (op->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (op->Params.Fields.Category == Reflex_Category_PointerArray) {
+                len = op->Params.Len;
+            }
+        #endif
+            bytes = 0;
+            while (len-- > 0) {
+                if (view->Pos >= view->Len) {
+                    return 0;
+                }
+                marker = view->Buf[view->Pos++];
+                if (marker == 1) {
+                    bytes = PRIMARY_TYPE_SIZE[op->Params.Fields.Primary];
+                    if (view->Len - view->Pos < bytes) {
+                        return 0;
+                    }
+                    view->Pos += bytes;
+                }
+                else if (marker != 0) {
+                    return 0;
+                }
+            }
+            return 1;
+    #endif
+        default:
+            if (view->Len - view->Pos < bytes) {
+                return 0;
+            }
+            view->Pos += bytes;
+            return 1;
+    }
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function read presence byte of current element of complex pointers,
+ * for NULL elements entries of their fields are cached with offset -1
+ *
+ * @param view
+ * @param begin Begin op of complex field
+ * @return uint8_t 0 if element is NULL and it's fields must be skipped
+ */
+static uint8_t Reflex_View_element(Reflex_View* view, const Reflex_PlanOp* begin) {
+    Reflex_LenType vars;
+    uint8_t marker;
+
+    switch (begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (view->Pos >= view->Len) {
+                view->Error = 1;
+                return 0;
+            }
+            marker = view->Buf[view->Pos++];
+            if (marker == 1) {
+                return 1;
+            }
+            else if (marker != 0) {
+                view->Error = 1;
+                return 0;
+            }
+            for (vars = view->Plan[begin->Jump].Vars; vars > 0; vars--) {
+                view->Entries[view->Resolved].Offset = -1;
+                view->Entries[view->Resolved].Op = -1;
+                view->Resolved++;
+            }
+            return 0;
+    #endif
+        default:
+            return 1;
+    }
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function find a field in scope, complex fields are skipped without enter
+ *
+ * @param ref scope
+ * @param fmt format of field
+ * @param varIndex flat VarIndex of field, for complex fields it's VarIndex of first field of first element
+ * @return const Reflex_PlanOp* Field or Begin op of field, NULL if field not found
+ */
+static const Reflex_PlanOp* Reflex_View_find(const Reflex_ViewRef* ref, const void* fmt, Reflex_LenType* varIndex) {
+    const Reflex_PlanOp* plan = ref->View->Plan;
+    const Reflex_PlanOp* op = &plan[ref->Op];
+    Reflex_LenType var = ref->Var;
+
+    // scope is finished at end of element or end of plan
+    while (op->Code == Reflex_PlanCode_Field || op->Code == Reflex_PlanCode_Begin) {
+        if (op->Fmt == fmt) {
+            *varIndex = var;
+            return op;
+        }
+        if (op->Code == Reflex_PlanCode_Field) {
+            var++;
+            op++;
+        }
+        else {
+            var += op->Vars;
+            op = &plan[op->Jump + 1];
+        }
+    }
+
+    return NULL;
+}
+/**
+ * @brief This function return address of item if size of items of field is same as requested size
+ *
+ * @param view
+ * @param varIndex
+ * @param index
+ * @param itemSize
+ * @return const void*
+ */
+static const void* Reflex_View_typed(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index, Reflex_LenType itemSize) {
+    const void* item = Reflex_View_item(view, varIndex, index);
+
+    if (item == NULL || PRIMARY_TYPE_SIZE[view->Plan[view->Entries[varIndex].Op].Params.Fields.Primary] != itemSize) {
+        return NULL;
+    }
+
+    return item;
+}
+#endif // REFLEX_SUPPORT_VIEW
+#if REFLEX_SUPPORT_INDEX
+/**
+ * @brief This function return maximum number of entries of schema,
+ * complex fields and fields of all of their elements are counted,
+ * each element of complex pointer arrays need an extra entry for it's pointer
+ *
+ * @param schema
+ * @param depth depth of schema
+ * @return Reflex_LenType -1 if schema is too deep
+ */
+static Reflex_LenType Reflex_Index_count(const Reflex_Schema* schema, Reflex_LenType depth) {
+    Reflex_LenType count = schema->Len;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    const Reflex_TypeParams* fmt = schema->Fmt;
+    Reflex_LenType len = schema->Len;
+    Reflex_LenType fields;
+    Reflex_LenType elements;
+    __isCustom_init(schema);
+
+    if (depth > REFLEX_MAX_DEPTH) {
+        return -1;
+    }
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (schema->FormatMode == Reflex_FormatMode_Primary) {
+        return count;
+    }
+#endif
+    while (len-- > 0) {
+        if (fmt->Fields.Primary == Reflex_PrimaryType_Complex) {
+            fields = Reflex_Index_count(fmt->Schema, depth + 1);
+            if (fields < 0) {
+                return -1;
+            }
+            elements = Reflex_Complex_elements(fmt);
+            if (elements < 0) {
+                elements = 0;
+            }
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (fmt->Fields.Category == Reflex_Category_PointerArray && elements > 1) {
+                count += elements - 1;
+            }
+        #endif
+            count += fields * elements;
+        }
+        __nextFmt(schema, fmt);
+    }
+#endif
+
+    return count;
+}
+/**
+ * @brief This function return hash bucket of field format
+ *
+ * @param fmt
+ * @param size number of buckets
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Index_hash(const void* fmt, Reflex_LenType size) {
+    Reflex_PtrType key = (Reflex_PtrType) fmt;
+
+    key ^= key >> 7;
+    key ^= key >> 13;
+
+    return (Reflex_LenType) (key % (Reflex_PtrType) size);
+}
+/**
+ * @brief This function find entry of field format
+ *
+ * @param index
+ * @param fmt
+ * @return Reflex_LenType index of entry, -1 if not found
+ */
+static Reflex_LenType Reflex_Index_find(const Reflex_Index* index, const void* fmt) {
+    Reflex_LenType entry;
+
+    if (index->Size <= 0) {
+        return -1;
+    }
+    entry = index->Entries[Reflex_Index_hash(fmt, index->Size)].Head;
+    while (entry >= 0 && index->Entries[entry].Fmt != fmt) {
+        entry = index->Entries[entry].Next;
+    }
+
+    return entry;
+}
+/**
+ * @brief This function add a field into index, only first occurrence of field is linked into hash buckets
+ *
+ * @param builder
+ * @param reflex
+ * @param obj address of field
+ * @param main address of main object of field
+ * @param fmt key of field
+ * @param complex field is complex
+ * @return Reflex_LenType index of entry, -1 if index is full
+ */
+static Reflex_LenType Reflex_Index_add(Reflex_IndexBuilder* builder, Reflex* reflex, void* obj, void* main, const void* fmt, uint8_t complex) {
+    Reflex_Index* index = builder->Index;
+    Reflex_IndexEntry* entry;
+    Reflex_LenType bucket;
+
+    if (index->Len >= index->Size) {
+        builder->Error = 1;
+        return -1;
+    }
+    bucket = Reflex_Index_hash(fmt, index->Size);
+    entry = &index->Entries[index->Len];
+    entry->Fmt = fmt;
+    entry->Offset = (Reflex_LenType) ((uint8_t*) obj - builder->Base);
+    entry->MainOffset = (Reflex_LenType) ((uint8_t*) main - builder->Base);
+    entry->Base = builder->BaseEntry;
+#if REFLEX_SUPPORT_VAR_INDEX
+    entry->VarIndex = reflex->VarIndex;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    entry->VarOffset = reflex->VarOffset;
+#else
+    entry->VarOffset = 0;
+#endif
+#endif
+    entry->Complex = complex;
+    entry->Next = -1;
+    if (Reflex_Index_find(index, fmt) < 0) {
+        entry->Next = index->Entries[bucket].Head;
+        index->Entries[bucket].Head = index->Len;
+    }
+
+    return index->Len++;
+}
+/**
+ * @brief This is onField callback of index builder, it's receive fields and begin/end of complex fields
+ *
+ * @param reflex
+ * @param obj
+ * @param fmt
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Index_onField(Reflex* reflex, void* obj, const void* fmt) {
+    Reflex_IndexBuilder* builder = (Reflex_IndexBuilder*) reflex->Args;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_IndexFrame* frame;
+    Reflex_LenType entry;
+#endif
+
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (reflex->Schema->FormatMode == Reflex_FormatMode_Primary) {
+        // key of primary fields is address of their type in schema
+        fmt = &reflex->Schema->PrimaryFmt[reflex->VarIndex];
+    }
+    else
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    if (((const Reflex_TypeParams*) fmt)->Fields.Primary == Reflex_PrimaryType_Complex) {
+        frame = &builder->Frames[builder->Depth > 0 ? builder->Depth - 1 : 0];
+        if (builder->Depth > 0 && frame->Fmt == fmt && frame->Obj == obj) {
+            // end of complex field
+            builder->Base = frame->Base;
+            builder->Main = frame->Main;
+            builder->BaseEntry = frame->BaseEntry;
+            builder->Depth--;
+            return REFLEX_OK;
+        }
+        if (builder->Depth >= REFLEX_MAX_DEPTH) {
+            builder->Error = 1;
+            return REFLEX_ERROR;
+        }
+        // begin of complex field
+        Reflex_Index_element(builder, reflex, fmt);
+    #if REFLEX_SUPPORT_MAIN_OBJ
+        entry = Reflex_Index_add(builder, reflex, obj, reflex->MainObject, fmt, 1);
+    #else
+        entry = Reflex_Index_add(builder, reflex, obj, builder->Main, fmt, 1);
+    #endif
+        frame = &builder->Frames[builder->Depth++];
+        frame->Fmt = fmt;
+        frame->Obj = obj;
+        frame->Base = builder->Base;
+        frame->Main = builder->Main;
+        frame->BaseEntry = builder->BaseEntry;
+        frame->Entry = entry;
+        frame->Element = -1;
+        // main object of fields is first element
+        builder->Main = (uint8_t*) obj;
+        return builder->Error ? REFLEX_ERROR : REFLEX_OK;
+    }
+#endif
+
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    Reflex_Index_element(builder, reflex, fmt);
+#endif
+    Reflex_Index_add(builder, reflex, obj, builder->Main, fmt, 0);
+
+    return builder->Error ? REFLEX_ERROR : REFLEX_OK;
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function detect begin of next element of current complex field,
+ * each element begin with first field of schema, fields of pointed elements are relative to their pointer
+ *
+ * @param builder
+ * @param reflex
+ * @param fmt key of field
+ */
+static void Reflex_Index_element(Reflex_IndexBuilder* builder, Reflex* reflex, const void* fmt) {
+    Reflex_IndexFrame* frame;
+    uint8_t* item;
+    uint8_t* base;
+    Reflex_LenType entry;
+
+    if (builder->Depth <= 0 || fmt != reflex->Schema->CustomFmt) {
+        return;
+    }
+    frame = &builder->Frames[builder->Depth - 1];
+    frame->Element++;
+    switch (((const Reflex_TypeParams*) frame->Fmt)->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            // fields are relative to pointed object of element
+            builder->Base = frame->Base;
+            builder->BaseEntry = frame->BaseEntry;
+            item = (uint8_t*) frame->Obj + (Reflex_PtrType) frame->Element * sizeof(void*);
+            entry = frame->Entry;
+            if (frame->Element > 0) {
+                entry = Reflex_Index_add(builder, reflex, item, frame->Main, frame->Fmt, 1);
+            }
+            // address of pointer may be unaligned, read it with memcpy
+            memcpy(&base, item, sizeof(base));
+            builder->Base = base;
+            builder->Main = base;
+            builder->BaseEntry = entry;
+            break;
+    #endif
+        default:
+        #if REFLEX_SUPPORT_MAIN_OBJ
+            builder->Main = (uint8_t*) reflex->MainObject;
+        #endif
+            break;
+    }
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function return base object of an entry
+ *
+ * @param index
+ * @param entry index of complex pointer entry, -1 for main object
+ * @param obj main object
+ * @return uint8_t*
+ */
+static uint8_t* Reflex_Index_base(const Reflex_Index* index, Reflex_LenType entry, void* obj) {
+    const Reflex_IndexEntry* pointer;
+    uint8_t* base;
+
+    if (entry < 0) {
+        return (uint8_t*) obj;
+    }
+    pointer = &index->Entries[entry];
+    memcpy(&base, Reflex_Index_base(index, pointer->Base, obj) + pointer->Offset, sizeof(base));
+
+    return base;
+}
+/**
+ * @brief This function fill field from index entry
+ *
+ * @param index
+ * @param entry
+ * @param obj
+ * @param field
+ */
+static void Reflex_Index_fill(const Reflex_Index* index, const Reflex_IndexEntry* entry, void* obj, Reflex_Field* field) {
+    uint8_t* base = Reflex_Index_base(index, entry->Base, obj);
+
+    field->CustomFmt = entry->Fmt;
+    field->Object = base + entry->Offset;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    if (entry->Complex) {
+        // same as Reflex_Complex_getField
+        field->Object = Reflex_alignAddress(field->Object, Reflex_Complex_alignSize(((const Reflex_TypeParams*) entry->Fmt)->Schema));
+    }
+#endif
+    __initMainObj(field, base + entry->MainOffset);
+    __initVarIndex(field, entry);
+}
+#endif // REFLEX_SUPPORT_INDEX
+#if REFLEX_SUPPORT_CURSOR
+/**
+ * @brief This function fill field with current state of reflex, same as parameters of onField callback
+ *
+ * @param reflex
+ * @param field
+ * @param obj
+ * @param fmt
+ */
+static void Reflex_Cursor_fill(Reflex* reflex, Reflex_Field* field, void* obj, const void* fmt) {
+    field->Object = obj;
+    field->CustomFmt = fmt;
+#if REFLEX_SUPPORT_MAIN_OBJ
+    field->MainObject = reflex->MainObject;
+#endif
+    __initVarIndex(field, reflex);
+}
+/**
+ * @brief This function prepare layer for iterate over fields of an object
+ *
+ * @param reflex
+ * @param layer
+ * @param schema
+ * @param obj address of object, for complex pointers it's address of pointer
+ */
+static void Reflex_Cursor_enter(Reflex* reflex, Reflex_CursorLayer* layer, const Reflex_Schema* schema, uint8_t* obj) {
+    layer->Element = obj;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    if (layer->Complex != NULL) {
+        switch (layer->Complex->Fields.Category) {
+        #if REFLEX_SUPPORT_TYPE_POINTER
+            case Reflex_Category_Pointer:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            case Reflex_Category_PointerArray:
+        #endif
+        #if REFLEX_SUPPORT_TYPE_POINTER || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+                __prefetchElements(layer->Field, layer->Index, Reflex_Complex_elements(layer->Complex));
+                obj = *(uint8_t**) obj;
+                break;
+        #endif
+            default:
+                break;
+        }
+        __updateOffsetIndex(reflex);
+        reflex->Schema = schema;
+    }
+#endif
+    layer->Schema = schema;
+    layer->Fmt = schema->CustomFmt;
+    layer->Obj = obj;
+    layer->PObj = obj;
+    layer->Len = schema->Len;
+    layer->BiggestField = 1;
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (schema->FormatMode == Reflex_FormatMode_Primary) {
+        layer->FmtSize = sizeof(uint8_t);
+    }
+    else
+#endif
+    {
+    #if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+        layer->FmtSize = schema->FmtSize != 0 ? schema->FmtSize : (Reflex_LenType) sizeof(Reflex_TypeParams);
+    #else
+        layer->FmtSize = sizeof(Reflex_TypeParams);
+    #endif
+    }
+    __resetVarIndex(reflex);
+    __initMainObj(reflex, obj);
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function finish current element of complex field and return address of next element,
+ * it's follow break layer rules of complex scan functions
+ *
+ * @param reflex
+ * @param layer
+ * @return uint8_t* address of next element, NULL if complex field finished
+ */
+static uint8_t* Reflex_Cursor_nextElement(Reflex* reflex, Reflex_CursorLayer* layer) {
+    const Reflex_TypeParams* fmt = layer->Complex;
+
+    reflex->Schema = ((Reflex_CursorLayer*) layer - 1)->Schema;
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            __initMainObj(reflex, layer->Element);
+            reflex->PObj = layer->Element + sizeof(void*);
+            return NULL;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (fmt->Fields.Category == Reflex_Category_PointerArray) {
+                __initMainObj(reflex, layer->Element);
+                reflex->PObj = layer->Element + sizeof(void*);
+            }
+        #endif
+        #if REFLEX_SUPPORT_BREAK_LAYER
+            if (reflex->BreakLayer) {
+                reflex->BreakLayer = 0;
+                return NULL;
+            }
+        #endif
+            return ++layer->Index < fmt->Len ? (uint8_t*) reflex->PObj : NULL;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+        #if REFLEX_SUPPORT_BREAK_LAYER
+            if (reflex->BreakLayer) {
+                reflex->BreakLayer = 0;
+                layer->Index = fmt->Len;
+            }
+            else
+        #endif
+            {
+                layer->Index++;
+            }
+            if (layer->Index >= fmt->Len) {
+                // end of row
+                layer->Index = 0;
+                layer->Row++;
+            #if REFLEX_SUPPORT_BREAK_LAYER
+                if (reflex->BreakLayer2D) {
+                    reflex->BreakLayer = 0;
+                    reflex->BreakLayer2D = 0;
+                    return NULL;
+                }
+            #endif
+                if (layer->Row >= fmt->MLen) {
+                    return NULL;
+                }
+            }
+            return (uint8_t*) reflex->PObj;
+    #endif
+        default:
+            return NULL;
+    }
+}
+/**
+ * @brief This function leave complex field of current layer and return end event
+ *
+ * @param cursor
+ * @param field
+ * @return Reflex_CursorEvent
+ */
+static Reflex_CursorEvent Reflex_Cursor_leave(Reflex_Cursor* cursor, Reflex_Field* field) {
+    Reflex* reflex = cursor->Handler;
+    Reflex_CursorLayer* layer = &cursor->Layers[cursor->Depth--];
+    Reflex_CursorLayer* parent = layer - 1;
+
+    __decreaseLayerIndex(reflex);
+    Reflex_Cursor_fill(reflex, field, layer->Field, layer->Complex);
+    // continue parent object after complex field
+    if (parent->BiggestField < reflex->AlignSize) {
+        parent->BiggestField = reflex->AlignSize;
+    }
+    parent->PObj = (uint8_t*) reflex->PObj;
+    parent->Fmt = (const uint8_t*) parent->Fmt + parent->FmtSize;
+    parent->Len--;
+
+    return Reflex_CursorEvent_End;
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+#endif // REFLEX_SUPPORT_CURSOR
@@ -66,6 +66,12 @@ extern "C" {
  * If you want calculate size of schema in runtime, you need it
  */
 #define REFLEX_SUPPORT_SIZE_FN              1
+/**
+ * @brief Support Packed encoding functions API, bytes of fields in order of scan without paddings
+ * Note: it's need REFLEX_SUPPORT_SIZE_FN, REFLEX_SUPPORT_CALLBACK and REFLEX_SUPPORT_BUFFER
+ * If you want serialize objects into flat buffers or use Reflex_Parallel_encode default encoder, you need it
+ */
+#define REFLEX_SUPPORT_PACKED               1
 /**
  * @brief Support GetField functions API
  * If you want Serialize/Deserialize object in different way that they define in struct, you need it
@@ -130,6 +136,285 @@ extern "C" {
  * it's affect on scan, getField, etc
  */
 #define REFLEX_SUPPORT_TYPE_COMPLEX         1
+/**
+ * @brief Support Plan functions API
+ * If you want compile a schema once and scan it many times with pre-resolved offsets, you need it
+ */
+#define REFLEX_SUPPORT_PLAN                 1
+/**
+ * @brief Run bound plans with computed goto (direct threaded), it's only supported by GCC and Clang
+ * otherwise a switch is used, define it 0 for use switch on GCC and Clang too
+ */
+#ifndef REFLEX_PLAN_THREADED
+    #if defined(__GNUC__) || defined(__clang__)
+        #define REFLEX_PLAN_THREADED        1
+    #else
+        #define REFLEX_PLAN_THREADED        0
+    #endif
+#endif
+/**
+ * @brief Maximum depth of nested complex fields for non-recursive traversals, ex: Plan
+ * Note: each level cost one frame in stack of traversal function
+ * Reflex_Cursor keep REFLEX_MAX_DEPTH + 1 layers, each layer is ~88 bytes on 64-bit targets with small size profile,
+ * so default cursor take ~800 bytes of stack, reduce it for small stacks
+ */
+#define REFLEX_MAX_DEPTH                    8
+/**
+ * @brief Support Index functions API
+ * Note: it's need REFLEX_SUPPORT_SCAN_FIELD, REFLEX_SUPPORT_CALLBACK and REFLEX_SUPPORT_ARGS
+ * If you want find fields by format or by flat VarIndex in constant time, you need it
+ */
+#define REFLEX_SUPPORT_INDEX                1
+/**
+ * @brief Support Cursor functions API
+ * If you want iterate over fields with a loop instead of onField callbacks, you need it
+ */
+#define REFLEX_SUPPORT_CURSOR               1
+/**
+ * @brief Support Stack scan functions API
+ * Note: it's need REFLEX_SUPPORT_CURSOR
+ * If you want scan nested complex fields with a bounded stack instead of recursion, you need it
+ * depth of nested complex fields is limited by REFLEX_MAX_DEPTH
+ */
+#define REFLEX_SUPPORT_STACK_SCAN           1
+/**
+ * @brief Support shared Config API
+ * If you want scan with a const configuration from many threads at same time, you need it
+ * each scan use a small context on stack of caller
+ */
+#define REFLEX_SUPPORT_CONFIG               1
+/**
+ * @brief Support Batch scan functions API
+ * Note: it's need REFLEX_SUPPORT_CURSOR
+ * If you want receive fields in batches with one callback instead of one callback per field, you need it
+ */
+#define REFLEX_SUPPORT_BATCH                1
+#if REFLEX_SUPPORT_STACK_SCAN && !REFLEX_SUPPORT_CURSOR
+    #error "REFLEX_SUPPORT_STACK_SCAN need REFLEX_SUPPORT_CURSOR"
+#endif
+#if REFLEX_SUPPORT_BATCH && !REFLEX_SUPPORT_CURSOR
+    #error "REFLEX_SUPPORT_BATCH need REFLEX_SUPPORT_CURSOR"
+#endif
+/**
+ * @brief Default number of events in each batch
+ */
+#define REFLEX_BATCH_SIZE                   64
+/**
+ * @brief Support Array scan functions API
+ * If you want scan over array of objects with same schema in one call, you need it
+ */
+#define REFLEX_SUPPORT_SCAN_ARRAY           1
+/**
+ * @brief Number of plan ops that Reflex_scanArray compile on stack, so layout of schema computed once
+ * and reused for all objects, schemas that need more ops are scanned object by object, 0 means disabled
+ * Note: it's need REFLEX_SUPPORT_PLAN
+ */
+#define REFLEX_SCAN_ARRAY_PLAN_SIZE         32
+/**
+ * @brief Support Columns scan functions API
+ * Note: it's need REFLEX_SUPPORT_PLAN
+ * If you want visit each field once for whole array of objects (field-major) instead of once per object, you need it
+ */
+#define REFLEX_SUPPORT_SCAN_COLUMNS         1
+/**
+ * @brief Support Masked scan functions API
+ * Note: it's need REFLEX_SUPPORT_PLAN
+ * If you want scan only a few selected fields of a wide schema, you need it
+ * fields are selected by flat VarIndex in a bitmap, cost of scan depend on selected fields
+ */
+#define REFLEX_SUPPORT_SCAN_MASKED          1
+/**
+ * @brief Support Runs scan functions API
+ * Note: it's need REFLEX_SUPPORT_PLAN
+ * If you want copy or encode object with a few memcpy of continuous bytes instead of field by field, you need it
+ */
+#define REFLEX_SUPPORT_SCAN_RUNS            1
+/**
+ * @brief Support Hash functions API
+ * Note: Plan hash need REFLEX_SUPPORT_PLAN
+ * If you want hash content of objects without padding and pointers, you need it
+ * hash is 64-bit XXH64, objects of pointers are hashed instead of pointers
+ */
+#define REFLEX_SUPPORT_HASH                 1
+/**
+ * @brief Support Compare functions API
+ * Note: it's need REFLEX_SUPPORT_PLAN
+ * If you want check two objects are equal or find changed fields without padding and pointers, you need it
+ * objects of pointers are compared instead of pointers
+ */
+#define REFLEX_SUPPORT_COMPARE              1
+/**
+ * @brief Support Binary codec functions API
+ * Note: it's need REFLEX_SUPPORT_PLAN
+ * If you want serialize objects into binary buffers and deserialize them back without write a driver, you need it
+ * layout is same as Packed encoding, objects of pointers are written after a byte that show pointer is not NULL
+ */
+#define REFLEX_SUPPORT_BINARY               1
+/**
+ * @brief Support Byte order functions API, binary codec in network byte order and swap of objects in place
+ * Note: it's need REFLEX_SUPPORT_BINARY, items are swapped with SIMD instructions of REFLEX_PACKER_SIMD
+ * If you want exchange objects between little endian and big endian devices, you need it
+ */
+#define REFLEX_SUPPORT_BYTE_ORDER           1
+/**
+ * @brief Support View functions API, read fields of binary buffers in place without decode
+ * Note: it's need REFLEX_SUPPORT_BINARY, buffer must be encoded in byte order of host
+ * If you want read few fields of large encoded objects without decode whole object, you need it
+ */
+#define REFLEX_SUPPORT_VIEW                 1
+/**
+ * @brief Hash items in little endian order on big endian hosts,
+ * so an object give same hash on all architectures, on little endian hosts it's free
+ */
+#ifndef REFLEX_HASH_ENDIAN_NORMALIZE
+    #define REFLEX_HASH_ENDIAN_NORMALIZE    1
+#endif
+/**
+ * @brief Byte order of host, it's detected for GCC and Clang, otherwise little endian is assumed
+ */
+#ifndef REFLEX_BIG_ENDIAN
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        #define REFLEX_BIG_ENDIAN           1
+    #else
+        #define REFLEX_BIG_ENDIAN           0
+    #endif
+#endif
+/**
+ * @brief Prefetch distance of pointer complex fields, before scan of element i of a pointer array
+ * objects of elements i + 1 ... i + distance are prefetched, 0 disable prefetch
+ * Note: prefetch use __builtin_prefetch, on other compilers it's disabled
+ */
+#ifndef REFLEX_PREFETCH_DISTANCE
+    #define REFLEX_PREFETCH_DISTANCE        4
+#endif
+/**
+ * @brief Number of cache lines that prefetched from start of each object of pointer complex fields
+ */
+#ifndef REFLEX_PREFETCH_LINES
+    #define REFLEX_PREFETCH_LINES           2
+#endif
+/**
+ * @brief Size of cache line of CPU
+ */
+#ifndef REFLEX_CACHE_LINE_SIZE
+    #define REFLEX_CACHE_LINE_SIZE          64
+#endif
+/**
+ * @brief Support Parallel scan functions API, see ReflexParallel.h
+ * Note: it's need REFLEX_SUPPORT_CONFIG and pthread
+ * If you want scan big arrays of objects or big complex array fields on many cores, you need it
+ */
+#ifndef REFLEX_SUPPORT_PARALLEL
+    #if defined(__unix__) || defined(__APPLE__)
+        #define REFLEX_SUPPORT_PARALLEL     1
+    #else
+        #define REFLEX_SUPPORT_PARALLEL     0
+    #endif
+#endif
+/**
+ * @brief Maximum number of workers of parallel scan, include caller thread
+ */
+#define REFLEX_PARALLEL_WORKERS             8
+/**
+ * @brief Default number of elements in each chunk of parallel scan
+ */
+#define REFLEX_PARALLEL_CHUNK_SIZE          64
+/**
+ * @brief Maximum number of chunks of parallel scan, chunks grow for bigger arrays
+ * Note: each chunk cost one Reflex_Result in stack of caller
+ */
+#define REFLEX_PARALLEL_MAX_CHUNKS          256
+/**
+ * @brief Support Packer functions API, see ReflexPacker.h
+ * Note: it's need REFLEX_SUPPORT_CALLBACK, REFLEX_SUPPORT_ARGS and REFLEX_SUPPORT_SIZE_FN
+ * If you want encode many objects of flat schemas into padding free records fast, you need it
+ */
+#define REFLEX_SUPPORT_PACKER               1
+/**
+ * @brief SIMD instructions of packer
+ */
+#define REFLEX_PACKER_SIMD_NONE             0
+#define REFLEX_PACKER_SIMD_SSE2             1
+#define REFLEX_PACKER_SIMD_SSSE3            2
+#define REFLEX_PACKER_SIMD_AVX2             3
+#define REFLEX_PACKER_SIMD_NEON             4
+/**
+ * @brief Select SIMD instructions of packer and byte order functions, default is detected from compiler flags
+ * and other CPUs use scalar code
+ */
+#ifndef REFLEX_PACKER_SIMD
+    #if defined(__AVX2__)
+        #define REFLEX_PACKER_SIMD          REFLEX_PACKER_SIMD_AVX2
+    #elif defined(__SSSE3__)
+        #define REFLEX_PACKER_SIMD          REFLEX_PACKER_SIMD_SSSE3
+    #elif defined(__SSE2__) || defined(_M_X64)
+        #define REFLEX_PACKER_SIMD          REFLEX_PACKER_SIMD_SSE2
+    #elif defined(__ARM_NEON)
+        #define REFLEX_PACKER_SIMD          REFLEX_PACKER_SIMD_NEON
+    #else
+        #define REFLEX_PACKER_SIMD          REFLEX_PACKER_SIMD_NONE
+    #endif
+#endif
+/**
+ * @brief Number of objects that packer encode in each iteration, 8 or 16
+ */
+#ifndef REFLEX_PACKER_BLOCK
+    #if REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_AVX2
+        #define REFLEX_PACKER_BLOCK         16
+    #else
+        #define REFLEX_PACKER_BLOCK         8
+    #endif
+#endif
+/**
+ * @brief Support JSON encoder, see ReflexJson.h
+ * Note: it's need REFLEX_SUPPORT_COMPACT and REFLEX_SUPPORT_BUFFER, names of fields need REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+ * If you want write objects as JSON text without snprintf, you need it
+ */
+#define REFLEX_SUPPORT_JSON                 1
+/**
+ * @brief Size profiles, select width of len, offset and size variables
+ * Small: len is int16_t and offset is uint8_t, objects up to 32KB, Offset schema fields up to 255 bytes
+ * Wide: len is int32_t and offset is uint32_t, objects up to 2GB
+ * Huge: len is int64_t and offset is uint64_t, objects as big as address space
+ */
+#define REFLEX_SIZE_PROFILE_SMALL           0
+#define REFLEX_SIZE_PROFILE_WIDE            1
+#define REFLEX_SIZE_PROFILE_HUGE            2
+/**
+ * @brief Select size profile of library
+ * Note: Reflex_size return -1 if object size not fit in Reflex_LenType
+ */
+#ifndef REFLEX_SIZE_PROFILE
+    #define REFLEX_SIZE_PROFILE             REFLEX_SIZE_PROFILE_SMALL
+#endif
+
+#if REFLEX_SIZE_PROFILE == REFLEX_SIZE_PROFILE_HUGE
+/**
+ * @brief Define type of len variables
+ * Note: it must be signed
+ */
+typedef int64_t Reflex_LenType;
+/**
+ * @brief Define type of offset type in Offset Schema
+ * Note: it must be unsigned
+ */
+typedef uint64_t Reflex_OffsetType;
+
+#define REFLEX_LEN_MAX                      INT64_MAX
+#elif REFLEX_SIZE_PROFILE == REFLEX_SIZE_PROFILE_WIDE
+/**
+ * @brief Define type of len variables
+ * Note: it must be signed
+ */
+typedef int32_t Reflex_LenType;
+/**
+ * @brief Define type of offset type in Offset Schema
+ * Note: it must be unsigned
+ */
+typedef uint32_t Reflex_OffsetType;
+
+#define REFLEX_LEN_MAX                      INT32_MAX
+#else
 /**
  * @brief Define type of len variables
  * Note: it must be signed
@@ -140,6 +425,9 @@ typedef int16_t Reflex_LenType;
  * Note: it must be unsigned
  */
 typedef uint8_t Reflex_OffsetType;
+
+#define REFLEX_LEN_MAX                      INT16_MAX
+#endif
 /**
  * @brief Define type of reflex result
  */
@@ -218,6 +506,18 @@ typedef struct __Reflex_Schema Reflex_Schema;
     #define __REFLEX_TYPE_PARAMS_FIELD_MLEN_INIT(MLEN)
 #endif
 
+#if REFLEX_SUPPORT_TYPE_64BIT
+    #define __REFLEX_PRIMARY_TYPE_SIZES_64BIT()             sizeof(uint64_t), sizeof(int64_t),
+#else
+    #define __REFLEX_PRIMARY_TYPE_SIZES_64BIT()
+#endif
+
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+    #define __REFLEX_PRIMARY_TYPE_SIZES_DOUBLE()            sizeof(double),
+#else
+    #define __REFLEX_PRIMARY_TYPE_SIZES_DOUBLE()
+#endif
+
 #define __REFLEX_TYPE(CAT, TY)      Reflex_Type_ ##CAT ##_ ##TY = Reflex_Category_ ##CAT << 5 | Reflex_PrimaryType_ ##TY
 /* -------------------------------- Types ------------------------------------ */
 #if   REFLEX_ARCH == REFLEX_ARCH_64BIT
@@ -494,6 +794,15 @@ typedef enum {
   Reflex_SizeType_Packed,
   Reflex_SizeType_Length,
 } Reflex_SizeType;
+#if REFLEX_SUPPORT_BYTE_ORDER
+/**
+ * @brief Supported byte orders of binary codec
+ */
+typedef enum {
+    Reflex_ByteOrder_Host,          /**< byte order of host, items are copied without swap */
+    Reflex_ByteOrder_Network,       /**< big endian, items are swapped on little endian hosts */
+} Reflex_ByteOrder;
+#endif // REFLEX_SUPPORT_BYTE_ORDER
 /**
  * @brief Supported function mode for scan functions
  */
@@ -593,12 +902,240 @@ struct __Reflex {
     Reflex_LenType                          LayerIndex;
 #endif
     Reflex_LenType                          VarIndex;
+#endif
+#if REFLEX_SUPPORT_SCAN_ARRAY
+    Reflex_LenType                          ElementIndex;                   /**< index of current object in Reflex_scanArray */
 #endif
     uint8_t                                 FunctionMode        : 2;        /**< Reflex Driver FunctionMode, for PrimaryFmt it's optional */
     uint8_t                                 BreakLayer          : 1;
     uint8_t                                 BreakLayer2D        : 1;
     uint8_t                                 Reserved            : 4;
 };
+#if REFLEX_SUPPORT_CONFIG
+/**
+ * @brief This object hold immutable parameters of reflex handler
+ * Note: scan functions never change it, so it can be shared between threads without lock
+ */
+typedef struct {
+    union {
+    #if REFLEX_SUPPORT_CALLBACK
+        Reflex_OnFieldFn                    onField;
+    #endif
+    #if REFLEX_SUPPORT_DRIVER
+        const Reflex_ScanDriver*            Driver;
+    #endif
+    #if REFLEX_SUPPORT_COMPACT
+        const Reflex_ScanFunctions*         CompactFns;
+    #endif
+    };
+    const Reflex_Schema*                    Schema;
+#if REFLEX_SUPPORT_ARGS
+    void*                                   Args;
+#endif
+    uint8_t                                 FunctionMode;               /**< Reflex_FunctionMode */
+} Reflex_Config;
+#endif // REFLEX_SUPPORT_CONFIG
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief Supported operations of compiled plan
+ */
+typedef enum {
+    Reflex_PlanCode_Field,          /**< call onField for field at Base + Offset */
+    Reflex_PlanCode_Begin,          /**< begin of complex field, enter first element */
+    Reflex_PlanCode_Next,           /**< end of first element, when it's layout is different from other elements */
+    Reflex_PlanCode_End,            /**< end of element, go to next element or leave complex field */
+    Reflex_PlanCode_Return,         /**< end of plan */
+} Reflex_PlanCode;
+/**
+ * @brief This object hold a pre-resolved operation of compiled plan
+ * Note: Offset is relative to base of current object, for fields of complex elements it's address of element
+ */
+typedef struct {
+    Reflex_TypeParams                   Params;                         /**< copy of field params, it's used as fmt of Primary schema fields */
+    const void*                         Fmt;                            /**< address of field format that pass to callbacks */
+    Reflex_OnFieldFn                    Fn;                             /**< Field: onField, Begin, End: begin/end callback, resolved by Reflex_Plan_bind */
+    Reflex_LenType                      Offset;                         /**< offset of field from base of current object */
+    Reflex_LenType                      Stride;                         /**< Begin: size of all elements, Next, End: distance between current element and next element, Return: size of object */
+    Reflex_LenType                      Jump;                           /**< Begin: index of End op, Next, End: index of first op of next element */
+    Reflex_LenType                      Vars;                           /**< Field: number of continuous Field ops, Begin: number of fields of all elements, Next, End: number of fields of an element, Return: number of fields */
+    Reflex_LenType                      Bytes;                          /**< Field, Begin, Return: bytes of fields that placed in memory of op, pointers and objects of pointers are not counted */
+    uint8_t                             Code;                           /**< Reflex_PlanCode */
+} Reflex_PlanOp;
+#endif // REFLEX_SUPPORT_PLAN
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+/**
+ * @brief This object hold location of a field in buffer of view
+ */
+typedef struct {
+    Reflex_LenType                      Offset;                         /**< offset of field in buffer, for pointers it's offset of first presence byte, -1 if object of complex pointer is NULL */
+    Reflex_LenType                      Op;                             /**< index of Field op in plan */
+} Reflex_ViewEntry;
+/**
+ * @brief This object hold state of a complex field while view is walking over buffer
+ */
+typedef struct {
+    Reflex_LenType                      Begin;                          /**< index of Begin op in plan */
+    Reflex_LenType                      Index;                          /**< index of current element */
+} Reflex_ViewFrame;
+/**
+ * @brief This object hold a schema that bound to an encoded buffer,
+ * fields are found lazily and their offsets are cached in entries by flat VarIndex
+ */
+typedef struct {
+    const Reflex_PlanOp*                Plan;
+    const uint8_t*                      Buf;
+    Reflex_ViewEntry*                   Entries;
+    Reflex_LenType                      Len;                            /**< size of buffer */
+    Reflex_LenType                      Vars;                           /**< number of fields of plan */
+    Reflex_LenType                      Resolved;                       /**< number of fields that their entry is cached */
+    Reflex_LenType                      Op;                             /**< index of next op of walk */
+    Reflex_LenType                      Pos;                            /**< offset of next field in buffer */
+    Reflex_LenType                      Depth;
+    uint8_t                             Error;                          /**< buffer is not valid after last cached field */
+    Reflex_ViewFrame                    Frames[REFLEX_MAX_DEPTH];
+} Reflex_View;
+/**
+ * @brief This object hold a scope of view, main object or an element of complex field
+ */
+typedef struct {
+    Reflex_View*                        View;
+    Reflex_LenType                      Op;                             /**< index of first op of scope */
+    Reflex_LenType                      Var;                            /**< flat VarIndex of first field of scope */
+} Reflex_ViewRef;
+#endif // REFLEX_SUPPORT_VIEW
+#if REFLEX_SUPPORT_INDEX
+/**
+ * @brief This object hold location of a field in index, it's same as first result of getField
+ * Note: Offset and MainOffset are relative to base object, for fields of complex pointers it's address of pointed object
+ */
+typedef struct {
+    const void*                         Fmt;                            /**< address of field format, key of entry */
+    Reflex_LenType                      Offset;                         /**< offset of field from base object */
+    Reflex_LenType                      MainOffset;                     /**< offset of main object from base object */
+    Reflex_LenType                      Base;                           /**< index of complex pointer entry that hold base object, -1 for main object */
+    Reflex_LenType                      VarIndex;
+    Reflex_LenType                      VarOffset;
+    Reflex_LenType                      Head;                           /**< first entry of hash bucket, -1 for empty bucket */
+    Reflex_LenType                      Next;                           /**< next entry in hash bucket */
+    uint8_t                             Complex;                        /**< entry is a complex field */
+} Reflex_IndexEntry;
+/**
+ * @brief This object hold index of fields of a schema
+ */
+typedef struct {
+    const Reflex_Schema*                Schema;
+    Reflex_IndexEntry*                  Entries;
+    Reflex_LenType                      Len;                            /**< number of entries */
+    Reflex_LenType                      Size;                           /**< size of entries array, it's number of hash buckets */
+} Reflex_Index;
+#endif // REFLEX_SUPPORT_INDEX
+#if REFLEX_SUPPORT_CURSOR
+/**
+ * @brief Events that cursor return for each step
+ */
+typedef enum {
+    Reflex_CursorEvent_Done,        /**< there is no more fields */
+    Reflex_CursorEvent_Field,       /**< field is a primary field */
+    Reflex_CursorEvent_Begin,       /**< begin of complex field, same as fnComplexBegin */
+    Reflex_CursorEvent_End,         /**< end of complex field, same as fnComplexEnd */
+    Reflex_CursorEvent_Error,       /**< nested complex fields are deeper than REFLEX_MAX_DEPTH, use abort to leave */
+} Reflex_CursorEvent;
+/**
+ * @brief This object hold state of a layer of cursor, it's same as locals of scan functions
+ */
+typedef struct {
+    const Reflex_Schema*                Schema;
+    const void*                         Fmt;                            /**< format of next field */
+    const Reflex_TypeParams*            Complex;                        /**< format of complex field that own layer, NULL for main object */
+    uint8_t*                            Obj;                            /**< address of current object */
+    uint8_t*                            PObj;                           /**< address of next field */
+    uint8_t*                            Field;                          /**< address of complex field */
+    uint8_t*                            Element;                        /**< address of current element, for pointers it's address of pointer */
+    Reflex_LenType                      Len;                            /**< number of remaining fields */
+    Reflex_LenType                      FmtSize;                        /**< distance between formats of fields */
+    Reflex_LenType                      BiggestField;
+    Reflex_LenType                      Index;                          /**< index of current element */
+    Reflex_LenType                      Row;                            /**< index of current row for 2D arrays */
+    uint8_t                             Entered;                        /**< layer entered into complex field */
+    Reflex_TypeParams                   Primary;                        /**< format of current field in Primary schema */
+} Reflex_CursorLayer;
+/**
+ * @brief This object hold state of cursor
+ * Note: size of cursor grow with REFLEX_MAX_DEPTH, it's usually placed on stack of caller
+ */
+typedef struct {
+    Reflex*                             Handler;
+    Reflex_LenType                      Depth;                          /**< index of current layer, -1 after finish */
+    uint8_t                             Pending;                        /**< VarIndex of last field must be increased */
+    Reflex_CursorLayer                  Layers[REFLEX_MAX_DEPTH + 1];
+} Reflex_Cursor;
+#endif // REFLEX_SUPPORT_CURSOR
+#if REFLEX_SUPPORT_BATCH
+/**
+ * @brief This object hold a field event of batch scan
+ */
+typedef struct {
+    union {
+        const Reflex_TypeParams*        Fmt;
+        const uint8_t*                  PrimaryFmt;                     /**< for Primary schema it's address of field type */
+        const void*                     CustomFmt;
+    };
+    void*                               Object;                         /**< address of field */
+#if REFLEX_SUPPORT_VAR_INDEX
+    Reflex_LenType                      VarIndex;                       /**< flat index of field, same as Reflex_getVarIndex */
+#endif
+    uint8_t                             Type;                           /**< Reflex_Type of field */
+} Reflex_FieldEvent;
+/**
+ * @brief This function receive a batch of field events
+ *
+ * @param reflex
+ * @param events fields in order of scan
+ * @param len number of events
+ * @return return REFLEX_OK if you want continue scan otherwise you can return error
+ */
+typedef Reflex_Result (*Reflex_OnFieldsFn)(Reflex* reflex, const Reflex_FieldEvent* events, Reflex_LenType len);
+#endif // REFLEX_SUPPORT_BATCH
+#if REFLEX_SUPPORT_SCAN_COLUMNS
+/**
+ * @brief This callback call once for each field over all objects of array
+ * field of object i is at (uint8_t*) base + i * stride
+ * 
+ * @param reflex
+ * @param base address of field in first object
+ * @param stride distance between objects
+ * @param count number of objects
+ * @param fmt field format
+ * @return return REFLEX_OK if you want continue scan otherwise you can return error
+ */
+typedef Reflex_Result (*Reflex_OnColumnFn)(Reflex* reflex, void* base, Reflex_LenType stride, Reflex_LenType count, const void* fmt);
+#endif // REFLEX_SUPPORT_SCAN_COLUMNS
+#if REFLEX_SUPPORT_SCAN_RUNS
+/**
+ * @brief This callback call once for each run of continuous bytes of fields,
+ * there is no padding and no pointer in run, so it can be copied with a single memcpy
+ *
+ * @param reflex
+ * @param obj address of first byte of run
+ * @param len number of bytes
+ * @return return REFLEX_OK if you want continue scan otherwise you can return error
+ */
+typedef Reflex_Result (*Reflex_OnRunFn)(Reflex* reflex, void* obj, Reflex_LenType len);
+#endif // REFLEX_SUPPORT_SCAN_RUNS
+#if REFLEX_SUPPORT_COMPARE
+/**
+ * @brief This callback call once for each changed field in diff,
+ * if a complex pointer is NULL only in one object, it's call once for that element with fmt of complex field
+ *
+ * @param reflex
+ * @param a address of field in first object
+ * @param b address of field in second object
+ * @param fmt field format
+ * @param varIndex flat VarIndex of field, same as bit of field in mask of Reflex_Plan_scanMasked
+ * @return return REFLEX_OK if you want continue diff otherwise you can return error
+ */
+typedef Reflex_Result (*Reflex_OnChangedFn)(Reflex* reflex, void* a, void* b, const void* fmt, Reflex_LenType varIndex);
+#endif // REFLEX_SUPPORT_COMPARE
 
 /* ----------------------------------- Main API ------------------------------------ */
 void           Reflex_init(Reflex* reflex, const Reflex_Schema* schema);
@@ -627,6 +1164,26 @@ Reflex_LenType Reflex_sizeType(const Reflex_TypeParams* fmt);
 #if REFLEX_SUPPORT_COMPACT
     void       Reflex_setCompact(Reflex* reflex, const Reflex_ScanFunctions* compact);
 #endif
+/* -------------------------------- Shared Config API ------------------------------ */
+#if REFLEX_SUPPORT_CONFIG
+    void           Reflex_getConfig(const Reflex* reflex, Reflex_Config* config);
+    void           Reflex_initContext(Reflex* reflex, const Reflex_Config* config);
+    Reflex_Result  Reflex_Config_scanRaw(const Reflex_Config* config, void* obj, Reflex_OnFieldFn onField);
+    Reflex_Result  Reflex_Config_scan(const Reflex_Config* config, void* obj);
+#endif // REFLEX_SUPPORT_CONFIG
+/* ---------------------------------- Array Scan API ------------------------------- */
+#if REFLEX_SUPPORT_SCAN_ARRAY
+    Reflex_Result  Reflex_scanArrayRaw(Reflex* reflex, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnFieldFn onField);
+    Reflex_Result  Reflex_scanArray(Reflex* reflex, void* base, Reflex_LenType count, Reflex_LenType stride);
+    Reflex_LenType Reflex_getElementIndex(Reflex* reflex);
+#if REFLEX_SUPPORT_PLAN
+    Reflex_Result  Reflex_Plan_scanArray(Reflex* reflex, const Reflex_PlanOp* plan, void* base, Reflex_LenType count, Reflex_LenType stride);
+#endif
+#endif // REFLEX_SUPPORT_SCAN_ARRAY
+/* --------------------------------- Columns Scan API ------------------------------ */
+#if REFLEX_SUPPORT_SCAN_COLUMNS && REFLEX_SUPPORT_PLAN
+    Reflex_Result  Reflex_Plan_scanColumns(Reflex* reflex, const Reflex_PlanOp* plan, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnColumnFn onColumn);
+#endif // REFLEX_SUPPORT_SCAN_COLUMNS
 /* --------------------------------- GetField API ---------------------------------- */
 #if REFLEX_SUPPORT_SCAN_FIELD
     Reflex_GetResult Reflex_getField(Reflex* reflex, void* obj, const void* fieldFmt, Reflex_Field* field);
@@ -682,6 +1239,11 @@ Reflex_LenType Reflex_sizeType(const Reflex_TypeParams* fmt);
     Reflex_LenType Reflex_Offset_sizePacked(const Reflex_Schema* schema);
 #endif
 #endif // REFLEX_SUPPORT_SIZE_FN
+/* ----------------------------------- Packed API ----------------------------------- */
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+    Reflex_LenType Reflex_Packed_size(const Reflex_Schema* schema, void* obj);
+    Reflex_LenType Reflex_Packed_encode(const Reflex_Schema* schema, void* obj, void* buf);
+#endif // REFLEX_SUPPORT_PACKED
 /* --------------------------------- LowLevel Scan API ----------------------------------- */
 #if REFLEX_FORMAT_MODE_PARAM
     Reflex_Result Reflex_Param_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn onField);
@@ -714,6 +1276,107 @@ Reflex_LenType Reflex_sizeType(const Reflex_TypeParams* fmt);
     Reflex_GetResult Reflex_Complex_getField(Reflex* reflex, void* obj, const Reflex_TypeParams* fmt, const void* fieldFmt, Reflex_Field* field);
 #endif
 #endif // REFLEX_SUPPORT_SCAN_FIELD
+/* ------------------------------------ Plan API ----------------------------------- */
+#if REFLEX_SUPPORT_PLAN
+    Reflex_LenType   Reflex_compile(const Reflex_Schema* schema, Reflex_PlanOp* plan, Reflex_LenType planSize);
+    Reflex_Result    Reflex_Plan_scanRaw(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, Reflex_OnFieldFn onField);
+    Reflex_Result    Reflex_Plan_scan(Reflex* reflex, const Reflex_PlanOp* plan, void* obj);
+    Reflex_Result    Reflex_Plan_bind(const Reflex* reflex, Reflex_PlanOp* plan);
+    Reflex_Result    Reflex_Plan_scanBound(Reflex* reflex, const Reflex_PlanOp* plan, void* obj);
+#endif // REFLEX_SUPPORT_PLAN
+
+#if REFLEX_SUPPORT_SCAN_MASKED && REFLEX_SUPPORT_PLAN
+    /**
+     * @brief Number of words of mask for a plan with VARS fields
+     */
+    #define REFLEX_MASK_LEN(VARS)               (((VARS) + 31) >> 5)
+    /**
+     * @brief Select field with flat VarIndex in mask
+     */
+    #define REFLEX_MASK_SET(MASK, VAR_INDEX)    ((MASK)[(VAR_INDEX) >> 5] |= (uint32_t) 1 << ((VAR_INDEX) & 31))
+
+    Reflex_LenType   Reflex_Plan_vars(const Reflex_PlanOp* plan);
+    Reflex_Result    Reflex_Plan_scanMasked(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, const uint32_t* mask);
+#endif // REFLEX_SUPPORT_SCAN_MASKED
+
+#if REFLEX_SUPPORT_SCAN_RUNS && REFLEX_SUPPORT_PLAN
+    Reflex_Result    Reflex_Plan_scanRuns(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, Reflex_OnRunFn onRun);
+#endif // REFLEX_SUPPORT_SCAN_RUNS
+
+/* ------------------------------------ Hash API ---------------------------------- */
+#if REFLEX_SUPPORT_HASH
+    uint64_t         Reflex_hashBytes(const void* data, Reflex_PtrType len, uint64_t seed);
+#if REFLEX_SUPPORT_PLAN
+    uint64_t         Reflex_Plan_hash(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, uint64_t seed);
+#endif
+#endif // REFLEX_SUPPORT_HASH
+/* ------------------------------------ Compare API ---------------------------------- */
+#if REFLEX_SUPPORT_COMPARE && REFLEX_SUPPORT_PLAN
+    uint8_t          Reflex_Plan_equals(Reflex* reflex, const Reflex_PlanOp* plan, void* a, void* b);
+    Reflex_Result    Reflex_Plan_diff(Reflex* reflex, const Reflex_PlanOp* plan, void* a, void* b, Reflex_OnChangedFn onChanged);
+#endif // REFLEX_SUPPORT_COMPARE
+/* ------------------------------------ Binary API ---------------------------------- */
+#if REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    Reflex_LenType   Reflex_Binary_sizeFixed(const Reflex_PlanOp* plan);
+    Reflex_LenType   Reflex_Binary_size(Reflex* reflex, const Reflex_PlanOp* plan, void* obj);
+    Reflex_LenType   Reflex_Binary_encode(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, void* out, Reflex_PtrType cap);
+    Reflex_LenType   Reflex_Binary_decode(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, const void* in, Reflex_PtrType len);
+#if REFLEX_SUPPORT_BYTE_ORDER
+    Reflex_LenType   Reflex_Binary_encodeOrder(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, void* out, Reflex_PtrType cap, Reflex_ByteOrder order);
+    Reflex_LenType   Reflex_Binary_decodeOrder(Reflex* reflex, const Reflex_PlanOp* plan, void* obj, const void* in, Reflex_PtrType len, Reflex_ByteOrder order);
+    Reflex_Result    Reflex_Plan_toNetworkOrder(Reflex* reflex, const Reflex_PlanOp* plan, void* obj);
+    #define          Reflex_Plan_fromNetworkOrder       Reflex_Plan_toNetworkOrder
+#endif
+#endif // REFLEX_SUPPORT_BINARY
+/* ------------------------------------ View API ---------------------------------- */
+#if REFLEX_SUPPORT_VIEW && REFLEX_SUPPORT_BINARY && REFLEX_SUPPORT_PLAN
+    Reflex_Result    Reflex_View_init(Reflex_View* view, const Reflex_PlanOp* plan, const void* buf, Reflex_LenType len, Reflex_ViewEntry* entries, Reflex_LenType size);
+    Reflex_ViewRef   Reflex_View_root(Reflex_View* view);
+    uint8_t          Reflex_View_child(const Reflex_ViewRef* ref, const void* fmt, Reflex_LenType index, Reflex_ViewRef* child);
+    Reflex_LenType   Reflex_View_var(const Reflex_ViewRef* ref, const void* fmt);
+    Reflex_LenType   Reflex_View_offset(Reflex_View* view, Reflex_LenType varIndex);
+    const void*      Reflex_View_item(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    char             Reflex_View_getChar(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    uint8_t          Reflex_View_getUInt8(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    int8_t           Reflex_View_getInt8(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    uint16_t         Reflex_View_getUInt16(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    int16_t          Reflex_View_getInt16(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    uint32_t         Reflex_View_getUInt32(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    int32_t          Reflex_View_getInt32(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+#if REFLEX_SUPPORT_TYPE_64BIT
+    uint64_t         Reflex_View_getUInt64(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+    int64_t          Reflex_View_getInt64(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+#endif
+    float            Reflex_View_getFloat(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+    double           Reflex_View_getDouble(Reflex_View* view, Reflex_LenType varIndex, Reflex_LenType index);
+#endif
+#endif // REFLEX_SUPPORT_VIEW
+/* ------------------------------------ Index API ---------------------------------- */
+#if REFLEX_SUPPORT_INDEX
+    Reflex_LenType   Reflex_Index_build(Reflex_Index* index, const Reflex_Schema* schema, void* obj, Reflex_IndexEntry* entries, Reflex_LenType size);
+    Reflex_GetResult Reflex_Index_getField(const Reflex_Index* index, void* obj, const void* fieldFmt, Reflex_Field* field);
+#if REFLEX_SUPPORT_VAR_INDEX
+    Reflex_GetResult Reflex_Index_getFieldAt(const Reflex_Index* index, void* obj, Reflex_LenType varIndex, Reflex_Field* field);
+#endif
+    Reflex_Result    Reflex_Index_scanField(Reflex* reflex, const Reflex_Index* index, void* obj, const void* fieldFmt);
+#endif // REFLEX_SUPPORT_INDEX
+/* ------------------------------------ Cursor API --------------------------------- */
+#if REFLEX_SUPPORT_CURSOR
+    void               Reflex_Cursor_begin(Reflex_Cursor* cursor, Reflex* reflex, void* obj);
+    Reflex_CursorEvent Reflex_Cursor_next(Reflex_Cursor* cursor, Reflex_Field* field);
+    Reflex_CursorEvent Reflex_Cursor_abort(Reflex_Cursor* cursor, Reflex_Field* field);
+#endif // REFLEX_SUPPORT_CURSOR
+/* ------------------------------------ Stack Scan API --------------------------------- */
+#if REFLEX_SUPPORT_STACK_SCAN
+    Reflex_Result      Reflex_Stack_scanRaw(Reflex* reflex, void* obj, Reflex_OnFieldFn onField);
+    Reflex_Result      Reflex_Stack_scan(Reflex* reflex, void* obj);
+#endif // REFLEX_SUPPORT_STACK_SCAN
+/* ------------------------------------ Batch Scan API --------------------------------- */
+#if REFLEX_SUPPORT_BATCH
+    Reflex_Result      Reflex_Batch_scanRaw(Reflex* reflex, void* obj, Reflex_FieldEvent* events, Reflex_LenType size, Reflex_OnFieldsFn onFields);
+    Reflex_Result      Reflex_Batch_scan(Reflex* reflex, void* obj, Reflex_OnFieldsFn onFields);
+#endif // REFLEX_SUPPORT_BATCH
 /* -------------------------------- Helper Macros API ----------------------------------- */
 /**
  * @brief This macro help you to fill Reflex_TypeParams struct with default
@@ -832,6 +1495,22 @@ Reflex_LenType Reflex_sizeType(const Reflex_TypeParams* fmt);
  * @param ARR name of array
  */
 #define REFLEX_TYPE_PARAMS_LEN(ARR)                     (sizeof(ARR) / sizeof(ARR[0]))
+/**
+ * @brief This macro is initializer of table of size of primary types, table is indexed by Reflex_PrimaryType
+ * Note: Reflex and ReflexInline both build their table from it, so sizes stay compile time constants
+ */
+#define REFLEX_PRIMARY_TYPE_SIZES                       {                                       \
+                                                            sizeof(char),                       \
+                                                            sizeof(uint8_t),                    \
+                                                            sizeof(int8_t),                     \
+                                                            sizeof(uint16_t),                   \
+                                                            sizeof(int16_t),                    \
+                                                            sizeof(uint32_t),                   \
+                                                            sizeof(int32_t),                    \
+                                                            __REFLEX_PRIMARY_TYPE_SIZES_64BIT() \
+                                                            sizeof(float),                      \
+                                                            __REFLEX_PRIMARY_TYPE_SIZES_DOUBLE() \
+                                                        }
 
 // ----------------------------------- Private Helper Macros --------------------------
 #define __REFLEX_TYPE_PARAMS_N_(_0, _1, _2, _3, _4, _5, FMT, ...) REFLEX_TYPE_PARAMS_ ##FMT
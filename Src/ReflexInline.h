@@ -0,0 +1,618 @@
+/**
+ * @file ReflexInline.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Header-only scan functions of Reflex, schema and visitor of fields are compile time tokens
+ *        so compiler can fold field types and offsets of schema and inline visitor
+ *        Example:
+ *          REFLEX_INLINE_SCAN(Model_scan, Model_SCHEMA, Model_onField)
+ *          ...
+ *          Model_scan(&reflex, &model);
+ *        Generated function give same callbacks, VarIndex, VarOffset, LayerIndex and break semantics
+ *        as Reflex_scan in Callback mode, complex begin and end are passed to visitor too
+ *
+ * @version 0.1
+ * @date 2023-04-08
+ *
+ * @copyright Copyright (c) 2023
+ */
+#ifndef _REFLEX_INLINE_H_
+#define _REFLEX_INLINE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Reflex.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define REFLEX_INLINE                       static inline __attribute__((always_inline))
+#else
+    #define REFLEX_INLINE                       static inline
+#endif
+
+/**
+ * @brief This object hold state of scan over an object, it's same as locals of scan functions
+ */
+typedef struct {
+    const Reflex_Schema*                Schema;
+    uint8_t*                            Obj;
+    uint8_t*                            PObj;                           /**< address of next field */
+    Reflex_LenType                      Index;                          /**< index of next field */
+    Reflex_LenType                      BiggestField;
+    Reflex_TypeParams                   Primary;                        /**< params of current field of Primary schema */
+} Reflex_InlineLayer;
+
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This object hold state of scan over a complex field, generated scanners keep them in a stack
+ * with REFLEX_MAX_DEPTH frames instead of recursion
+ */
+typedef struct {
+    Reflex_InlineLayer                  Layer;                          /**< layer of current element */
+    const Reflex_Schema*                Parent;                         /**< schema of object that own complex field */
+    const Reflex_TypeParams*            Complex;                        /**< format of complex field */
+    uint8_t*                            Field;                          /**< address of complex field */
+    uint8_t*                            Element;                        /**< address of current element, for pointers it's address of pointer */
+    Reflex_LenType                      Rows;                           /**< number of remaining rows */
+    Reflex_LenType                      Cols;                           /**< number of elements in each row */
+    Reflex_LenType                      Col;                            /**< number of remaining elements in current row */
+    uint8_t                             InRow;
+    uint8_t                             Entered;                        /**< scan of current element is in progress */
+} Reflex_InlineFrame;
+#endif
+
+// Store sizeof all primary types, built from same initializer of Reflex
+static const uint8_t REFLEX_INLINE_TYPE_SIZE[] = REFLEX_PRIMARY_TYPE_SIZES;
+
+/* ------------------------------------ Helper Functions ----------------------------------- */
+/**
+ * @brief This function align address same as Reflex scan functions
+ *
+ * @param pobj
+ * @param size
+ * @return uint8_t*
+ */
+REFLEX_INLINE uint8_t* Reflex_Inline_alignAddress(uint8_t* pobj, Reflex_LenType size) {
+#if REFLEX_ARCH == REFLEX_ARCH_8BIT
+    (void) size;
+    return pobj;
+#else
+    Reflex_PtrType addr = (Reflex_PtrType) pobj;
+    Reflex_PtrType pad;
+
+#if REFLEX_ARCH != REFLEX_ARCH_64BIT
+    if (size > REFLEX_ARCH_BYTES) {
+        size = REFLEX_ARCH_BYTES;
+    }
+#endif
+    if ((pad = addr & ((Reflex_PtrType) size - 1)) != 0) {
+        addr += size - pad;
+    }
+
+    return (uint8_t*) addr;
+#endif
+}
+/**
+ * @brief This function return size of each item of field, it's used for alignment
+ *
+ * @param fmt
+ * @return Reflex_LenType
+ */
+REFLEX_INLINE Reflex_LenType Reflex_Inline_itemSize(const Reflex_TypeParams* fmt) {
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            return sizeof(void*);
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            return sizeof(void*);
+    #endif
+        default:
+            return REFLEX_INLINE_TYPE_SIZE[fmt->Fields.Primary];
+    }
+}
+/**
+ * @brief This function return size of whole field
+ *
+ * @param fmt
+ * @return Reflex_PtrType
+ */
+REFLEX_INLINE Reflex_PtrType Reflex_Inline_fieldSize(const Reflex_TypeParams* fmt) {
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+            return (Reflex_PtrType) REFLEX_INLINE_TYPE_SIZE[fmt->Fields.Primary] * fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            return (Reflex_PtrType) sizeof(void*) * fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            return (Reflex_PtrType) REFLEX_INLINE_TYPE_SIZE[fmt->Fields.Primary] * fmt->Len * fmt->MLen;
+    #endif
+        default:
+            return Reflex_Inline_itemSize(fmt);
+    }
+}
+/**
+ * @brief This function return size of each format of schema
+ *
+ * @param schema
+ * @return Reflex_LenType
+ */
+REFLEX_INLINE Reflex_LenType Reflex_Inline_fmtSize(const Reflex_Schema* schema) {
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+    return schema->FmtSize != 0 ? schema->FmtSize : (Reflex_LenType) sizeof(Reflex_TypeParams);
+#else
+    (void) schema;
+    return sizeof(Reflex_TypeParams);
+#endif
+}
+/**
+ * @brief This function prepare layer for scan over fields of schema
+ *
+ * @param reflex
+ * @param layer
+ * @param schema
+ * @param obj
+ */
+REFLEX_INLINE void Reflex_Inline_begin(Reflex* reflex, Reflex_InlineLayer* layer, const Reflex_Schema* schema, uint8_t* obj) {
+    layer->Schema = schema;
+    layer->Obj = obj;
+    layer->PObj = obj;
+    layer->Index = 0;
+    layer->BiggestField = 1;
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->VarIndex = 0;
+#endif
+#if REFLEX_SUPPORT_MAIN_OBJ
+    reflex->MainObject = obj;
+#endif
+    (void) reflex;
+}
+/**
+ * @brief This function return format of next field, schema is passed separately
+ * so a const schema fold into constant formats
+ *
+ * @param layer
+ * @param schema schema of layer
+ * @return const Reflex_TypeParams* NULL if there is no more fields
+ */
+REFLEX_INLINE const Reflex_TypeParams* Reflex_Inline_next(Reflex_InlineLayer* layer, const Reflex_Schema* schema) {
+    Reflex_LenType index = layer->Index;
+
+    if (index >= schema->Len) {
+        return NULL;
+    }
+    layer->Index = index + 1;
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (schema->FormatMode == Reflex_FormatMode_Primary) {
+        layer->Primary.Type = schema->PrimaryFmt[index];
+        return &layer->Primary;
+    }
+#endif
+
+    return (const Reflex_TypeParams*) ((const uint8_t*) schema->CustomFmt + (Reflex_PtrType) index * Reflex_Inline_fmtSize(schema));
+}
+/**
+ * @brief This function check field is complex
+ *
+ * @param schema
+ * @param fmt
+ * @return uint8_t
+ */
+REFLEX_INLINE uint8_t Reflex_Inline_isComplex(const Reflex_Schema* schema, const Reflex_TypeParams* fmt) {
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (schema->FormatMode == Reflex_FormatMode_Primary) {
+        return 0;
+    }
+#endif
+    (void) schema;
+    return fmt->Fields.Primary == Reflex_PrimaryType_Complex;
+#else
+    (void) schema;
+    (void) fmt;
+    return 0;
+#endif
+}
+/**
+ * @brief This function return address of primary field and move layer to next field
+ *
+ * @param layer
+ * @param schema schema of layer
+ * @param fmt
+ * @return void*
+ */
+REFLEX_INLINE void* Reflex_Inline_field(Reflex_InlineLayer* layer, const Reflex_Schema* schema, const Reflex_TypeParams* fmt) {
+    uint8_t* pobj;
+    Reflex_LenType size;
+
+#if REFLEX_FORMAT_MODE_OFFSET
+    if (schema->FormatMode == Reflex_FormatMode_Offset) {
+        pobj = layer->Obj + fmt->Offset;
+        layer->PObj = pobj;
+        size = Reflex_Inline_itemSize(fmt);
+    }
+    else
+#endif
+#if REFLEX_FORMAT_MODE_PRIMARY
+    if (schema->FormatMode == Reflex_FormatMode_Primary) {
+        size = REFLEX_INLINE_TYPE_SIZE[fmt->Fields.Primary];
+        pobj = Reflex_Inline_alignAddress(layer->PObj, size);
+        layer->PObj = pobj + size;
+    }
+    else
+#endif
+    {
+        size = Reflex_Inline_itemSize(fmt);
+        pobj = Reflex_Inline_alignAddress(layer->PObj, size);
+        layer->PObj = pobj + Reflex_Inline_fieldSize(fmt);
+    }
+    if (layer->BiggestField < size) {
+        layer->BiggestField = size;
+    }
+    (void) schema;
+
+    return pobj;
+}
+/**
+ * @brief This function called after visit of primary field
+ *
+ * @param reflex
+ */
+REFLEX_INLINE void Reflex_Inline_fieldDone(Reflex* reflex) {
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->VarIndex++;
+#else
+    (void) reflex;
+#endif
+}
+/**
+ * @brief This function finish scan of object
+ *
+ * @param reflex
+ * @param layer
+ */
+REFLEX_INLINE void Reflex_Inline_end(Reflex* reflex, Reflex_InlineLayer* layer) {
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    reflex->PObj = Reflex_Inline_alignAddress(layer->PObj, layer->BiggestField);
+    if (reflex->AlignSize < layer->BiggestField) {
+        reflex->AlignSize = layer->BiggestField;
+    }
+#else
+    (void) reflex;
+    (void) layer;
+#endif
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function continue layer after complex field
+ *
+ * @param reflex
+ * @param layer
+ */
+REFLEX_INLINE void Reflex_Inline_complexDone(Reflex* reflex, Reflex_InlineLayer* layer) {
+    if (layer->BiggestField < reflex->AlignSize) {
+        layer->BiggestField = reflex->AlignSize;
+    }
+    layer->PObj = (uint8_t*) reflex->PObj;
+}
+/**
+ * @brief This function check complex field is a pointer or array of pointers
+ *
+ * @param fmt
+ * @return uint8_t
+ */
+REFLEX_INLINE uint8_t Reflex_Inline_isPointer(const Reflex_TypeParams* fmt) {
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            return 1;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            return 1;
+    #endif
+        default:
+            return 0;
+    }
+}
+/**
+ * @brief This function prepare frame for complex field of owner layer, visitor of begin must be called after it
+ *
+ * @param frame
+ * @param owner layer that own complex field
+ * @param fmt
+ */
+REFLEX_INLINE void Reflex_Inline_open(Reflex_InlineFrame* frame, const Reflex_InlineLayer* owner, const Reflex_TypeParams* fmt) {
+    frame->Parent = owner->Schema;
+    frame->Complex = fmt;
+    frame->Field = owner->PObj;
+    frame->Element = owner->PObj;
+}
+/**
+ * @brief This function enter into complex field and find number of rows and columns of it's elements
+ *
+ * @param reflex
+ * @param frame
+ */
+REFLEX_INLINE void Reflex_Inline_beginComplex(Reflex* reflex, Reflex_InlineFrame* frame) {
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->LayerIndex++;
+#else
+    (void) reflex;
+#endif
+    frame->InRow = 0;
+    frame->Entered = 0;
+    frame->Rows = 1;
+    switch (frame->Complex->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+            frame->Cols = frame->Complex->Len;
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            frame->Cols = frame->Complex->Len;
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            frame->Rows = frame->Complex->MLen;
+            frame->Cols = frame->Complex->Len;
+            break;
+    #endif
+        default:
+            frame->Cols = 1;
+            break;
+    }
+}
+/**
+ * @brief This function leave complex field
+ *
+ * @param reflex
+ */
+REFLEX_INLINE void Reflex_Inline_endComplex(Reflex* reflex) {
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->LayerIndex--;
+#else
+    (void) reflex;
+#endif
+}
+/**
+ * @brief This function check break of elements of complex array
+ *
+ * @param reflex
+ * @param fmt
+ * @return uint8_t 1 if rest of row must be skipped
+ */
+REFLEX_INLINE uint8_t Reflex_Inline_breakLayer(Reflex* reflex, const Reflex_TypeParams* fmt) {
+#if REFLEX_SUPPORT_BREAK_LAYER
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+    #endif
+            if (reflex->BreakLayer) {
+                reflex->BreakLayer = 0;
+                return 1;
+            }
+            return 0;
+        default:
+            return 0;
+    }
+#else
+    (void) reflex;
+    (void) fmt;
+    return 0;
+#endif
+}
+/**
+ * @brief This function check break of rows of complex 2D array
+ *
+ * @param reflex
+ * @param fmt
+ * @return uint8_t 1 if rest of rows must be skipped
+ */
+REFLEX_INLINE uint8_t Reflex_Inline_breakRow(Reflex* reflex, const Reflex_TypeParams* fmt) {
+#if REFLEX_SUPPORT_BREAK_LAYER && REFLEX_SUPPORT_TYPE_ARRAY_2D
+    if (fmt->Fields.Category == Reflex_Category_Array2D && reflex->BreakLayer2D) {
+        reflex->BreakLayer = 0;
+        reflex->BreakLayer2D = 0;
+        return 1;
+    }
+#else
+    (void) reflex;
+    (void) fmt;
+#endif
+    return 0;
+}
+/**
+ * @brief This function move frame to next element of complex field, it's same as nested loops
+ * over rows and columns of Reflex scan functions
+ *
+ * @param reflex
+ * @param frame
+ * @param result result of scan so far
+ * @return uint8_t 1 if there is an element to scan
+ */
+REFLEX_INLINE uint8_t Reflex_Inline_nextElement(Reflex* reflex, Reflex_InlineFrame* frame, Reflex_Result result) {
+    if (frame->InRow) {
+        if (!Reflex_Inline_breakLayer(reflex, frame->Complex) && frame->Col-- > 0 && result == REFLEX_OK) {
+            return 1;
+        }
+        if (Reflex_Inline_breakRow(reflex, frame->Complex)) {
+            return 0;
+        }
+    }
+    while (frame->Rows-- > 0 && result == REFLEX_OK) {
+        frame->InRow = 1;
+        frame->Col = frame->Cols;
+        if (frame->Col-- > 0) {
+            return 1;
+        }
+        if (Reflex_Inline_breakRow(reflex, frame->Complex)) {
+            return 0;
+        }
+    }
+
+    return 0;
+}
+/**
+ * @brief This function enter into current element of complex field
+ *
+ * @param reflex
+ * @param frame
+ * @return uint8_t* address of object of element
+ */
+REFLEX_INLINE uint8_t* Reflex_Inline_enter(Reflex* reflex, Reflex_InlineFrame* frame) {
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->VarOffset += reflex->VarIndex;
+#endif
+    reflex->Schema = frame->Complex->Schema;
+    frame->Entered = 1;
+
+    return Reflex_Inline_isPointer(frame->Complex) ? *(uint8_t**) frame->Element : frame->Element;
+}
+/**
+ * @brief This function leave current element of complex field and move to address of next element
+ *
+ * @param reflex
+ * @param frame
+ */
+REFLEX_INLINE void Reflex_Inline_leave(Reflex* reflex, Reflex_InlineFrame* frame) {
+    reflex->Schema = frame->Parent;
+    frame->Entered = 0;
+    if (Reflex_Inline_isPointer(frame->Complex)) {
+    #if REFLEX_SUPPORT_MAIN_OBJ
+        reflex->MainObject = frame->Element;
+    #endif
+        frame->Element += sizeof(void*);
+        reflex->PObj = frame->Element;
+    }
+    else {
+        frame->Element = (uint8_t*) reflex->PObj;
+    }
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function initialize reflex for a new scan
+ *
+ * @param reflex
+ * @param schema
+ * @param obj
+ */
+REFLEX_INLINE void Reflex_Inline_init(Reflex* reflex, const Reflex_Schema* schema, void* obj) {
+    reflex->Schema = schema;
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    reflex->PObj = obj;
+    reflex->AlignSize = 1;
+#if REFLEX_SUPPORT_VAR_INDEX
+    reflex->VarOffset = 0;
+    reflex->LayerIndex = 0;
+#endif
+#else
+    (void) obj;
+#endif
+}
+
+/* ------------------------------------ Generator Macros ----------------------------------- */
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This macro generate scan function of complex fields, nested schemas are scanned
+ * with a stack of frames, nesting deeper than REFLEX_MAX_DEPTH is error
+ */
+#define __REFLEX_INLINE_SCAN_COMPLEX(NAME, VISITOR) \
+static Reflex_Result NAME ##_complex(Reflex* reflex, Reflex_InlineLayer* owner, const Reflex_TypeParams* fmt) { \
+    Reflex_InlineFrame frames[REFLEX_MAX_DEPTH]; \
+    Reflex_InlineFrame* frame = frames; \
+    Reflex_Result result = REFLEX_OK; \
+    Reflex_Inline_open(frame, owner, fmt); \
+    VISITOR(reflex, frame->Field, fmt); \
+    Reflex_Inline_beginComplex(reflex, frame); \
+    for (;;) { \
+        if (frame->Entered) { \
+            if (result == REFLEX_OK && (fmt = Reflex_Inline_next(&frame->Layer, frame->Layer.Schema)) != NULL) { \
+                if (!Reflex_Inline_isComplex(frame->Layer.Schema, fmt)) { \
+                    result = VISITOR(reflex, Reflex_Inline_field(&frame->Layer, frame->Layer.Schema, fmt), fmt); \
+                    Reflex_Inline_fieldDone(reflex); \
+                } \
+                else if (frame == &frames[REFLEX_MAX_DEPTH - 1]) { \
+                    result = REFLEX_ERROR; \
+                } \
+                else { \
+                    Reflex_Inline_open(frame + 1, &frame->Layer, fmt); \
+                    frame++; \
+                    VISITOR(reflex, frame->Field, fmt); \
+                    Reflex_Inline_beginComplex(reflex, frame); \
+                } \
+                continue; \
+            } \
+            Reflex_Inline_end(reflex, &frame->Layer); \
+            Reflex_Inline_leave(reflex, frame); \
+        } \
+        if (Reflex_Inline_nextElement(reflex, frame, result)) { \
+            Reflex_Inline_begin(reflex, &frame->Layer, frame->Complex->Schema, Reflex_Inline_enter(reflex, frame)); \
+            continue; \
+        } \
+        Reflex_Inline_endComplex(reflex); \
+        VISITOR(reflex, frame->Field, frame->Complex); \
+        if (frame == frames) { \
+            Reflex_Inline_complexDone(reflex, owner); \
+            return result; \
+        } \
+        frame--; \
+        Reflex_Inline_complexDone(reflex, &frame->Layer); \
+    } \
+}
+#define __REFLEX_INLINE_COMPLEX(NAME, layer, fmt) \
+            result = NAME ##_complex(reflex, &layer, fmt);
+#else
+#define __REFLEX_INLINE_SCAN_COMPLEX(NAME, VISITOR)
+#define __REFLEX_INLINE_COMPLEX(NAME, layer, fmt)
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This macro generate a scan function for SCHEMA that call VISITOR directly for each field
+ * generated function: Reflex_Result NAME(Reflex* reflex, void* obj)
+ * Note: VISITOR must be a function or macro with Reflex_OnFieldFn signature
+ * Note: SCHEMA must be a const Reflex_Schema object, fields of top level are unrolled
+ * by compiler, nested schemas are scanned by a non-recursive helper
+ *
+ * @param NAME name of generated function
+ * @param SCHEMA schema of object
+ * @param VISITOR visitor of fields
+ */
+#define REFLEX_INLINE_SCAN(NAME, SCHEMA, VISITOR) \
+__REFLEX_INLINE_SCAN_COMPLEX(NAME, VISITOR) \
+REFLEX_INLINE Reflex_Result NAME(Reflex* reflex, void* obj) { \
+    Reflex_Result result = REFLEX_OK; \
+    Reflex_InlineLayer layer; \
+    const Reflex_TypeParams* fmt; \
+    Reflex_Inline_init(reflex, &(SCHEMA), obj); \
+    Reflex_Inline_begin(reflex, &layer, &(SCHEMA), (uint8_t*) obj); \
+    while (result == REFLEX_OK && (fmt = Reflex_Inline_next(&layer, &(SCHEMA))) != NULL) { \
+        if (Reflex_Inline_isComplex(&(SCHEMA), fmt)) { \
+            __REFLEX_INLINE_COMPLEX(NAME, layer, fmt) \
+        } \
+        else { \
+            result = VISITOR(reflex, Reflex_Inline_field(&layer, &(SCHEMA), fmt), fmt); \
+            Reflex_Inline_fieldDone(reflex); \
+        } \
+    } \
+    Reflex_Inline_end(reflex, &layer); \
+    return result; \
+}
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _REFLEX_INLINE_H_
@@ -0,0 +1,2648 @@
+#include "ReflexJson.h"
+
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER
+
+#include <string.h>
+
+#if REFLEX_SUPPORT_PLAN
+    #include <stdlib.h>
+    #include <float.h>
+    #include "ReflexSimd.h"
+#endif
+
+/* ------------------------------------ Private typedef ----------------------------------- */
+/**
+ * @brief This function write an item of a primary type
+ *
+ * @param writer
+ * @param item address of item
+ */
+typedef void (*Reflex_JsonPutFn)(Reflex_JsonWriter* writer, const void* item);
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This object hold a parsed number, value is Mantissa * 10^Exponent
+ */
+typedef struct {
+    uint64_t                            Mantissa;
+    int32_t                             Exponent;
+    Reflex_PtrType                      Start;                          /**< position of number in text */
+    Reflex_PtrType                      End;
+    uint8_t                             Sign;
+    uint8_t                             Integer;                        /**< number has no fraction and exponent */
+    uint8_t                             Many;                           /**< digits are dropped, mantissa is not exact */
+} Reflex_JsonNumber;
+#endif // REFLEX_SUPPORT_PLAN
+
+/* ------------------------------------------ Private Macro ----------------------------------- */
+#define __putChar(W, C)                     if ((W)->Len < (W)->Size) { \
+                                                (W)->Buf[(W)->Len] = (C); \
+                                            } \
+                                            (W)->Len++
+#define __putText(W, TEXT)                  Reflex_Json_write((W), (TEXT), sizeof(TEXT) - 1)
+// fields are ignored after nested complex fields are deeper than REFLEX_MAX_DEPTH
+#define __ignored(W)                        ((W)->Depth > REFLEX_MAX_DEPTH)
+/**
+ * @brief This macro define put function of an integer type
+ */
+#define __jsonPutIntFn(NAME, TYPE, FORMAT)  static void NAME(Reflex_JsonWriter* writer, const void* item) { \
+                                                char text[REFLEX_JSON_NUMBER_LEN]; \
+                                                Reflex_Json_write(writer, text, (Reflex_PtrType) FORMAT(text, *(const TYPE*) item)); \
+                                            }
+/**
+ * @brief This macro define compact function of a primary type
+ */
+#define __jsonFieldFn(NAME, TYPE, PUT)      static Reflex_Result NAME(Reflex* reflex, void* value, const void* fmt) { \
+                                                return Reflex_Json_field(reflex, (const uint8_t*) value, (const Reflex_TypeParams*) fmt, PUT, (Reflex_LenType) sizeof(TYPE)); \
+                                            }
+// helpers of Ryu
+#define __pow5bits(E)                       ((int32_t) ((((uint32_t) (E)) * 1217359) >> 19) + 1)
+#define __log10Pow2(E)                      ((uint32_t) ((((uint32_t) (E)) * 78913) >> 18))
+#define __log10Pow5(E)                      ((uint32_t) ((((uint32_t) (E)) * 732923) >> 20))
+#define REFLEX_JSON_FLOAT_POW5_INV_BITS     59
+#define REFLEX_JSON_FLOAT_POW5_BITS         61
+#define REFLEX_JSON_DOUBLE_POW5_INV_BITS    125
+#define REFLEX_JSON_DOUBLE_POW5_BITS        125
+#if REFLEX_SUPPORT_PLAN
+#define __peek(R)                           ((R)->Pos < (R)->TextLen ? (R)->Text[(R)->Pos] : '\0')
+#define __isDigit(C)                        ((uint8_t) ((C) - '0') < 10)
+// exact float arithmetic is needed for fast path of numbers
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    #define REFLEX_JSON_FAST_FLOAT          1
+#else
+    #define REFLEX_JSON_FAST_FLOAT          0
+#endif
+#if REFLEX_SIMD_VECTOR_SIZE && (defined(__GNUC__) || defined(__clang__))
+    #define REFLEX_JSON_SIMD                1
+    // bytes that finish a run of string: quote, backslash and control characters
+    #define __stringMask(P)                 __maskVector(__orVector(__orVector(__equalVector(__loadVector(P), '"'), __equalVector(__loadVector(P), '\\')), \
+                                                                    __lessVector(__loadVector(P), 0x20)))
+    // quote and brackets, '[' | 0x20 is '{' and ']' | 0x20 is '}'
+    #define __structMask(P)                 __maskVector(__orVector(__equalVector(__loadVector(P), '"'), \
+                                                                    __orVector(__equalVector(__orVector(__loadVector(P), __byteVector(0x20)), '{'), \
+                                                                               __equalVector(__orVector(__loadVector(P), __byteVector(0x20)), '}'))))
+    #define __firstByte(M)                  ((Reflex_PtrType) __builtin_ctzll(M) / REFLEX_SIMD_MASK_BITS)
+#else
+    #define REFLEX_JSON_SIMD                0
+#endif
+/**
+ * @brief This macro store an unsigned integer if number is an integer in range of type
+ */
+#define __readUInt(R, N, ITEM, TYPE, MAX)   if (!(N).Integer || (N).Many || ((N).Sign && (N).Mantissa != 0) || (N).Mantissa > (MAX)) { \
+                                                (R)->Error = 1; \
+                                            } \
+                                            else { \
+                                                *(TYPE*) (ITEM) = (TYPE) (N).Mantissa; \
+                                            }
+/**
+ * @brief This macro store a signed integer if number is an integer in range of type
+ */
+#define __readInt(R, N, ITEM, TYPE, MAX)    if (!(N).Integer || (N).Many || (N).Mantissa > (uint64_t) (MAX) + (N).Sign) { \
+                                                (R)->Error = 1; \
+                                            } \
+                                            else if ((N).Sign && (N).Mantissa != 0) { \
+                                                *(TYPE*) (ITEM) = (TYPE) (-(int64_t) ((N).Mantissa - 1) - 1); \
+                                            } \
+                                            else { \
+                                                *(TYPE*) (ITEM) = (TYPE) (N).Mantissa; \
+                                            }
+#endif // REFLEX_SUPPORT_PLAN
+
+/* ------------------------------------ Private Functions ---------------------------------- */
+static void            Reflex_Json_write(Reflex_JsonWriter* writer, const char* text, Reflex_PtrType len);
+static void            Reflex_Json_string(Reflex_JsonWriter* writer, const char* str, Reflex_LenType len);
+static void            Reflex_Json_key(Reflex* reflex, Reflex_JsonWriter* writer, const void* fmt);
+static void            Reflex_Json_close(Reflex_JsonWriter* writer, const Reflex_JsonFrame* frame);
+static uint8_t         Reflex_Json_named(const Reflex_Schema* schema);
+static void            Reflex_Json_array(Reflex_JsonWriter* writer, const uint8_t* items, Reflex_LenType len, Reflex_JsonPutFn put, Reflex_LenType itemSize);
+static Reflex_Result   Reflex_Json_field(Reflex* reflex, const uint8_t* value, const Reflex_TypeParams* fmt, Reflex_JsonPutFn put, Reflex_LenType itemSize);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+static Reflex_Result   Reflex_Json_complexBegin(Reflex* reflex, void* value, const void* fmt);
+static Reflex_Result   Reflex_Json_complexEnd(Reflex* reflex, void* value, const void* fmt);
+#endif
+static char*           Reflex_Json_digits(char* end, uint64_t value);
+static Reflex_LenType  Reflex_Json_decimal(char* out, uint8_t sign, uint64_t digits, int32_t exponent);
+static uint32_t        Reflex_Json_pow5Factor(uint64_t value);
+static uint32_t        Reflex_Json_mulShift32(uint32_t m, uint64_t factor, int32_t shift);
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+static uint64_t        Reflex_Json_mulShift64(uint64_t m, const uint64_t* mul, int32_t shift);
+#endif
+static void            Reflex_Json_putChar(Reflex_JsonWriter* writer, const void* item);
+static void            Reflex_Json_putFloat(Reflex_JsonWriter* writer, const void* item);
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+static void            Reflex_Json_putDouble(Reflex_JsonWriter* writer, const void* item);
+#endif
+#if REFLEX_SUPPORT_PLAN
+static uint32_t        Reflex_Json_hash(const char* name, Reflex_PtrType len, Reflex_LenType scope);
+static Reflex_LenType  Reflex_Json_find(const Reflex_JsonReader* reader, Reflex_LenType scope, const char* name, Reflex_PtrType len);
+static void            Reflex_Json_space(Reflex_JsonReader* reader);
+static void            Reflex_Json_expect(Reflex_JsonReader* reader, char c);
+static uint8_t         Reflex_Json_null(Reflex_JsonReader* reader);
+static uint8_t         Reflex_Json_open(Reflex_JsonReader* reader, char c);
+static uint8_t         Reflex_Json_more(Reflex_JsonReader* reader, char close);
+static Reflex_LenType  Reflex_Json_readKey(Reflex_JsonReader* reader, Reflex_LenType scope);
+static void            Reflex_Json_readObject(Reflex_JsonReader* reader, Reflex_LenType scope, uint8_t named, uint8_t* base);
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+static void            Reflex_Json_readComplex(Reflex_JsonReader* reader, Reflex_LenType op, uint8_t* field);
+static void            Reflex_Json_readElement(Reflex_JsonReader* reader, Reflex_LenType op, uint8_t* field, Reflex_LenType index);
+static Reflex_LenType  Reflex_Json_elements(const Reflex_TypeParams* fmt);
+#endif
+static void            Reflex_Json_readField(Reflex_JsonReader* reader, const Reflex_TypeParams* fmt, uint8_t* field);
+static void            Reflex_Json_readItems(Reflex_JsonReader* reader, uint8_t type, uint8_t* items, Reflex_LenType len);
+static void            Reflex_Json_readItem(Reflex_JsonReader* reader, uint8_t type, uint8_t* item);
+static void            Reflex_Json_readText(Reflex_JsonReader* reader, char* out, Reflex_LenType size);
+static Reflex_PtrType  Reflex_Json_readString(Reflex_JsonReader* reader, char* out, Reflex_PtrType size);
+static uint8_t         Reflex_Json_escape(Reflex_JsonReader* reader, char* out);
+static int32_t         Reflex_Json_hex(const char* text);
+static void            Reflex_Json_readNumber(Reflex_JsonReader* reader, Reflex_JsonNumber* num);
+static uint8_t         Reflex_Json_numberText(Reflex_JsonReader* reader, const Reflex_JsonNumber* num, char* text);
+static float           Reflex_Json_toFloat(Reflex_JsonReader* reader, const Reflex_JsonNumber* num);
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+static double          Reflex_Json_toDouble(Reflex_JsonReader* reader, const Reflex_JsonNumber* num);
+#endif
+static void            Reflex_Json_skip(Reflex_JsonReader* reader);
+static Reflex_PtrType  Reflex_Json_scanString(const char* text, Reflex_PtrType pos, Reflex_PtrType len);
+static Reflex_PtrType  Reflex_Json_scanStruct(const char* text, Reflex_PtrType pos, Reflex_PtrType len);
+#endif // REFLEX_SUPPORT_PLAN
+
+__jsonPutIntFn(Reflex_Json_putUInt8, uint8_t, Reflex_Json_formatUInt)
+__jsonPutIntFn(Reflex_Json_putInt8, int8_t, Reflex_Json_formatInt)
+__jsonPutIntFn(Reflex_Json_putUInt16, uint16_t, Reflex_Json_formatUInt)
+__jsonPutIntFn(Reflex_Json_putInt16, int16_t, Reflex_Json_formatInt)
+__jsonPutIntFn(Reflex_Json_putUInt32, uint32_t, Reflex_Json_formatUInt)
+__jsonPutIntFn(Reflex_Json_putInt32, int32_t, Reflex_Json_formatInt)
+#if REFLEX_SUPPORT_TYPE_64BIT
+__jsonPutIntFn(Reflex_Json_putUInt64, uint64_t, Reflex_Json_formatUInt)
+__jsonPutIntFn(Reflex_Json_putInt64, int64_t, Reflex_Json_formatInt)
+#endif
+
+__jsonFieldFn(Reflex_Json_onChar, char, Reflex_Json_putChar)
+__jsonFieldFn(Reflex_Json_onUInt8, uint8_t, Reflex_Json_putUInt8)
+__jsonFieldFn(Reflex_Json_onInt8, int8_t, Reflex_Json_putInt8)
+__jsonFieldFn(Reflex_Json_onUInt16, uint16_t, Reflex_Json_putUInt16)
+__jsonFieldFn(Reflex_Json_onInt16, int16_t, Reflex_Json_putInt16)
+__jsonFieldFn(Reflex_Json_onUInt32, uint32_t, Reflex_Json_putUInt32)
+__jsonFieldFn(Reflex_Json_onInt32, int32_t, Reflex_Json_putInt32)
+#if REFLEX_SUPPORT_TYPE_64BIT
+__jsonFieldFn(Reflex_Json_onUInt64, uint64_t, Reflex_Json_putUInt64)
+__jsonFieldFn(Reflex_Json_onInt64, int64_t, Reflex_Json_putInt64)
+#endif
+__jsonFieldFn(Reflex_Json_onFloat, float, Reflex_Json_putFloat)
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+__jsonFieldFn(Reflex_Json_onDouble, double, Reflex_Json_putDouble)
+#endif
+
+/* ------------------------------------ Private Variables ---------------------------------- */
+// pairs of decimal digits from 00 to 99
+static const char REFLEX_JSON_DIGITS[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+static const char REFLEX_JSON_HEX[16] = {
+    '0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F',
+};
+#if REFLEX_SUPPORT_PLAN
+static const uint8_t REFLEX_JSON_ITEM_SIZE[Reflex_PrimaryType_Length] = {
+    [Reflex_PrimaryType_Char]       = sizeof(char),
+    [Reflex_PrimaryType_UInt8]      = sizeof(uint8_t),
+    [Reflex_PrimaryType_Int8]       = sizeof(int8_t),
+    [Reflex_PrimaryType_UInt16]     = sizeof(uint16_t),
+    [Reflex_PrimaryType_Int16]      = sizeof(int16_t),
+    [Reflex_PrimaryType_UInt32]     = sizeof(uint32_t),
+    [Reflex_PrimaryType_Int32]      = sizeof(int32_t),
+#if REFLEX_SUPPORT_TYPE_64BIT
+    [Reflex_PrimaryType_UInt64]     = sizeof(uint64_t),
+    [Reflex_PrimaryType_Int64]      = sizeof(int64_t),
+#endif
+    [Reflex_PrimaryType_Float]      = sizeof(float),
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+    [Reflex_PrimaryType_Double]     = sizeof(double),
+#endif
+};
+// exact powers of 10 for fast path of numbers
+static const float REFLEX_JSON_FLOAT_POW10[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+static const double REFLEX_JSON_DOUBLE_POW10[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+#endif
+#endif // REFLEX_SUPPORT_PLAN
+// ceil(2^(bits(5^i) - 1 + 59) / 5^i) for float, index is decimal exponent of positive binary exponents
+static const uint64_t REFLEX_JSON_FLOAT_POW5_INV[32] = {
+    0x0800000000000001ULL, 0x0666666666666667ULL, 0x051EB851EB851EB9ULL,
+    0x04189374BC6A7EFAULL, 0x068DB8BAC710CB2AULL, 0x053E2D6238DA3C22ULL,
+    0x0431BDE82D7B634EULL, 0x06B5FCA6AF2BD216ULL, 0x055E63B88C230E78ULL,
+    0x044B82FA09B5A52DULL, 0x06DF37F675EF6EAEULL, 0x057F5FF85E592558ULL,
+    0x0465E6604B7A8447ULL, 0x0709709A125DA071ULL, 0x05A126E1A84AE6C1ULL,
+    0x0480EBE7B9D58567ULL, 0x0734ACA5F6226F0BULL, 0x05C3BD5191B525A3ULL,
+    0x049C97747490EAE9ULL, 0x0760F253EDB4AB0EULL, 0x05E72843249088D8ULL,
+    0x04B8ED0283A6D3E0ULL, 0x078E480405D7B966ULL, 0x060B6CD004AC9452ULL,
+    0x04D5F0A66A23A9DBULL, 0x07BCB43D769F762BULL, 0x063090312BB2C4EFULL,
+    0x04F3A68DBC8F03F3ULL, 0x07EC3DAF94180651ULL, 0x065697BFA9ACD1DAULL,
+    0x051212FFBAF0A7E2ULL, 0x040E7599625A1FE8ULL,
+};
+// 5^i >> (bits(5^i) - 61) for float, index is negative decimal exponent of negative binary exponents
+static const uint64_t REFLEX_JSON_FLOAT_POW5[48] = {
+    0x1000000000000000ULL, 0x1400000000000000ULL, 0x1900000000000000ULL,
+    0x1F40000000000000ULL, 0x1388000000000000ULL, 0x186A000000000000ULL,
+    0x1E84800000000000ULL, 0x1312D00000000000ULL, 0x17D7840000000000ULL,
+    0x1DCD650000000000ULL, 0x12A05F2000000000ULL, 0x174876E800000000ULL,
+    0x1D1A94A200000000ULL, 0x12309CE540000000ULL, 0x16BCC41E90000000ULL,
+    0x1C6BF52634000000ULL, 0x11C37937E0800000ULL, 0x16345785D8A00000ULL,
+    0x1BC16D674EC80000ULL, 0x1158E460913D0000ULL, 0x15AF1D78B58C4000ULL,
+    0x1B1AE4D6E2EF5000ULL, 0x10F0CF064DD59200ULL, 0x152D02C7E14AF680ULL,
+    0x1A784379D99DB420ULL, 0x108B2A2C28029094ULL, 0x14ADF4B7320334B9ULL,
+    0x19D971E4FE8401E7ULL, 0x1027E72F1F128130ULL, 0x1431E0FAE6D7217CULL,
+    0x193E5939A08CE9DBULL, 0x1F8DEF8808B02452ULL, 0x13B8B5B5056E16B3ULL,
+    0x18A6E32246C99C60ULL, 0x1ED09BEAD87C0378ULL, 0x13426172C74D822BULL,
+    0x1812F9CF7920E2B6ULL, 0x1E17B84357691B64ULL, 0x12CED32A16A1B11EULL,
+    0x178287F49C4A1D66ULL, 0x1D6329F1C35CA4BFULL, 0x125DFA371A19E6F7ULL,
+    0x16F578C4E0A060B5ULL, 0x1CB2D6F618C878E3ULL, 0x11EFC659CF7D4B8DULL,
+    0x166BB7F0435C9E71ULL, 0x1C06A5EC5433C60DULL, 0x118427B3B4A05BC8ULL,
+};
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+// 128-bit ceil(2^(bits(5^i) - 1 + 125) / 5^i) for double, low part is first
+static const uint64_t REFLEX_JSON_DOUBLE_POW5_INV[342][2] = {
+    { 0x0000000000000001ULL, 0x2000000000000000ULL }, { 0x999999999999999AULL, 0x1999999999999999ULL },
+    { 0x47AE147AE147AE15ULL, 0x147AE147AE147AE1ULL }, { 0x6C8B4395810624DEULL, 0x10624DD2F1A9FBE7ULL },
+    { 0x7A786C226809D496ULL, 0x1A36E2EB1C432CA5ULL }, { 0x61F9F01B866E43ABULL, 0x14F8B588E368F084ULL },
+    { 0xB4C7F34938583622ULL, 0x10C6F7A0B5ED8D36ULL }, { 0x87A6520EC08D236AULL, 0x1AD7F29ABCAF4857ULL },
+    { 0x9FB841A566D74F88ULL, 0x15798EE2308C39DFULL }, { 0xE62D01511F12A607ULL, 0x112E0BE826D694B2ULL },
+    { 0xD6AE6881CB5109A4ULL, 0x1B7CDFD9D7BDBAB7ULL }, { 0xDEF1ED34A2A73AEAULL, 0x15FD7FE17964955FULL },
+    { 0x7F27F0F6E885C8BBULL, 0x119799812DEA1119ULL }, { 0x650CB4BE40D60DF8ULL, 0x1C25C268497681C2ULL },
+    { 0xEA70909833DE7193ULL, 0x16849B86A12B9B01ULL }, { 0x21F3A6E0297EC143ULL, 0x1203AF9EE756159BULL },
+    { 0x6985D7CD0F313537ULL, 0x1CD2B297D889BC2BULL }, { 0x2137DFD73F5A90F9ULL, 0x170EF54646D49689ULL },
+    { 0xE75FE645CC4873FAULL, 0x12725DD1D243ABA0ULL }, { 0xA5663D3C7A0D865DULL, 0x1D83C94FB6D2AC34ULL },
+    { 0x511E976394D79EB1ULL, 0x179CA10C9242235DULL }, { 0xDA7EDF82DD794BC1ULL, 0x12E3B40A0E9B4F7DULL },
+    { 0x2A6498D1625BAC68ULL, 0x1E392010175EE596ULL }, { 0xEEB6E0A781E2F053ULL, 0x182DB34012B25144ULL },
+    { 0x58924D52CE4F26A9ULL, 0x1357C299A88EA76AULL }, { 0x27507BB7B07EA441ULL, 0x1EF2D0F5DA7DD8AAULL },
+    { 0x52A6C95FC0655034ULL, 0x18C240C4AECB13BBULL }, { 0x0EEBD44C99EAA690ULL, 0x13CE9A36F23C0FC9ULL },
+    { 0xB17953ADC3110A80ULL, 0x1FB0F6BE50601941ULL }, { 0xC12DDC8B02740867ULL, 0x195A5EFEA6B34767ULL },
+    { 0x3424B06F3529A052ULL, 0x14484BFEEBC29F86ULL }, { 0x901D59F290EE19DBULL, 0x1039D66589687F9EULL },
+    { 0x4CFBC31DB4B0295FULL, 0x19F623D5A8A73297ULL }, { 0x3D9635B15D59BAB2ULL, 0x14C4E977BA1F5BACULL },
+    { 0x97AB5E277DE16228ULL, 0x109D8792FB4C4956ULL }, { 0xF2ABC9D8C9689D0DULL, 0x1A95A5B7F87A0EF0ULL },
+    { 0x5BBCA17A3ABA173EULL, 0x154484932D2E725AULL }, { 0xAFCA1AC82EFB45CBULL, 0x11039D428A8B8EAEULL },
+    { 0xB2DCF7A6B1920945ULL, 0x1B38FB9DAA78E44AULL }, { 0xF57D92EBC141A104ULL, 0x15C72FB1552D836EULL },
+    { 0xC46475896767B403ULL, 0x116C262777579C58ULL }, { 0x6D6D88DBD8A5ECD2ULL, 0x1BE03D0BF225C6F4ULL },
+    { 0x8ABE071646EB23DBULL, 0x164CFDA3281E38C3ULL }, { 0x6EFE6C11D255B649ULL, 0x11D7314F534B609CULL },
+    { 0xB197134FB6EF8A0EULL, 0x1C8B821885456760ULL }, { 0x27AC0F72F8BFA1A5ULL, 0x16D601AD376AB91AULL },
+    { 0xB95672C260994E1EULL, 0x1244CE242C5560E1ULL }, { 0xF5571E03CDC21695ULL, 0x1D3AE36D13BBCE35ULL },
+    { 0x2AAC18030B01ABABULL, 0x17624F8A762FD82BULL }, { 0xBBBCE0026F348956ULL, 0x12B50C6EC4F31355ULL },
+    { 0x92C7CCD0B1EDA889ULL, 0x1DEE7A4AD4B81EEFULL }, { 0xDBD30A408E57BA07ULL, 0x17F1FB6F10934BF2ULL },
+    { 0x7CA8D50071DFC806ULL, 0x1327FC58DA0F6FF5ULL }, { 0xFAA7BB33E9660CD6ULL, 0x1EA6608E29B24CBBULL },
+    { 0x9552FC298784D711ULL, 0x18851A0B548EA3C9ULL }, { 0xAAA8C9BAD2D0AC0EULL, 0x139DAE6F76D88307ULL },
+    { 0xDDDADC5E1E1AACE3ULL, 0x1F62B0B257C0D1A5ULL }, { 0x7E48B04B4B488A4FULL, 0x191BC08EAC9A4151ULL },
+    { 0xCB6D59D5D5D3A1D9ULL, 0x141633A556E1CDDAULL }, { 0x3C577B1177DC817BULL, 0x1011C2EAABE7D7E2ULL },
+    { 0xC6F25E825960CF2AULL, 0x19B604AAACA62636ULL }, { 0x6BF518684780A5BBULL, 0x14919D5556EB51C5ULL },
+    { 0x232A79ED06008496ULL, 0x10747DDDDF22A7D1ULL }, { 0xD1DD8FE1A3340756ULL, 0x1A53FC9631D10C81ULL },
+    { 0xA7E4731AE8F66C45ULL, 0x150FFD44F4A73D34ULL }, { 0x531D28E253F8569EULL, 0x10D9976A5D52975DULL },
+    { 0xEB61DB03B98D5762ULL, 0x1AF5BF109550F22EULL }, { 0xBC4E48CFC7A445E8ULL, 0x159165A6DDDA5B58ULL },
+    { 0x6371D3D96C836B20ULL, 0x11411E1F17E1E2ADULL }, { 0x9F1C8628AD9F11CDULL, 0x1B9B6364F3030448ULL },
+    { 0xE5B06B53BE18DB0BULL, 0x1615E91D8F359D06ULL }, { 0xEAF3890FCB4715A2ULL, 0x11AB20E472914A6BULL },
+    { 0x44B8DB4C7871BC37ULL, 0x1C45016D841BAA46ULL }, { 0x03C715D6C6C1635FULL, 0x169D9ABE03495505ULL },
+    { 0x3638DE456BCDE919ULL, 0x1217AEFE69077737ULL }, { 0x56C163A2461641C1ULL, 0x1CF2B1970E725858ULL },
+    { 0xDF011C81D1AB67CEULL, 0x17288E1271F51379ULL }, { 0x7F3416CE4155ECA5ULL, 0x1286D80EC190DC61ULL },
+    { 0x6520247D3556476EULL, 0x1DA48CE468E7C702ULL }, { 0xEA801D30F7783925ULL, 0x17B6D71D20B96C01ULL },
+    { 0xBB99B0F3F92CFA84ULL, 0x12F8AC174D612334ULL }, { 0x5F5C4E532847F739ULL, 0x1E5AACF215683854ULL },
+    { 0x7F7D0B75B9D32C2EULL, 0x18488A5B44536043ULL }, { 0x9930D5F7C7DC2358ULL, 0x136D3B7C36A919CFULL },
+    { 0x8EB4898C72F9D226ULL, 0x1F152BF9F10E8FB2ULL }, { 0x722A07A38F2E41B8ULL, 0x18DDBCC7F40BA628ULL },
+    { 0xC1BB394FA5BE9AFAULL, 0x13E497065CD61E86ULL }, { 0x9C5EC2190930F7F6ULL, 0x1FD424D6FAF030D7ULL },
+    { 0x49E56814075A5FF8ULL, 0x197683DF2F268D79ULL }, { 0x6E51201005E1E660ULL, 0x145ECFE5BF520AC7ULL },
+    { 0xF1DA800CD181851AULL, 0x104BD984990E6F05ULL }, { 0x4FC400148268D4F5ULL, 0x1A12F5A0F4E3E4D6ULL },
+    { 0xD96999AA01ED772BULL, 0x14DBF7B3F71CB711ULL }, { 0xADEE1488018AC5BCULL, 0x10AFF95CC5B09274ULL },
+    { 0x497CEDA668DE092CULL, 0x1AB328946F80EA54ULL }, { 0x3ACA57B853E4D424ULL, 0x155C2076BF9A5510ULL },
+    { 0x623B7960431D7683ULL, 0x1116805EFFAEAA73ULL }, { 0x9D2BF566D1C8BD9EULL, 0x1B5733CB32B110B8ULL },
+    { 0x7DBCC452416D647FULL, 0x15DF5CA28EF40D60ULL }, { 0xCAFD69DB678AB6CCULL, 0x117F7D4ED8C33DE6ULL },
+    { 0xAB2F0FC572778ADFULL, 0x1BFF2EE48E052FD7ULL }, { 0x88F273045B92D580ULL, 0x1665BF1D3E6A8CACULL },
+    { 0xD3F528D049424466ULL, 0x11EAFF4A98553D56ULL }, { 0xB988414D4203A0A3ULL, 0x1CAB3210F3BB9557ULL },
+    { 0x6139CDD76802E6E9ULL, 0x16EF5B40C2FC7779ULL }, { 0xE761717920025254ULL, 0x125915CD68C9F92DULL },
+    { 0xA568B58E999D5086ULL, 0x1D5B561574765B7CULL }, { 0x5120913EE14AA6D2ULL, 0x177C44DDF6C515FDULL },
+    { 0xA74D40FF1AA21F0EULL, 0x12C9D0B1923744CAULL }, { 0x0BAECE64F769CB4AULL, 0x1E0FB44F50586E11ULL },
+    { 0x3C8BD850C5EE3C3BULL, 0x180C903F7379F1A7ULL }, { 0xCA0979DA37F1C9C9ULL, 0x133D4032C2C7F485ULL },
+    { 0xA9A8C2F6BFE942DBULL, 0x1EC866B79E0CBA6FULL }, { 0x2153CF2BCCBA9BE3ULL, 0x18A0522C7E709526ULL },
+    { 0x1AA9728970954982ULL, 0x13B374F06526DDB8ULL }, { 0xF775840F1A88759DULL, 0x1F8587E7083E2F8CULL },
+    { 0x5F9136727BA05E17ULL, 0x19379FEC0698260AULL }, { 0x1940F85B9619E4DFULL, 0x142C7FF0054684D5ULL },
+    { 0xE100C6AFAB47EA4CULL, 0x1023998CD1053710ULL }, { 0xCE67A44C453FDD47ULL, 0x19D28F47B4D524E7ULL },
+    { 0xD852E9D69DCCB106ULL, 0x14A8729FC3DDB71FULL }, { 0x79DBEE454B0A2738ULL, 0x1086C219697E2C19ULL },
+    { 0x295FE3A211A9D859ULL, 0x1A71368F0F30468FULL }, { 0xBAB31C81A7BB137AULL, 0x15275ED8D8F36BA5ULL },
+    { 0x6228E39AEC95A92FULL, 0x10EC4BE0AD8F8951ULL }, { 0x9D0E38F7E0EF7517ULL, 0x1B13AC9AAF4C0EE8ULL },
+    { 0xB0D82D931A592A79ULL, 0x15A956E225D67253ULL }, { 0x8D79BE0F4847552EULL, 0x11544581B7DEC1DCULL },
+    { 0x158F967EDA0BBB7CULL, 0x1BBA08CF8C979C94ULL }, { 0x77A611FF14D62F97ULL, 0x162E6D72D6DFB076ULL },
+    { 0xF951A7FF43DE8C79ULL, 0x11BEBDF578B2F391ULL }, { 0xC21C3FFED2FDAD8EULL, 0x1C6463225AB7EC1CULL },
+    { 0x01B0333242648AD8ULL, 0x16B6B5B5155FF017ULL }, { 0x0159C28E9B83A246ULL, 0x122BC490DDE659ACULL },
+    { 0xCEF604175F3903A3ULL, 0x1D12D41AFCA3C2ACULL }, { 0x725E69AC4C2D9C83ULL, 0x17424348CA1C9BBDULL },
+    { 0xF5185489D68AE39CULL, 0x129B69070816E2FDULL }, { 0xEE8D540FBDAB05C6ULL, 0x1DC574D80CF16B2FULL },
+    { 0xBED77672FE226B05ULL, 0x17D12A4670C1228CULL }, { 0xFF12C528CB4EBC04ULL, 0x130DBB6B8D674ED6ULL },
+    { 0xCB513B74787DF9A0ULL, 0x1E7C5F127BD87E24ULL }, { 0x090DC929F9FE614DULL, 0x18637F41FCAD31B7ULL },
+    { 0xA0D7D42194CB810AULL, 0x1382CC34CA2427C5ULL }, { 0x67BFB9CF5478CE77ULL, 0x1F37AD21436D0C6FULL },
+    { 0x1FCC94A5DD2D71F9ULL, 0x18F9574DCF8A7059ULL }, { 0x7FD6DD517DBDF4C7ULL, 0x13FAAC3E3FA1F37AULL },
+    { 0xFFBE2EE8C92FEE0BULL, 0x1FF779FD329CB8C3ULL }, { 0x6631BF20A0F324D6ULL, 0x1992C7FDC216FA36ULL },
+    { 0xB827CC1A1A5C1D78ULL, 0x14756CCB01ABFB5EULL }, { 0x935309AE7B7CE460ULL, 0x105DF0A267BCC918ULL },
+    { 0x1EEB42B0C594A099ULL, 0x1A2FE76A3F9474F4ULL }, { 0xE58902270476E6E1ULL, 0x14F31F8832DD2A5CULL },
+    { 0xB7A0CE859D2BEBE7ULL, 0x10C27FA028B0EEB0ULL }, { 0x59014A6F61DFDFD8ULL, 0x1AD0CC33744E4AB4ULL },
+    { 0xE0CDD525E7E64CADULL, 0x1573D68F903EA229ULL }, { 0x4D7177518651D6F1ULL, 0x11297872D9CBB4EEULL },
+    { 0x7BE8BEE8D6E957E8ULL, 0x1B758D848FAC54B0ULL }, { 0xFCBA3253DF211320ULL, 0x15F7A46A0C89DD59ULL },
+    { 0x63C8284318E74280ULL, 0x1192E9EE706E4AAEULL }, { 0x060D0D3827D86A66ULL, 0x1C1E43171A4A1117ULL },
+    { 0x6B3DA42CECAD21EBULL, 0x167E9C127B6E7412ULL }, { 0x88FE1CF0BD574E56ULL, 0x11FEE341FC585CDBULL },
+    { 0x419694B462254A23ULL, 0x1CCB0536608D615FULL }, { 0x67ABAA29E81DD4E9ULL, 0x1708D0F84D3DE77FULL },
+    { 0xB95621BB2017DD87ULL, 0x126D73F9D764B932ULL }, { 0xC223692B668C95A5ULL, 0x1D7BECC2F23AC1EAULL },
+    { 0xCE82BA891ED6DE1DULL, 0x179657025B6234BBULL }, { 0xA53562074BDF1818ULL, 0x12DEAC01E2B4F6FCULL },
+    { 0x3B889CD87964F359ULL, 0x1E3113363787F194ULL }, { 0xFC6D4A46C783F5E1ULL, 0x18274291C6065ADCULL },
+    { 0x30576E9F06032B1AULL, 0x13529BA7D19EAF17ULL }, { 0x1A257DCB3CD1DE90ULL, 0x1EEA92A61C311825ULL },
+    { 0x481DFE3C30A7E540ULL, 0x18BBA884E35A79B7ULL }, { 0xD34B31C9C0865100ULL, 0x13C9539D82AEC7C5ULL },
+    { 0x5211E942CDA3B4CDULL, 0x1FA885C8D117A609ULL }, { 0x74DB21023E1C90A4ULL, 0x19539E3A40DFB807ULL },
+    { 0xF715B401CB4A0D50ULL, 0x1442E4FB67196005ULL }, { 0xF8DE299B09080AA7ULL, 0x103583FC527AB337ULL },
+    { 0x8E304291A80CDDD7ULL, 0x19EF3993B72AB859ULL }, { 0x3E8D020E200A4B13ULL, 0x14BF6142F8EEF9E1ULL },
+    { 0x653D9B3E80083C0FULL, 0x10991A9BFA58C7E7ULL }, { 0x6EC8F864000D2CE4ULL, 0x1A8E90F9908E0CA5ULL },
+    { 0x8BD3F9E999A423EAULL, 0x153EDA614071A3B7ULL }, { 0x3CA994BAE1501CBBULL, 0x10FF151A99F482F9ULL },
+    { 0xC775BAC49BB3612BULL, 0x1B31BB5DC320D18EULL }, { 0xD2C4956A16291A89ULL, 0x15C162B168E70E0BULL },
+    { 0xDBD0778811BA7BA1ULL, 0x11678227871F3E6FULL }, { 0x2C80BF401C5D929BULL, 0x1BD8D03F3E9863E6ULL },
+    { 0xBD33CC3349E47549ULL, 0x16470CFF6546B651ULL }, { 0xCA8FD68F6E505DD4ULL, 0x11D270CC51055EA7ULL },
+    { 0x4419574BE3B3C953ULL, 0x1C83E7AD4E6EFDD9ULL }, { 0x0347790982F63AA9ULL, 0x16CFEC8AA52597E1ULL },
+    { 0xCF6C60D468C4FBBAULL, 0x123FF06EEA847980ULL }, { 0xE57A34870E07F92AULL, 0x1D331A4B10D3F59AULL },
+    { 0x512E906C0B399422ULL, 0x175C1508DA432AE2ULL }, { 0xDA8BA6BCD5C7A9B5ULL, 0x12B010D3E1CF5581ULL },
+    { 0x90DF712E22D90F87ULL, 0x1DE6815302E5559CULL }, { 0xDA4C5A8B4F140C6CULL, 0x17EB9AA8CF1DDE16ULL },
+    { 0xAEA37BA2A5A9A38AULL, 0x1322E220A5B17E78ULL }, { 0x7DD25F6AA2A905A9ULL, 0x1E9E369AA2B59727ULL },
+    { 0x97DB7F888220D154ULL, 0x187E92154EF7AC1FULL }, { 0x797C6606CE80A777ULL, 0x139874DDD8C6234CULL },
+    { 0x8F2D700AE4010BF1ULL, 0x1F5A549627A36BADULL }, { 0x0C2459A25000D65AULL, 0x191510781FB5EFBEULL },
+    { 0x701D1481D99A4515ULL, 0x1410D9F9B2F7F2FEULL }, { 0xC017439B147B6A77ULL, 0x100D7B2E28C65BFEULL },
+    { 0xCCF205C4ED9243F2ULL, 0x19AF2B7D0E0A2CCAULL }, { 0x0A5B37D0BE0E9CC2ULL, 0x148C22CA71A1BD6FULL },
+    { 0x0848F973CB3EE3CEULL, 0x10701BD527B4978CULL }, { 0xDA0E5BEC78649FB0ULL, 0x1A4CF9550C5425ACULL },
+    { 0x7B3EAFF060507FC0ULL, 0x150A6110D6A9B7BDULL }, { 0x95CBBFF380406633ULL, 0x10D51A73DEEE2C97ULL },
+    { 0xEFAC665266CD7052ULL, 0x1AEE90B964B04758ULL }, { 0x2623850EB8A459DBULL, 0x158BA6FAB6F36C47ULL },
+    { 0x1E82D0D893B6AE49ULL, 0x113C85955F29236CULL }, { 0xFD9E1AF41F8AB075ULL, 0x1B9408EEFEA838ACULL },
+    { 0x97B1AF29B2D559F7ULL, 0x16100725988693BDULL }, { 0xAC8E25BAF5777B2CULL, 0x11A66C1E139EDC97ULL },
+    { 0x7A7D092B2258C513ULL, 0x1C3D79C9B8FE2DBFULL }, { 0x61FDA0EF4EAD6A76ULL, 0x169794A160CB57CCULL },
+    { 0xE7FE1A590BBDEEC5ULL, 0x1212DD4DE7091309ULL }, { 0xA6635D5B45FCB13AULL, 0x1CEAFBAFD80E84DCULL },
+    { 0x851C4AAF6B308DC8ULL, 0x172262F3133ED0B0ULL }, { 0xD0E36EF2BC26D7D4ULL, 0x1281E8C275CBDA26ULL },
+    { 0xB49F17EAC6A48C86ULL, 0x1D9CA79D894629D7ULL }, { 0x2A18DFEF0550706BULL, 0x17B08617A104EE46ULL },
+    { 0x54E0B3259DD9F389ULL, 0x12F39E794D9D8B6BULL }, { 0x87CDEB6F62F65274ULL, 0x1E5297287C2F4578ULL },
+    { 0xD30B22BF825EA85DULL, 0x18421286C9BF6AC6ULL }, { 0x0F3C1BCC684BB9E4ULL, 0x13680ED23AFF889FULL },
+    { 0x18602C7A4079296DULL, 0x1F0CE4839198DA98ULL }, { 0x46B356C833942124ULL, 0x18D71D360E13E213ULL },
+    { 0x388F78A029434DB6ULL, 0x13DF4A91A4DCB4DCULL }, { 0x5A7F2766A86BAF8AULL, 0x1FCBAA82A1612160ULL },
+    { 0x153285EBB9EFBFA2ULL, 0x196FBB9BB44DB44DULL }, { 0xAA8ED189618C994EULL, 0x145962E2F6A4903DULL },
+    { 0xEED8A7A11AD6E10CULL, 0x1047824F2BB6D9CAULL }, { 0x7E27729B5E249B45ULL, 0x1A0C03B1DF8AF611ULL },
+    { 0xFE85F549181D4904ULL, 0x14D6695B193BF80DULL }, { 0xCB9E5DD4134AA0D0ULL, 0x10AB877C142FF9A4ULL },
+    { 0xDF63C9535211014DULL, 0x1AAC0BF9B9E65C3AULL }, { 0x191CA10F74DA6771ULL, 0x15566FFAFB1EB02FULL },
+    { 0xADB080D92A4852C1ULL, 0x1111F32F2F4BC025ULL }, { 0x15E7348EAA0D5134ULL, 0x1B4FEB7EB212CD09ULL },
+    { 0xAB1F5D3EEE710DC4ULL, 0x15D98932280F0A6DULL }, { 0xBC1917658B8DA49DULL, 0x117AD428200C0857ULL },
+    { 0x2CF4F23C127C3A94ULL, 0x1BF7B9D9CCE00D59ULL }, { 0xF0C3F4FCDB969543ULL, 0x165FC7E170B33DE0ULL },
+    { 0x5A365D9716121103ULL, 0x11E6398126F5CB1AULL }, { 0x9056FC24F01CE804ULL, 0x1CA38F350B22DE90ULL },
+    { 0xD9DF301D8CE3ECD0ULL, 0x16E93F5DA2824BA6ULL }, { 0xE17F59B13D8323DAULL, 0x125432B14ECEA2EBULL },
+    { 0x68CBC2B52F38395CULL, 0x1D53844EE47DD179ULL }, { 0x53D6355DBF602DE3ULL, 0x177603725064A794ULL },
+    { 0xA9782AB165E68B1CULL, 0x12C4CF8EA6B6EC76ULL }, { 0x0F26AAB56FD744FAULL, 0x1E07B27DD78B13F1ULL },
+    { 0x3F52222ABFDF6A62ULL, 0x18062864AC6F4327ULL }, { 0x65DB4E88997F884EULL, 0x1338205089F29C1FULL },
+    { 0x6FC54A7428CC0D4AULL, 0x1EC033B40FEA9365ULL }, { 0x596AA1F68709A43BULL, 0x1899C2F673220F84ULL },
+    { 0xADEEE7F86C07B696ULL, 0x13AE3591F5B4D936ULL }, { 0x497E3FF3E00C5756ULL, 0x1F7D228322BAF524ULL },
+    { 0xD464FFF64CD6AC45ULL, 0x1930E868E89590E9ULL }, { 0x4383FFF83D7889D1ULL, 0x14272053ED4473EEULL },
+    { 0xCF9CCCC69793A174ULL, 0x101F4D0FF1038FF1ULL }, { 0x7F6147A425B90252ULL, 0x19CBAE7FE805B31CULL },
+    { 0xCC4DD2E9B7C7350FULL, 0x14A2F1FFECD15C16ULL }, { 0x3D0B0F215FD290D9ULL, 0x10825B3323DAB012ULL },
+    { 0x61AB4B689950E7C1ULL, 0x1A6A2B85062AB350ULL }, { 0x4E22A2BA1440B967ULL, 0x1521BC6A6B555C40ULL },
+    { 0x0B4EE894DD009453ULL, 0x10E7C9EEBC4449CDULL }, { 0x1217DA87C800ED51ULL, 0x1B0C764AC6D3A948ULL },
+    { 0xDB46486CA000BDDAULL, 0x15A391D56BDC876CULL }, { 0x490506BD4CCD64AFULL, 0x114FA7DDEFE39F8AULL },
+    { 0xA8080AC87AE23AB1ULL, 0x1BB2A62FE638FF43ULL }, { 0x5339A239FBE82EF4ULL, 0x162884F31E93FF69ULL },
+    { 0x75C7B4FB2FECF25DULL, 0x11BA03F5B20FFF87ULL }, { 0x22D92191E647EA2EULL, 0x1C5CD322B67FFF3FULL },
+    { 0xB57A8141850654F2ULL, 0x16B0A8E891FFFF65ULL }, { 0xC4620101373843F5ULL, 0x1226ED86DB3332B7ULL },
+    { 0x3A366801F1F39FEEULL, 0x1D0B15A491EB8459ULL }, { 0xFB5EB99B27F6198BULL, 0x173C115074BC69E0ULL },
+    { 0x2F7EFAE2865E7AD6ULL, 0x129674405D6387E7ULL }, { 0xE597F7D0D6FD9156ULL, 0x1DBD86CD6238D971ULL },
+    { 0x8479930D78CADAABULL, 0x17CAD23DE82D7AC1ULL }, { 0xD06142712D6F1556ULL, 0x1308A831868AC89AULL },
+    { 0x4D686A4EAF182222ULL, 0x1E74404F3DAADA91ULL }, { 0xA453883EF279B4E8ULL, 0x185D003F6488AEDAULL },
+    { 0xE9DC6CFF28615D87ULL, 0x137D99CC506D58AEULL }, { 0xA960AE650D6895A4ULL, 0x1F2F5C7A1A488DE4ULL },
+    { 0xBAB3BEB73DED4483ULL, 0x18F2B061AEA07183ULL }, { 0x2EF6322C318A9D36ULL, 0x13F559E7BEE6C136ULL },
+    { 0xE4BD1D13827761F0ULL, 0x1FEEF63F97D79B89ULL }, { 0x83CA7DA9352C4E5AULL, 0x198BF832DFDFAFA1ULL },
+    { 0x9CA1FE20F756A515ULL, 0x146FF9C24CB2F2E7ULL }, { 0x4A1B31B3F9121DAAULL, 0x1059949B708F28B9ULL },
+    { 0x435EB5ECC1B695DDULL, 0x1A28EDC580E50DF5ULL }, { 0x35E55E57015EDE4AULL, 0x14ED8B04671DA4C4ULL },
+    { 0xC4B77EAC0118B1D5ULL, 0x10BE08D0527E1D69ULL }, { 0xA12597799B5AB622ULL, 0x1AC9A7B3B7302F0FULL },
+    { 0x4DB7AC6149155E81ULL, 0x156E1FC2F8F358D9ULL }, { 0xD7C6238107444B9BULL, 0x1124E63593F5E0ADULL },
+    { 0x593D059B3ED3AC2BULL, 0x1B6E3D2286563449ULL }, { 0xE0FD9E15CBDC89BCULL, 0x15F1CA820511C36DULL },
+    { 0xB3FE18116FE3A163ULL, 0x118E3B9B37416924ULL }, { 0x866359B57FD29BD1ULL, 0x1C16C5C525357507ULL },
+    { 0xD1E91491330EE30EULL, 0x16789E3750F790D2ULL }, { 0x74BA76DA8F3F1C0BULL, 0x11FA182C40C60D75ULL },
+    { 0xEDF72490E531C678ULL, 0x1CC359E067A348BBULL }, { 0x8B2C1D40B75B052DULL, 0x1702AE4D1FB5D3C9ULL },
+    { 0x6F567DCD5F7C0424ULL, 0x12688B70E62B0FD4ULL }, { 0x7EF0C94898C66D06ULL, 0x1D74124E3D11B2EDULL },
+    { 0x98C0A106E09EBD9FULL, 0x17900EA4FDA7C257ULL }, { 0x470080D24D4BCAE6ULL, 0x12D9A550CAEC9B79ULL },
+    { 0xD800CE1D487944A2ULL, 0x1E29088144ADC58EULL }, { 0x1333D8176D2DD082ULL, 0x1820D39A9D57D13FULL },
+    { 0xA8F646792424A6CEULL, 0x134D76154AACA765ULL }, { 0x74BD3D8EA03AA47DULL, 0x1EE25688777AA56FULL },
+    { 0x5D64313EE6955064ULL, 0x18B51206C5FBB78CULL }, { 0x4AB68DCBEBAAA6B7ULL, 0x13C40E6BD1962C70ULL },
+    { 0x1124161312AAA457ULL, 0x1FA01712E8F0471AULL }, { 0xDA8344DC0EEEE9DFULL, 0x194CDF4253F36C14ULL },
+    { 0xE2029D7CD8BF2180ULL, 0x143D7F6843292343ULL }, { 0x4E687DFD7A328133ULL, 0x103132B9CF541C36ULL },
+    { 0x4A40C9959050CEB8ULL, 0x19E851294BB9C6BDULL }, { 0x0833D477A6A70BC6ULL, 0x14B9DA876FC7D231ULL },
+    { 0xA02976C61EEC096BULL, 0x1094AED2BFD30E8DULL }, { 0x004257A364ACDBDFULL, 0x1A877E1DFFB81749ULL },
+    { 0xCD01DFB5EA23E319ULL, 0x153931B1996012A0ULL }, { 0x70CE4C91881CB5AEULL, 0x10FA8E27ADE6754DULL },
+    { 0x1AE3ADB5A69455E2ULL, 0x1B2A7D0C4970BBAFULL }, { 0x7BE957C4854377E8ULL, 0x15BB973D078D62F2ULL },
+    { 0xC987796A0435F987ULL, 0x1162DF64060AB58EULL }, { 0x75A58F1006BCC271ULL, 0x1BD1656CD67788E4ULL },
+    { 0xF7B7A5A66BCA3527ULL, 0x16411DF0AB92D3E9ULL }, { 0x5FC61E1EBCA1C41FULL, 0x11CDB18D560F0FEEULL },
+    { 0xFFA363646102D365ULL, 0x1C7C4F4889B1B316ULL }, { 0x32E91C504D9BDC51ULL, 0x16C9D906D48E28DFULL },
+    { 0x8F20E37371497D0EULL, 0x123B140576D820B2ULL }, { 0x7E9B0585820F2E7CULL, 0x1D2B533BF159CDEAULL },
+    { 0xCBAF379E01A5BECAULL, 0x1755DC2FF447D7EEULL }, { 0x0958F94B348498A1ULL, 0x12AB168CC36CACBFULL },
+};
+// 128-bit 5^i >> (bits(5^i) - 125) for double, low part is first
+static const uint64_t REFLEX_JSON_DOUBLE_POW5[326][2] = {
+    { 0x0000000000000000ULL, 0x1000000000000000ULL }, { 0x0000000000000000ULL, 0x1400000000000000ULL },
+    { 0x0000000000000000ULL, 0x1900000000000000ULL }, { 0x0000000000000000ULL, 0x1F40000000000000ULL },
+    { 0x0000000000000000ULL, 0x1388000000000000ULL }, { 0x0000000000000000ULL, 0x186A000000000000ULL },
+    { 0x0000000000000000ULL, 0x1E84800000000000ULL }, { 0x0000000000000000ULL, 0x1312D00000000000ULL },
+    { 0x0000000000000000ULL, 0x17D7840000000000ULL }, { 0x0000000000000000ULL, 0x1DCD650000000000ULL },
+    { 0x0000000000000000ULL, 0x12A05F2000000000ULL }, { 0x0000000000000000ULL, 0x174876E800000000ULL },
+    { 0x0000000000000000ULL, 0x1D1A94A200000000ULL }, { 0x0000000000000000ULL, 0x12309CE540000000ULL },
+    { 0x0000000000000000ULL, 0x16BCC41E90000000ULL }, { 0x0000000000000000ULL, 0x1C6BF52634000000ULL },
+    { 0x0000000000000000ULL, 0x11C37937E0800000ULL }, { 0x0000000000000000ULL, 0x16345785D8A00000ULL },
+    { 0x0000000000000000ULL, 0x1BC16D674EC80000ULL }, { 0x0000000000000000ULL, 0x1158E460913D0000ULL },
+    { 0x0000000000000000ULL, 0x15AF1D78B58C4000ULL }, { 0x0000000000000000ULL, 0x1B1AE4D6E2EF5000ULL },
+    { 0x0000000000000000ULL, 0x10F0CF064DD59200ULL }, { 0x0000000000000000ULL, 0x152D02C7E14AF680ULL },
+    { 0x0000000000000000ULL, 0x1A784379D99DB420ULL }, { 0x0000000000000000ULL, 0x108B2A2C28029094ULL },
+    { 0x0000000000000000ULL, 0x14ADF4B7320334B9ULL }, { 0x4000000000000000ULL, 0x19D971E4FE8401E7ULL },
+    { 0x8800000000000000ULL, 0x1027E72F1F128130ULL }, { 0xAA00000000000000ULL, 0x1431E0FAE6D7217CULL },
+    { 0xD480000000000000ULL, 0x193E5939A08CE9DBULL }, { 0xC9A0000000000000ULL, 0x1F8DEF8808B02452ULL },
+    { 0xBE04000000000000ULL, 0x13B8B5B5056E16B3ULL }, { 0xAD85000000000000ULL, 0x18A6E32246C99C60ULL },
+    { 0xD8E6400000000000ULL, 0x1ED09BEAD87C0378ULL }, { 0x878FE80000000000ULL, 0x13426172C74D822BULL },
+    { 0x6973E20000000000ULL, 0x1812F9CF7920E2B6ULL }, { 0x03D0DA8000000000ULL, 0x1E17B84357691B64ULL },
+    { 0x8262889000000000ULL, 0x12CED32A16A1B11EULL }, { 0x22FB2AB400000000ULL, 0x178287F49C4A1D66ULL },
+    { 0xABB9F56100000000ULL, 0x1D6329F1C35CA4BFULL }, { 0xCB54395CA0000000ULL, 0x125DFA371A19E6F7ULL },
+    { 0xBE2947B3C8000000ULL, 0x16F578C4E0A060B5ULL }, { 0x2DB399A0BA000000ULL, 0x1CB2D6F618C878E3ULL },
+    { 0xFC90400474400000ULL, 0x11EFC659CF7D4B8DULL }, { 0x7BB4500591500000ULL, 0x166BB7F0435C9E71ULL },
+    { 0xDAA16406F5A40000ULL, 0x1C06A5EC5433C60DULL }, { 0xA8A4DE8459868000ULL, 0x118427B3B4A05BC8ULL },
+    { 0xD2CE16256FE82000ULL, 0x15E531A0A1C872BAULL }, { 0x87819BAECBE22800ULL, 0x1B5E7E08CA3A8F69ULL },
+    { 0xF4B1014D3F6D5900ULL, 0x111B0EC57E6499A1ULL }, { 0x71DD41A08F48AF40ULL, 0x1561D276DDFDC00AULL },
+    { 0x0E549208B31ADB10ULL, 0x1ABA4714957D300DULL }, { 0x28F4DB456FF0C8EAULL, 0x10B46C6CDD6E3E08ULL },
+    { 0x33321216CBECFB24ULL, 0x14E1878814C9CD8AULL }, { 0xBFFE969C7EE839EDULL, 0x1A19E96A19FC40ECULL },
+    { 0xF7FF1E21CF512434ULL, 0x105031E2503DA893ULL }, { 0xF5FEE5AA43256D41ULL, 0x14643E5AE44D12B8ULL },
+    { 0x337E9F14D3EEC892ULL, 0x197D4DF19D605767ULL }, { 0x005E46DA08EA7AB6ULL, 0x1FDCA16E04B86D41ULL },
+    { 0xA03AEC4845928CB2ULL, 0x13E9E4E4C2F34448ULL }, { 0xC849A75A56F72FDEULL, 0x18E45E1DF3B0155AULL },
+    { 0x7A5C1130ECB4FBD6ULL, 0x1F1D75A5709C1AB1ULL }, { 0xEC798ABE93F11D65ULL, 0x13726987666190AEULL },
+    { 0xA797ED6E38ED64BFULL, 0x184F03E93FF9F4DAULL }, { 0x517DE8C9C728BDEFULL, 0x1E62C4E38FF87211ULL },
+    { 0xD2EEB17E1C7976B5ULL, 0x12FDBB0E39FB474AULL }, { 0x87AA5DDDA397D462ULL, 0x17BD29D1C87A191DULL },
+    { 0xE994F5550C7DC97BULL, 0x1DAC74463A989F64ULL }, { 0x11FD195527CE9DEDULL, 0x128BC8ABE49F639FULL },
+    { 0xD67C5FAA71C24568ULL, 0x172EBAD6DDC73C86ULL }, { 0x8C1B77950E32D6C2ULL, 0x1CFA698C95390BA8ULL },
+    { 0x57912ABD28DFC639ULL, 0x121C81F7DD43A749ULL }, { 0xAD75756C7317B7C8ULL, 0x16A3A275D494911BULL },
+    { 0x98D2D2C78FDDA5BAULL, 0x1C4C8B1349B9B562ULL }, { 0x9F83C3BCB9EA8794ULL, 0x11AFD6EC0E14115DULL },
+    { 0x0764B4ABE8652979ULL, 0x161BCCA7119915B5ULL }, { 0x493DE1D6E27E73D7ULL, 0x1BA2BFD0D5FF5B22ULL },
+    { 0x6DC6AD264D8F0866ULL, 0x1145B7E285BF98F5ULL }, { 0xC938586FE0F2CA80ULL, 0x159725DB272F7F32ULL },
+    { 0x7B866E8BD92F7D20ULL, 0x1AFCEF51F0FB5EFFULL }, { 0xAD34051767BDAE34ULL, 0x10DE1593369D1B5FULL },
+    { 0x9881065D41AD19C1ULL, 0x15159AF804446237ULL }, { 0x7EA147F492186032ULL, 0x1A5B01B605557AC5ULL },
+    { 0x6F24CCF8DB4F3C1FULL, 0x1078E111C3556CBBULL }, { 0x4AEE003712230B27ULL, 0x14971956342AC7EAULL },
+    { 0xDDA98044D6ABCDF0ULL, 0x19BCDFABC13579E4ULL }, { 0x0A89F02B062B60B6ULL, 0x10160BCB58C16C2FULL },
+    { 0xCD2C6C35C7B638E4ULL, 0x141B8EBE2EF1C73AULL }, { 0x8077874339A3C71DULL, 0x1922726DBAAE3909ULL },
+    { 0xE0956914080CB8E4ULL, 0x1F6B0F092959C74BULL }, { 0x6C5D61AC8507F38EULL, 0x13A2E965B9D81C8FULL },
+    { 0x4774BA17A649F072ULL, 0x188BA3BF284E23B3ULL }, { 0x1951E89D8FDC6C8FULL, 0x1EAE8CAEF261ACA0ULL },
+    { 0x0FD3316279E9C3D9ULL, 0x132D17ED577D0BE4ULL }, { 0x13C7FDBB186434CFULL, 0x17F85DE8AD5C4EDDULL },
+    { 0x58B9FD29DE7D4203ULL, 0x1DF67562D8B36294ULL }, { 0xB7743E3A2B0E4942ULL, 0x12BA095DC7701D9CULL },
+    { 0xE5514DC8B5D1DB92ULL, 0x17688BB5394C2503ULL }, { 0xDEA5A13AE3465277ULL, 0x1D42AEA2879F2E44ULL },
+    { 0x0B2784C4CE0BF38AULL, 0x1249AD2594C37CEBULL }, { 0xCDF165F6018EF06DULL, 0x16DC186EF9F45C25ULL },
+    { 0x416DBF7381F2AC88ULL, 0x1C931E8AB871732FULL }, { 0x88E497A83137ABD5ULL, 0x11DBF316B346E7FDULL },
+    { 0xEB1DBD923D8596CAULL, 0x1652EFDC6018A1FCULL }, { 0x25E52CF6CCE6FC7DULL, 0x1BE7ABD3781ECA7CULL },
+    { 0x97AF3C1A40105DCEULL, 0x1170CB642B133E8DULL }, { 0xFD9B0B20D0147542ULL, 0x15CCFE3D35D80E30ULL },
+    { 0x3D01CDE904199292ULL, 0x1B403DCC834E11BDULL }, { 0x462120B1A28FFB9BULL, 0x1108269FD210CB16ULL },
+    { 0xD7A968DE0B33FA82ULL, 0x154A3047C694FDDBULL }, { 0xCD93C3158E00F923ULL, 0x1A9CBC59B83A3D52ULL },
+    { 0xC07C59ED78C09BB6ULL, 0x10A1F5B813246653ULL }, { 0xB09B7068D6F0C2A3ULL, 0x14CA732617ED7FE8ULL },
+    { 0xDCC24C830CACF34CULL, 0x19FD0FEF9DE8DFE2ULL }, { 0xC9F96FD1E7EC180FULL, 0x103E29F5C2B18BEDULL },
+    { 0x3C77CBC661E71E13ULL, 0x144DB473335DEEE9ULL }, { 0x8B95BEB7FA60E598ULL, 0x1961219000356AA3ULL },
+    { 0x6E7B2E65F8F91EFEULL, 0x1FB969F40042C54CULL }, { 0xC50CFCFFBB9BB35FULL, 0x13D3E2388029BB4FULL },
+    { 0xB6503C3FAA82A037ULL, 0x18C8DAC6A0342A23ULL }, { 0xA3E44B4F95234844ULL, 0x1EFB1178484134ACULL },
+    { 0xE66EAF11BD360D2BULL, 0x135CEAEB2D28C0EBULL }, { 0xE00A5AD62C839075ULL, 0x183425A5F872F126ULL },
+    { 0x980CF18BB7A47493ULL, 0x1E412F0F768FAD70ULL }, { 0x5F0816F752C6C8DCULL, 0x12E8BD69AA19CC66ULL },
+    { 0xF6CA1CB527787B13ULL, 0x17A2ECC414A03F7FULL }, { 0xF47CA3E2715699D7ULL, 0x1D8BA7F519C84F5FULL },
+    { 0xF8CDE66D86D62026ULL, 0x127748F9301D319BULL }, { 0xF7016008E88BA830ULL, 0x17151B377C247E02ULL },
+    { 0xB4C1B80B22AE923CULL, 0x1CDA62055B2D9D83ULL }, { 0x50F91306F5AD1B65ULL, 0x12087D4358FC8272ULL },
+    { 0xE53757C8B318623FULL, 0x168A9C942F3BA30EULL }, { 0x9E852DBADFDE7ACFULL, 0x1C2D43B93B0A8BD2ULL },
+    { 0xA3133C94CBEB0CC1ULL, 0x119C4A53C4E69763ULL }, { 0x8BD80BB9FEE5CFF1ULL, 0x16035CE8B6203D3CULL },
+    { 0xAECE0EA87E9F43EEULL, 0x1B843422E3A84C8BULL }, { 0x4D40C9294F238A75ULL, 0x1132A095CE492FD7ULL },
+    { 0x2090FB73A2EC6D12ULL, 0x157F48BB41DB7BCDULL }, { 0x68B53A508BA78856ULL, 0x1ADF1AEA12525AC0ULL },
+    { 0x417144725748B536ULL, 0x10CB70D24B7378B8ULL }, { 0x51CD958EED1AE283ULL, 0x14FE4D06DE5056E6ULL },
+    { 0xE640FAF2A8619B24ULL, 0x1A3DE04895E46C9FULL }, { 0xEFE89CD7A93D00F7ULL, 0x1066AC2D5DAEC3E3ULL },
+    { 0xEBE2C40D938C4134ULL, 0x14805738B51A74DCULL }, { 0x26DB7510F86F5181ULL, 0x19A06D06E2611214ULL },
+    { 0x9849292A9B4592F1ULL, 0x100444244D7CAB4CULL }, { 0xBE5B73754216F7ADULL, 0x1405552D60DBD61FULL },
+    { 0xADF25052929CB598ULL, 0x1906AA78B912CBA7ULL }, { 0x996EE4673743E2FFULL, 0x1F485516E7577E91ULL },
+    { 0xFFE54EC0828A6DDFULL, 0x138D352E5096AF1AULL }, { 0xBFDEA270A32D0957ULL, 0x18708279E4BC5AE1ULL },
+    { 0x2FD64B0CCBF84BADULL, 0x1E8CA3185DEB719AULL }, { 0x5DE5EEE7FF7B2F4CULL, 0x1317E5EF3AB32700ULL },
+    { 0x755F6AA1FF59FB1FULL, 0x17DDDF6B095FF0C0ULL }, { 0x92B7454A7F3079E7ULL, 0x1DD55745CBB7ECF0ULL },
+    { 0x5BB28B4E8F7E4C30ULL, 0x12A5568B9F52F416ULL }, { 0xF29F2E22335DDF3CULL, 0x174EAC2E8727B11BULL },
+    { 0xEF46F9AAC035570BULL, 0x1D22573A28F19D62ULL }, { 0xD58C5C0AB8215667ULL, 0x123576845997025DULL },
+    { 0x4AEF730D6629AC01ULL, 0x16C2D4256FFCC2F5ULL }, { 0x9DAB4FD0BFB41701ULL, 0x1C73892ECBFBF3B2ULL },
+    { 0xA28B11E277D08E60ULL, 0x11C835BD3F7D784FULL }, { 0x8B2DD65B15C4B1F9ULL, 0x163A432C8F5CD663ULL },
+    { 0x6DF94BF1DB35DE77ULL, 0x1BC8D3F7B3340BFCULL }, { 0xC4BBCF772901AB0AULL, 0x115D847AD000877DULL },
+    { 0x35EAC354F34215CDULL, 0x15B4E5998400A95DULL }, { 0x8365742A30129B40ULL, 0x1B221EFFE500D3B4ULL },
+    { 0xD21F689A5E0BA108ULL, 0x10F5535FEF208450ULL }, { 0x06A742C0F58E894AULL, 0x1532A837EAE8A565ULL },
+    { 0x4851137132F22B9DULL, 0x1A7F5245E5A2CEBEULL }, { 0xED32AC26BFD75B42ULL, 0x108F936BAF85C136ULL },
+    { 0xA87F57306FCD3212ULL, 0x14B378469B673184ULL }, { 0xD29F2CFC8BC07E97ULL, 0x19E056584240FDE5ULL },
+    { 0xA3A37C1DD7584F1EULL, 0x102C35F729689EAFULL }, { 0x8C8C5B254D2E62E6ULL, 0x14374374F3C2C65BULL },
+    { 0x6FAF71EEA079FB9FULL, 0x1945145230B377F2ULL }, { 0x0B9B4E6A48987A87ULL, 0x1F965966BCE055EFULL },
+    { 0x674111026D5F4C94ULL, 0x13BDF7E0360C35B5ULL }, { 0xC111554308B71FBAULL, 0x18AD75D8438F4322ULL },
+    { 0x7155AA93CAE4E7A8ULL, 0x1ED8D34E547313EBULL }, { 0x26D58A9C5ECF10C9ULL, 0x13478410F4C7EC73ULL },
+    { 0xF08AED437682D4FBULL, 0x1819651531F9E78FULL }, { 0xECADA89454238A3AULL, 0x1E1FBE5A7E786173ULL },
+    { 0x73EC895CB4963664ULL, 0x12D3D6F88F0B3CE8ULL }, { 0x90E7ABB3E1BBC3FDULL, 0x1788CCB6B2CE0C22ULL },
+    { 0x352196A0DA2AB4FDULL, 0x1D6AFFE45F818F2BULL }, { 0x0134FE24885AB11EULL, 0x1262DFEEBBB0F97BULL },
+    { 0xC1823DADAA715D65ULL, 0x16FB97EA6A9D37D9ULL }, { 0x31E2CD19150DB4BFULL, 0x1CBA7DE5054485D0ULL },
+    { 0x1F2DC02FAD2890F7ULL, 0x11F48EAF234AD3A2ULL }, { 0xA6F9303B9872B535ULL, 0x1671B25AEC1D888AULL },
+    { 0x50B77C4A7E8F6282ULL, 0x1C0E1EF1A724EAADULL }, { 0x5272ADAE8F199D91ULL, 0x1188D357087712ACULL },
+    { 0x670F591A32E004F6ULL, 0x15EB082CCA94D757ULL }, { 0x40D32F60BF980633ULL, 0x1B65CA37FD3A0D2DULL },
+    { 0x4883FD9C77BF03E0ULL, 0x111F9E62FE44483CULL }, { 0x5AA4FD0395AEC4D8ULL, 0x156785FBBDD55A4BULL },
+    { 0x314E3C447B1A760EULL, 0x1AC1677AAD4AB0DEULL }, { 0xDED0E5AACCF089C9ULL, 0x10B8E0ACAC4EAE8AULL },
+    { 0x96851F15802CAC3BULL, 0x14E718D7D7625A2DULL }, { 0xFC2666DAE037D74AULL, 0x1A20DF0DCD3AF0B8ULL },
+    { 0x9D980048CC22E68EULL, 0x10548B68A044D673ULL }, { 0x84FE005AFF2BA032ULL, 0x1469AE42C8560C10ULL },
+    { 0xA63D8071BEF6883EULL, 0x198419D37A6B8F14ULL }, { 0xCFCCE08E2EB42A4EULL, 0x1FE52048590672D9ULL },
+    { 0x21E00C58DD309A70ULL, 0x13EF342D37A407C8ULL }, { 0x2A580F6F147CC10DULL, 0x18EB0138858D09BAULL },
+    { 0xB4EE134AD99BF150ULL, 0x1F25C186A6F04C28ULL }, { 0x7114CC0EC80176D2ULL, 0x137798F428562F99ULL },
+    { 0xCD59FF127A01D486ULL, 0x18557F31326BBB7FULL }, { 0xC0B07ED7188249A8ULL, 0x1E6ADEFD7F06AA5FULL },
+    { 0xD86E4F466F516E09ULL, 0x1302CB5E6F642A7BULL }, { 0xCE89E3180B25C98BULL, 0x17C37E360B3D351AULL },
+    { 0x822C5BDE0DEF3BEEULL, 0x1DB45DC38E0C8261ULL }, { 0xF15BB96AC8B58575ULL, 0x1290BA9A38C7D17CULL },
+    { 0x2DB2A7C57AE2E6D2ULL, 0x1734E940C6F9C5DCULL }, { 0x391F51B6D99BA086ULL, 0x1D022390F8B83753ULL },
+    { 0x03B3931248014454ULL, 0x1221563A9B732294ULL }, { 0x04A077D6DA019569ULL, 0x16A9ABC9424FEB39ULL },
+    { 0x45C895CC9081FAC3ULL, 0x1C5416BB92E3E607ULL }, { 0x8B9D5D9FDA513CBAULL, 0x11B48E353BCE6FC4ULL },
+    { 0xAE84B507D0E58BE8ULL, 0x1621B1C28AC20BB5ULL }, { 0x1A25E249C51EEEE3ULL, 0x1BAA1E332D728EA3ULL },
+    { 0xF057AD6E1B33554DULL, 0x114A52DFFC679925ULL }, { 0x6C6D98C9A2002AA1ULL, 0x159CE797FB817F6FULL },
+    { 0x4788FEFC0A803549ULL, 0x1B04217DFA61DF4BULL }, { 0x0CB59F5D8690214EULL, 0x10E294EEBC7D2B8FULL },
+    { 0xCFE30734E83429A1ULL, 0x151B3A2A6B9C7672ULL }, { 0x83DBC9022241340AULL, 0x1A6208B50683940FULL },
+    { 0xB2695DA15568C086ULL, 0x107D457124123C89ULL }, { 0x1F03B509AAC2F0A7ULL, 0x149C96CD6D16CBACULL },
+    { 0x26C4A24C1573ACD1ULL, 0x19C3BC80C85C7E97ULL }, { 0x783AE56F8D684C03ULL, 0x101A55D07D39CF1EULL },
+    { 0x16499ECB70C25F03ULL, 0x1420EB449C8842E6ULL }, { 0x9BDC067E4CF2F6C4ULL, 0x19292615C3AA539FULL },
+    { 0x82D3081DE02FB476ULL, 0x1F736F9B3494E887ULL }, { 0xB1C3E512AC1DD0C9ULL, 0x13A825C100DD1154ULL },
+    { 0xDE34DE57572544FCULL, 0x18922F31411455A9ULL }, { 0x55C215ED2CEE963BULL, 0x1EB6BAFD91596B14ULL },
+    { 0xB5994DB43C151DE5ULL, 0x133234DE7AD7E2ECULL }, { 0xE2FFA1214B1A655EULL, 0x17FEC216198DDBA7ULL },
+    { 0xDBBF89699DE0FEB6ULL, 0x1DFE729B9FF15291ULL }, { 0x2957B5E202AC9F31ULL, 0x12BF07A143F6D39BULL },
+    { 0xF3ADA35A8357C6FEULL, 0x176EC98994F48881ULL }, { 0x70990C31242DB8BDULL, 0x1D4A7BEBFA31AAA2ULL },
+    { 0x865FA79EB69C9376ULL, 0x124E8D737C5F0AA5ULL }, { 0xE7F791866443B854ULL, 0x16E230D05B76CD4EULL },
+    { 0xA1F575E7FD54A669ULL, 0x1C9ABD04725480A2ULL }, { 0xA53969B0FE54E801ULL, 0x11E0B622C774D065ULL },
+    { 0x0E87C41D3DEA2202ULL, 0x1658E3AB7952047FULL }, { 0xD229B5248D64AA82ULL, 0x1BEF1C9657A6859EULL },
+    { 0x435A1136D85EEA91ULL, 0x117571DDF6C81383ULL }, { 0x143095848E76A536ULL, 0x15D2CE55747A1864ULL },
+    { 0x193CBAE5B2144E83ULL, 0x1B4781EAD1989E7DULL }, { 0x2FC5F4CF8F4CB112ULL, 0x110CB132C2FF630EULL },
+    { 0xBBB77203731FDD56ULL, 0x154FDD7F73BF3BD1ULL }, { 0x2AA54E844FE7D4ACULL, 0x1AA3D4DF50AF0AC6ULL },
+    { 0xDAA75112B1F0E4EBULL, 0x10A6650B926D66BBULL }, { 0xD15125575E6D1E26ULL, 0x14CFFE4E7708C06AULL },
+    { 0x85A56EAD360865B0ULL, 0x1A03FDE214CAF085ULL }, { 0x7387652C41C53F8EULL, 0x10427EAD4CFED653ULL },
+    { 0x50693E7752368F71ULL, 0x14531E58A03E8BE8ULL }, { 0x64838E1526C4334EULL, 0x1967E5EEC84E2EE2ULL },
+    { 0xFDA4719A70754022ULL, 0x1FC1DF6A7A61BA9AULL }, { 0xDE86C70086494815ULL, 0x13D92BA28C7D14A0ULL },
+    { 0x162878C0A7DB9A1AULL, 0x18CF768B2F9C59C9ULL }, { 0x5BB296F0D1D280A1ULL, 0x1F03542DFB83703BULL },
+    { 0x194F9E5683239064ULL, 0x1362149CBD322625ULL }, { 0x5FA385EC23EC747EULL, 0x183A99C3EC7EAFAEULL },
+    { 0xF78C67672CE7919DULL, 0x1E494034E79E5B99ULL }, { 0x3AB7C0A07C10BB02ULL, 0x12EDC82110C2F940ULL },
+    { 0x4965B0C89B14E9C3ULL, 0x17A93A2954F3B790ULL }, { 0x5BBF1CFAC1DA2433ULL, 0x1D9388B3AA30A574ULL },
+    { 0xB957721CB92856A0ULL, 0x127C35704A5E6768ULL }, { 0xE7AD4EA3E7726C48ULL, 0x171B42CC5CF60142ULL },
+    { 0xA198A24CE14F075AULL, 0x1CE2137F74338193ULL }, { 0x44FF65700CD16498ULL, 0x120D4C2FA8A030FCULL },
+    { 0x563F3ECC1005BDBEULL, 0x16909F3B92C83D3BULL }, { 0x2BCF0E7F14072D2EULL, 0x1C34C70A777A4C8AULL },
+    { 0x5B61690F6C847C3DULL, 0x11A0FC668AAC6FD6ULL }, { 0xF239C35347A59B4CULL, 0x16093B802D578BCBULL },
+    { 0xEEC83428198F021FULL, 0x1B8B8A6038AD6EBEULL }, { 0x553D20990FF96153ULL, 0x1137367C236C6537ULL },
+    { 0x2A8C68BF53F7B9A8ULL, 0x1585041B2C477E85ULL }, { 0x752F82EF28F5A812ULL, 0x1AE64521F7595E26ULL },
+    { 0x093DB1D57999890BULL, 0x10CFEB353A97DAD8ULL }, { 0x0B8D1E4AD7FFEB4EULL, 0x1503E602893DD18EULL },
+    { 0x8E7065DD8DFFE622ULL, 0x1A44DF832B8D45F1ULL }, { 0xF9063FAA78BFEFD5ULL, 0x106B0BB1FB384BB6ULL },
+    { 0xB747CF9516EFEBCAULL, 0x1485CE9E7A065EA4ULL }, { 0xE519C37A5CABE6BDULL, 0x19A742461887F64DULL },
+    { 0xAF301A2C79EB7036ULL, 0x1008896BCF54F9F0ULL }, { 0xDAFC20B798664C43ULL, 0x140AABC6C32A386CULL },
+    { 0x11BB28E57E7FDF54ULL, 0x190D56B873F4C688ULL }, { 0x1629F31EDE1FD72AULL, 0x1F50AC6690F1F82AULL },
+    { 0x4DDA37F34AD3E67AULL, 0x13926BC01A973B1AULL }, { 0xE150C5F01D88E019ULL, 0x187706B0213D09E0ULL },
+    { 0x19A4F76C24EB181FULL, 0x1E94C85C298C4C59ULL }, { 0xB0071AA39712EF13ULL, 0x131CFD3999F7AFB7ULL },
+    { 0x9C08E14C7CD7AAD8ULL, 0x17E43C8800759BA5ULL }, { 0x030B199F9C0D958EULL, 0x1DDD4BAA0093028FULL },
+    { 0x61E6F003C1887D79ULL, 0x12AA4F4A405BE199ULL }, { 0xBA60AC04B1EA9CD7ULL, 0x1754E31CD072D9FFULL },
+    { 0xA8F8D705DE65440DULL, 0x1D2A1BE4048F907FULL }, { 0xC99B8663AAFF4A88ULL, 0x123A516E82D9BA4FULL },
+    { 0xBC0267FC95BF1D2AULL, 0x16C8E5CA239028E3ULL }, { 0xAB0301FBBB2EE474ULL, 0x1C7B1F3CAC74331CULL },
+    { 0xEAE1E13D54FD4EC9ULL, 0x11CCF385EBC89FF1ULL }, { 0x659A598CAA3CA27BULL, 0x1640306766BAC7EEULL },
+    { 0xFF00EFEFD4CBCB1AULL, 0x1BD03C81406979E9ULL }, { 0x3F6095F5E4FF5EF0ULL, 0x116225D0C841EC32ULL },
+    { 0xCF38BB735E3F36ACULL, 0x15BAAF44FA52673EULL }, { 0x8306EA5035CF0457ULL, 0x1B295B1638E7010EULL },
+    { 0x11E4527221A162B6ULL, 0x10F9D8EDE39060A9ULL }, { 0x565D670EAA09BB64ULL, 0x15384F295C7478D3ULL },
+    { 0x2BF4C0D2548C2A3DULL, 0x1A8662F3B3919708ULL }, { 0x1B78F88374D79A66ULL, 0x1093FDD8503AFE65ULL },
+    { 0x625736A4520D8100ULL, 0x14B8FD4E6449BDFEULL }, { 0xFAED044D6690E140ULL, 0x19E73CA1FD5C2D7DULL },
+    { 0xBCD422B0601A8CC8ULL, 0x103085E53E599C6EULL }, { 0x6C092B5C78212FFAULL, 0x143CA75E8DF0038AULL },
+    { 0x070B763396297BF8ULL, 0x194BD136316C046DULL }, { 0x48CE53C07BB3DAF6ULL, 0x1F9EC583BDC70588ULL },
+    { 0x2D80F4584D5068DAULL, 0x13C33B72569C6375ULL }, { 0x78E1316E60A48310ULL, 0x18B40A4EEC437C52ULL },
+};
+#endif // REFLEX_SUPPORT_TYPE_DOUBLE
+
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+const uint8_t REFLEX_JSON_NAMED = 1;
+#endif
+
+/* ------------------------------------ Compact Functions ---------------------------------- */
+const Reflex_ScanFunctions REFLEX_JSON_COMPACT = {
+    .fnChar         = Reflex_Json_onChar,
+    .fnUInt8        = Reflex_Json_onUInt8,
+    .fnInt8         = Reflex_Json_onInt8,
+    .fnUInt16       = Reflex_Json_onUInt16,
+    .fnInt16        = Reflex_Json_onInt16,
+    .fnUInt32       = Reflex_Json_onUInt32,
+    .fnInt32        = Reflex_Json_onInt32,
+#if REFLEX_SUPPORT_TYPE_64BIT
+    .fnUInt64       = Reflex_Json_onUInt64,
+    .fnInt64        = Reflex_Json_onInt64,
+#endif
+    .fnFloat        = Reflex_Json_onFloat,
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+    .fnDouble       = Reflex_Json_onDouble,
+#endif
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+    .fnComplexBegin = Reflex_Json_complexBegin,
+    .fnComplexEnd   = Reflex_Json_complexEnd,
+#endif
+};
+#if REFLEX_SUPPORT_DRIVER
+const Reflex_ScanDriver REFLEX_JSON_DRIVER = {
+    .Primary        = &REFLEX_JSON_COMPACT,
+#if REFLEX_SUPPORT_TYPE_POINTER
+    .Pointer        = &REFLEX_JSON_COMPACT,
+#endif
+#if REFLEX_SUPPORT_TYPE_ARRAY
+    .Array          = &REFLEX_JSON_COMPACT,
+#endif
+#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+    .PointerArray   = &REFLEX_JSON_COMPACT,
+#endif
+#if REFLEX_SUPPORT_TYPE_ARRAY_2D
+    .Array2D        = &REFLEX_JSON_COMPACT,
+#endif
+};
+#endif // REFLEX_SUPPORT_DRIVER
+
+/* ------------------------------------ JSON API ---------------------------------- */
+/**
+ * @brief This function initialize writer, after that writer can be used as buffer of reflex
+ * with REFLEX_JSON_COMPACT or REFLEX_JSON_DRIVER for scan of an object
+ *
+ * @param writer
+ * @param out output buffer
+ * @param size size of output buffer
+ */
+void Reflex_Json_begin(Reflex_JsonWriter* writer, void* out, Reflex_PtrType size) {
+    writer->Buf = (char*) out;
+    writer->Size = size;
+    writer->Len = 0;
+    writer->Depth = 0;
+    writer->Error = 0;
+    writer->Frames[0].Complex = NULL;
+    writer->Frames[0].Index = 0;
+    writer->Frames[0].Remaining = 0;
+    writer->Frames[0].Named = 0;
+}
+/**
+ * @brief This function close main object and add null terminator if there is space for it
+ *
+ * @param writer
+ * @return Reflex_PtrType number of bytes of JSON text without null terminator, it can be more than size of buffer,
+ * 0 if nested complex fields are deeper than REFLEX_MAX_DEPTH
+ */
+Reflex_PtrType Reflex_Json_end(Reflex_JsonWriter* writer) {
+    Reflex_Json_close(writer, &writer->Frames[0]);
+    if (writer->Len < writer->Size) {
+        writer->Buf[writer->Len] = '\0';
+    }
+
+    return writer->Error ? 0 : writer->Len;
+}
+/**
+ * @brief This function encode object into JSON text with schema of reflex,
+ * callbacks of reflex are replaced with REFLEX_JSON_COMPACT and writer is used as buffer of reflex
+ * Note: complex pointers must not be NULL, pointers of primary types are written as null
+ *
+ * @param reflex
+ * @param obj
+ * @param out output buffer, bytes after size are never written
+ * @param size size of output buffer
+ * @return Reflex_PtrType number of bytes of JSON text without null terminator, if it's not less than size
+ * text is truncated and a buffer with return value + 1 bytes is needed, 0 on error
+ */
+Reflex_PtrType Reflex_Json_encode(Reflex* reflex, void* obj, void* out, Reflex_PtrType size) {
+    Reflex_JsonWriter writer;
+
+    Reflex_Json_begin(&writer, out, size);
+    writer.Frames[0].Named = Reflex_Json_named(reflex->Schema);
+    Reflex_setCompact(reflex, &REFLEX_JSON_COMPACT);
+    Reflex_setBuffer(reflex, &writer);
+    if (Reflex_scan(reflex, obj) != REFLEX_OK) {
+        return 0;
+    }
+
+    return Reflex_Json_end(&writer);
+}
+/**
+ * @brief This function format an integer into decimal digits, two digits are converted at each step
+ *
+ * @param out output, it must have 20 bytes
+ * @param value
+ * @return Reflex_LenType number of written bytes, it's not null terminated
+ */
+Reflex_LenType Reflex_Json_formatInt(char* out, int64_t value) {
+    if (value < 0) {
+        *out = '-';
+        return Reflex_Json_formatUInt(out + 1, (uint64_t) 0 - (uint64_t) value) + 1;
+    }
+
+    return Reflex_Json_formatUInt(out, (uint64_t) value);
+}
+/**
+ * @brief This function format an unsigned integer into decimal digits, two digits are converted at each step
+ *
+ * @param out output, it must have 20 bytes
+ * @param value
+ * @return Reflex_LenType number of written bytes, it's not null terminated
+ */
+Reflex_LenType Reflex_Json_formatUInt(char* out, uint64_t value) {
+    char text[20];
+    char* end = text + sizeof(text);
+    char* start = Reflex_Json_digits(end, value);
+
+    memcpy(out, start, (size_t) (end - start));
+
+    return (Reflex_LenType) (end - start);
+}
+/**
+ * @brief This function format a float with shortest digits that read back to same float,
+ * numbers between 1e-6 and 1e21 are written without exponent, NaN and infinity are written as null
+ *
+ * @param out output, it must have REFLEX_JSON_NUMBER_LEN bytes
+ * @param value
+ * @return Reflex_LenType number of written bytes, it's not null terminated
+ */
+Reflex_LenType Reflex_Json_formatFloat(char* out, float value) {
+    uint32_t bits;
+    uint32_t mantissa;
+    uint32_t exponent;
+    uint32_t m2;
+    uint32_t mv;
+    uint32_t mp;
+    uint32_t mm;
+    uint32_t vr;
+    uint32_t vp;
+    uint32_t vm;
+    uint32_t q;
+    int32_t e2;
+    int32_t e10;
+    int32_t i;
+    int32_t j;
+    int32_t k;
+    int32_t removed = 0;
+    uint8_t mmShift;
+    uint8_t acceptBounds;
+    uint8_t vmIsTrailingZeros = 0;
+    uint8_t vrIsTrailingZeros = 0;
+    uint8_t lastRemovedDigit = 0;
+
+    memcpy(&bits, &value, sizeof(bits));
+    mantissa = bits & ((1u << 23) - 1);
+    exponent = (bits >> 23) & 0xFF;
+    if (exponent == 0xFF) {
+        memcpy(out, "null", 4);
+        return 4;
+    }
+    else if (exponent == 0 && mantissa == 0) {
+        return Reflex_Json_decimal(out, (uint8_t) (bits >> 31), 0, 0);
+    }
+    // value is m2 * 2^e2, bounds of interval that round to value are (mm, mp) / 4
+    if (exponent == 0) {
+        e2 = 1 - 127 - 23 - 2;
+        m2 = mantissa;
+    }
+    else {
+        e2 = (int32_t) exponent - 127 - 23 - 2;
+        m2 = (1u << 23) | mantissa;
+    }
+    acceptBounds = (m2 & 1) == 0;
+    mv = 4 * m2;
+    mp = 4 * m2 + 2;
+    mmShift = mantissa != 0 || exponent <= 1;
+    mm = 4 * m2 - 1 - mmShift;
+    // convert to decimal interval
+    if (e2 >= 0) {
+        q = __log10Pow2(e2);
+        e10 = (int32_t) q;
+        k = REFLEX_JSON_FLOAT_POW5_INV_BITS + __pow5bits(q) - 1;
+        i = -e2 + (int32_t) q + k;
+        vr = Reflex_Json_mulShift32(mv, REFLEX_JSON_FLOAT_POW5_INV[q], i);
+        vp = Reflex_Json_mulShift32(mp, REFLEX_JSON_FLOAT_POW5_INV[q], i);
+        vm = Reflex_Json_mulShift32(mm, REFLEX_JSON_FLOAT_POW5_INV[q], i);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            // loop below not run, so last removed digit is needed here
+            k = REFLEX_JSON_FLOAT_POW5_INV_BITS + __pow5bits(q - 1) - 1;
+            lastRemovedDigit = (uint8_t) (Reflex_Json_mulShift32(mv, REFLEX_JSON_FLOAT_POW5_INV[q - 1], -e2 + (int32_t) q - 1 + k) % 10);
+        }
+        if (q <= 9) {
+            if (mv % 5 == 0) {
+                vrIsTrailingZeros = Reflex_Json_pow5Factor(mv) >= q;
+            }
+            else if (acceptBounds) {
+                vmIsTrailingZeros = Reflex_Json_pow5Factor(mm) >= q;
+            }
+            else {
+                vp -= Reflex_Json_pow5Factor(mp) >= q;
+            }
+        }
+    }
+    else {
+        q = __log10Pow5(-e2);
+        e10 = (int32_t) q + e2;
+        i = -e2 - (int32_t) q;
+        k = __pow5bits(i) - REFLEX_JSON_FLOAT_POW5_BITS;
+        j = (int32_t) q - k;
+        vr = Reflex_Json_mulShift32(mv, REFLEX_JSON_FLOAT_POW5[i], j);
+        vp = Reflex_Json_mulShift32(mp, REFLEX_JSON_FLOAT_POW5[i], j);
+        vm = Reflex_Json_mulShift32(mm, REFLEX_JSON_FLOAT_POW5[i], j);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = (int32_t) q - 1 - (__pow5bits(i + 1) - REFLEX_JSON_FLOAT_POW5_BITS);
+            lastRemovedDigit = (uint8_t) (Reflex_Json_mulShift32(mv, REFLEX_JSON_FLOAT_POW5[i + 1], j) % 10);
+        }
+        if (q <= 1) {
+            vrIsTrailingZeros = 1;
+            if (acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            }
+            else {
+                vp--;
+            }
+        }
+        else if (q < 31) {
+            vrIsTrailingZeros = (mv & ((1u << (q - 1)) - 1)) == 0;
+        }
+    }
+    // remove digits while interval has a shorter number
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint8_t) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint8_t) (vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+            // round even
+            lastRemovedDigit = 4;
+        }
+        vr += (vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5;
+    }
+    else {
+        while (vp / 10 > vm / 10) {
+            lastRemovedDigit = (uint8_t) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        vr += vr == vm || lastRemovedDigit >= 5;
+    }
+
+    return Reflex_Json_decimal(out, (uint8_t) (bits >> 31), vr, e10 + removed);
+}
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+/**
+ * @brief This function format a double with shortest digits that read back to same double,
+ * numbers between 1e-6 and 1e21 are written without exponent, NaN and infinity are written as null
+ *
+ * @param out output, it must have REFLEX_JSON_NUMBER_LEN bytes
+ * @param value
+ * @return Reflex_LenType number of written bytes, it's not null terminated
+ */
+Reflex_LenType Reflex_Json_formatDouble(char* out, double value) {
+    uint64_t bits;
+    uint64_t mantissa;
+    uint32_t exponent;
+    uint64_t m2;
+    uint64_t mv;
+    uint64_t vr;
+    uint64_t vp;
+    uint64_t vm;
+    uint32_t q;
+    int32_t e2;
+    int32_t e10;
+    int32_t i;
+    int32_t j;
+    int32_t k;
+    int32_t removed = 0;
+    uint8_t mmShift;
+    uint8_t acceptBounds;
+    uint8_t vmIsTrailingZeros = 0;
+    uint8_t vrIsTrailingZeros = 0;
+    uint8_t lastRemovedDigit = 0;
+    uint8_t roundUp = 0;
+
+    memcpy(&bits, &value, sizeof(bits));
+    mantissa = bits & ((1ULL << 52) - 1);
+    exponent = (uint32_t) ((bits >> 52) & 0x7FF);
+    if (exponent == 0x7FF) {
+        memcpy(out, "null", 4);
+        return 4;
+    }
+    else if (exponent == 0 && mantissa == 0) {
+        return Reflex_Json_decimal(out, (uint8_t) (bits >> 63), 0, 0);
+    }
+    // value is m2 * 2^e2, bounds of interval that round to value are (mm, mp) / 4
+    if (exponent == 0) {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = mantissa;
+    }
+    else {
+        e2 = (int32_t) exponent - 1023 - 52 - 2;
+        m2 = (1ULL << 52) | mantissa;
+    }
+    acceptBounds = (m2 & 1) == 0;
+    mv = 4 * m2;
+    mmShift = mantissa != 0 || exponent <= 1;
+    // convert to decimal interval
+    if (e2 >= 0) {
+        q = __log10Pow2(e2) - (e2 > 3);
+        e10 = (int32_t) q;
+        k = REFLEX_JSON_DOUBLE_POW5_INV_BITS + __pow5bits(q) - 1;
+        i = -e2 + (int32_t) q + k;
+        vr = Reflex_Json_mulShift64(mv, REFLEX_JSON_DOUBLE_POW5_INV[q], i);
+        vp = Reflex_Json_mulShift64(mv + 2, REFLEX_JSON_DOUBLE_POW5_INV[q], i);
+        vm = Reflex_Json_mulShift64(mv - 1 - mmShift, REFLEX_JSON_DOUBLE_POW5_INV[q], i);
+        if (q <= 21) {
+            if (mv % 5 == 0) {
+                vrIsTrailingZeros = Reflex_Json_pow5Factor(mv) >= q;
+            }
+            else if (acceptBounds) {
+                vmIsTrailingZeros = Reflex_Json_pow5Factor(mv - 1 - mmShift) >= q;
+            }
+            else {
+                vp -= Reflex_Json_pow5Factor(mv + 2) >= q;
+            }
+        }
+    }
+    else {
+        q = __log10Pow5(-e2) - (-e2 > 1);
+        e10 = (int32_t) q + e2;
+        i = -e2 - (int32_t) q;
+        k = __pow5bits(i) - REFLEX_JSON_DOUBLE_POW5_BITS;
+        j = (int32_t) q - k;
+        vr = Reflex_Json_mulShift64(mv, REFLEX_JSON_DOUBLE_POW5[i], j);
+        vp = Reflex_Json_mulShift64(mv + 2, REFLEX_JSON_DOUBLE_POW5[i], j);
+        vm = Reflex_Json_mulShift64(mv - 1 - mmShift, REFLEX_JSON_DOUBLE_POW5[i], j);
+        if (q <= 1) {
+            vrIsTrailingZeros = 1;
+            if (acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            }
+            else {
+                vp--;
+            }
+        }
+        else if (q < 63) {
+            vrIsTrailingZeros = (mv & ((1ULL << q) - 1)) == 0;
+        }
+    }
+    // remove digits while interval has a shorter number
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint8_t) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint8_t) (vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+            // round even
+            lastRemovedDigit = 4;
+        }
+        vr += (vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5;
+    }
+    else {
+        // common case, two digits are removed at first step
+        if (vp / 100 > vm / 100) {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        vr += vr == vm || roundUp;
+    }
+
+    return Reflex_Json_decimal(out, (uint8_t) (bits >> 63), vr, e10 + removed);
+}
+#endif // REFLEX_SUPPORT_TYPE_DOUBLE
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function bind reader to a compiled plan, names of fields of each object
+ * are added to a hash table, so each key is found in constant time
+ * Note: objects of schemas with Reflex_JsonParams formats are read from JSON objects,
+ * other objects are read from JSON arrays of fields same as Reflex_Json_encode
+ * Note 2: if keys is NULL, it's return number of keys that reader need
+ *
+ * @param reader
+ * @param schema schema of main object
+ * @param plan compiled plan of schema
+ * @param keys array of keys
+ * @param size size of keys array, it's number of hash buckets too
+ * @return Reflex_LenType number of keys, -1 if keys array is small
+ */
+Reflex_LenType Reflex_Json_bind(Reflex_JsonReader* reader, const Reflex_Schema* schema, const Reflex_PlanOp* plan, Reflex_JsonKey* keys, Reflex_LenType size) {
+    Reflex_LenType scopes[REFLEX_MAX_DEPTH + 1];
+    uint8_t named[REFLEX_MAX_DEPTH + 1];
+    Reflex_LenType depth = 0;
+    Reflex_LenType count = 0;
+    Reflex_LenType index;
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+    Reflex_JsonKey* key;
+    const char* name;
+#endif
+
+    reader->Plan = plan;
+    reader->Keys = keys;
+    reader->Size = size;
+    reader->Len = 0;
+    reader->Named = Reflex_Json_named(schema);
+    for (index = 0; keys != NULL && index < size; index++) {
+        keys[index].Head = -1;
+    }
+    scopes[0] = 0;
+    named[0] = reader->Named;
+
+    for (index = 0; plan[index].Code != Reflex_PlanCode_Return; index++) {
+        switch (plan[index].Code) {
+            case Reflex_PlanCode_Field:
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Begin:
+        #endif
+            #if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+                // formats of objects without names are not Reflex_JsonParams
+                name = named[depth] ? ((const Reflex_JsonParams*) plan[index].Fmt)->Name : NULL;
+                if (name != NULL) {
+                    if (keys != NULL) {
+                        if (count >= size) {
+                            return -1;
+                        }
+                        key = &keys[count];
+                        key->Hash = Reflex_Json_hash(name, (Reflex_PtrType) strlen(name), scopes[depth]);
+                        key->Scope = scopes[depth];
+                        key->Op = index;
+                        key->Next = keys[key->Hash % (uint32_t) size].Head;
+                        keys[key->Hash % (uint32_t) size].Head = count;
+                    }
+                    count++;
+                }
+            #endif
+            #if REFLEX_SUPPORT_TYPE_COMPLEX
+                if (plan[index].Code == Reflex_PlanCode_Begin) {
+                    // fields of elements are in scope of first op of element
+                    depth++;
+                    scopes[depth] = index + 1;
+                    named[depth] = Reflex_Json_named(plan[index].Params.Schema);
+                }
+            #endif
+                break;
+        #if REFLEX_SUPPORT_TYPE_COMPLEX
+            case Reflex_PlanCode_Next:
+                // elements after first one have their own ops
+                scopes[depth] = index + 1;
+                break;
+            case Reflex_PlanCode_End:
+                depth--;
+                break;
+        #endif
+            default:
+                break;
+        }
+    }
+    reader->Len = count;
+
+    return count;
+}
+/**
+ * @brief This function parse JSON text in one pass and write values into fields of object,
+ * unknown keys and extra items are skipped, fields without value and null values are not changed,
+ * strings are null terminated if there is space in char array
+ * Note: objects of complex pointers must be allocated, values of NULL pointers are skipped
+ *
+ * @param reader bound reader
+ * @param obj
+ * @param text JSON text, a null terminator after text is accepted
+ * @param len length of text
+ * @return Reflex_Result REFLEX_OK, REFLEX_ERROR if text is not valid, a number is out of range of field
+ * or a string is longer than char array, position of error is in reader->Pos
+ */
+Reflex_Result Reflex_Json_decode(Reflex_JsonReader* reader, void* obj, const void* text, Reflex_PtrType len) {
+    reader->Text = (const char*) text;
+    reader->TextLen = len;
+    reader->Pos = 0;
+    reader->Error = 0;
+
+    Reflex_Json_readObject(reader, 0, reader->Named, (uint8_t*) obj);
+    Reflex_Json_space(reader);
+    if (__peek(reader) != '\0') {
+        reader->Error = 1;
+    }
+
+    return reader->Error ? REFLEX_ERROR : REFLEX_OK;
+}
+#endif // REFLEX_SUPPORT_PLAN
+/* ---------------------- Private Functions (Implementation) ----------------------- */
+/**
+ * @brief This function write bytes into buffer, bytes after end of buffer are only counted
+ *
+ * @param writer
+ * @param text
+ * @param len
+ */
+static void Reflex_Json_write(Reflex_JsonWriter* writer, const char* text, Reflex_PtrType len) {
+    Reflex_PtrType space;
+
+    if (writer->Len < writer->Size) {
+        space = writer->Size - writer->Len;
+        memcpy(writer->Buf + writer->Len, text, (size_t) (len < space ? len : space));
+    }
+    writer->Len += len;
+}
+/**
+ * @brief This function write an escaped JSON string, string is finished at null terminator or len,
+ * bytes that not need escape are written in bulk
+ *
+ * @param writer
+ * @param str
+ * @param len maximum length of string
+ */
+static void Reflex_Json_string(Reflex_JsonWriter* writer, const char* str, Reflex_LenType len) {
+    char escape[6] = { '\\', 'u', '0', '0', '0', '0' };
+    Reflex_LenType start = 0;
+    Reflex_LenType index;
+    uint8_t c;
+
+    __putChar(writer, '"');
+    for (index = 0; index < len && str[index] != '\0'; index++) {
+        c = (uint8_t) str[index];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        Reflex_Json_write(writer, str + start, (Reflex_PtrType) (index - start));
+        start = index + 1;
+        switch (c) {
+            case '"':
+            case '\\':
+                escape[1] = (char) c;
+                Reflex_Json_write(writer, escape, 2);
+                break;
+            case '\b':
+                __putText(writer, "\\b");
+                break;
+            case '\f':
+                __putText(writer, "\\f");
+                break;
+            case '\n':
+                __putText(writer, "\\n");
+                break;
+            case '\r':
+                __putText(writer, "\\r");
+                break;
+            case '\t':
+                __putText(writer, "\\t");
+                break;
+            default:
+                escape[1] = 'u';
+                escape[4] = REFLEX_JSON_HEX[c >> 4];
+                escape[5] = REFLEX_JSON_HEX[c & 0x0F];
+                Reflex_Json_write(writer, escape, 6);
+                break;
+        }
+    }
+    Reflex_Json_write(writer, str + start, (Reflex_PtrType) (index - start));
+    __putChar(writer, '"');
+}
+/**
+ * @brief This function write separator and name of field, if field is first field of an element
+ * previous element is closed and new element is opened
+ *
+ * @param reflex
+ * @param writer
+ * @param fmt
+ */
+static void Reflex_Json_key(Reflex* reflex, Reflex_JsonWriter* writer, const void* fmt) {
+    Reflex_JsonFrame* frame = &writer->Frames[writer->Depth];
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+    const char* name;
+#endif
+
+    if (frame->Remaining == 0) {
+        // first field of element
+        if (frame->Index > 0) {
+            __putChar(writer, frame->Named ? '}' : ']');
+        #if REFLEX_SUPPORT_TYPE_ARRAY_2D && REFLEX_SUPPORT_TYPE_COMPLEX
+            if (frame->Complex != NULL && frame->Complex->Fields.Category == Reflex_Category_Array2D &&
+                frame->Index % frame->Complex->MLen == 0
+            ) {
+                __putText(writer, "],[");
+            }
+            else
+        #endif
+            {
+                __putChar(writer, ',');
+            }
+        }
+        __putChar(writer, frame->Named ? '{' : '[');
+        frame->Index++;
+        frame->Remaining = reflex->Schema->Len;
+    }
+    else {
+        __putChar(writer, ',');
+    }
+    frame->Remaining--;
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+    if (frame->Named) {
+        name = ((const Reflex_JsonParams*) fmt)->Name;
+        __putChar(writer, '"');
+        if (name != NULL) {
+            Reflex_Json_write(writer, name, (Reflex_PtrType) strlen(name));
+        }
+        __putText(writer, "\":");
+    }
+#else
+    (void) fmt;
+#endif
+}
+/**
+ * @brief This function close last element and array of a complex field or main object
+ *
+ * @param writer
+ * @param frame
+ */
+static void Reflex_Json_close(Reflex_JsonWriter* writer, const Reflex_JsonFrame* frame) {
+    uint8_t category = frame->Complex != NULL ? frame->Complex->Fields.Category : (uint8_t) Reflex_Category_Primary;
+
+    if (frame->Index > 0) {
+        __putChar(writer, frame->Named ? '}' : ']');
+    }
+    switch (category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            __putChar(writer, ']');
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            __putText(writer, "]]");
+            break;
+    #endif
+        default:
+            // object without fields
+            if (frame->Index == 0) {
+                if (frame->Named) {
+                    __putText(writer, "{}");
+                }
+                else {
+                    __putText(writer, "[]");
+                }
+            }
+            break;
+    }
+}
+/**
+ * @brief This function check objects of schema are written as JSON objects,
+ * size of formats is checked first, so Marker is read only inside of formats
+ *
+ * @param schema
+ * @return uint8_t 1 if formats of schema are Reflex_JsonParams
+ */
+static uint8_t Reflex_Json_named(const Reflex_Schema* schema) {
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+    return schema->FormatMode != Reflex_FormatMode_Primary && schema->FmtSize == sizeof(Reflex_JsonParams) &&
+        schema->Len > 0 && ((const Reflex_JsonParams*) schema->CustomFmt)->Marker == &REFLEX_JSON_NAMED;
+#else
+    (void) schema;
+    return 0;
+#endif
+}
+/**
+ * @brief This function write items of an array, char arrays are written as strings
+ *
+ * @param writer
+ * @param items
+ * @param len number of items
+ * @param put
+ * @param itemSize
+ */
+static void Reflex_Json_array(Reflex_JsonWriter* writer, const uint8_t* items, Reflex_LenType len, Reflex_JsonPutFn put, Reflex_LenType itemSize) {
+    if (put == Reflex_Json_putChar) {
+        Reflex_Json_string(writer, (const char*) items, len);
+        return;
+    }
+    __putChar(writer, '[');
+    while (len-- > 0) {
+        put(writer, items);
+        items += itemSize;
+        if (len > 0) {
+            __putChar(writer, ',');
+        }
+    }
+    __putChar(writer, ']');
+}
+/**
+ * @brief This function write a field of any category
+ *
+ * @param reflex
+ * @param value address of field
+ * @param fmt
+ * @param put put function of primary type of field
+ * @param itemSize size of primary type
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Json_field(Reflex* reflex, const uint8_t* value, const Reflex_TypeParams* fmt, Reflex_JsonPutFn put, Reflex_LenType itemSize) {
+    Reflex_JsonWriter* writer = (Reflex_JsonWriter*) reflex->Buffer;
+#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
+    Reflex_LenType index;
+#endif
+
+    if (__ignored(writer)) {
+        return REFLEX_OK;
+    }
+    Reflex_Json_key(reflex, writer, fmt);
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            value = *(const uint8_t* const*) value;
+            if (value == NULL) {
+                __putText(writer, "null");
+            }
+            else {
+                put(writer, value);
+            }
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+            Reflex_Json_array(writer, value, fmt->Len, put, itemSize);
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            __putChar(writer, '[');
+            for (index = 0; index < fmt->Len; index++) {
+                if (index > 0) {
+                    __putChar(writer, ',');
+                }
+                if (((const uint8_t* const*) value)[index] == NULL) {
+                    __putText(writer, "null");
+                }
+                else {
+                    put(writer, ((const uint8_t* const*) value)[index]);
+                }
+            }
+            __putChar(writer, ']');
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            // Len rows of MLen items
+            __putChar(writer, '[');
+            for (index = 0; index < fmt->Len; index++) {
+                if (index > 0) {
+                    __putChar(writer, ',');
+                }
+                Reflex_Json_array(writer, value, fmt->MLen, put, itemSize);
+                value += fmt->MLen * itemSize;
+            }
+            __putChar(writer, ']');
+            break;
+    #endif
+        default:
+            put(writer, value);
+            break;
+    }
+
+    return REFLEX_OK;
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function write name of complex field and open it, elements are opened by their first field
+ *
+ * @param reflex
+ * @param value
+ * @param fmt
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Json_complexBegin(Reflex* reflex, void* value, const void* fmt) {
+    Reflex_JsonWriter* writer = (Reflex_JsonWriter*) reflex->Buffer;
+    const Reflex_TypeParams* params = (const Reflex_TypeParams*) fmt;
+    Reflex_JsonFrame* frame;
+
+    (void) value;
+    if (__ignored(writer)) {
+        writer->Depth++;
+        return REFLEX_OK;
+    }
+    Reflex_Json_key(reflex, writer, fmt);
+    if (writer->Depth == REFLEX_MAX_DEPTH) {
+        writer->Depth++;
+        writer->Error = 1;
+        return REFLEX_OK;
+    }
+    frame = &writer->Frames[++writer->Depth];
+    frame->Complex = params;
+    frame->Index = 0;
+    frame->Remaining = 0;
+    frame->Named = Reflex_Json_named(params->Schema);
+    switch (params->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            __putChar(writer, '[');
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            __putText(writer, "[[");
+            break;
+    #endif
+        default:
+            break;
+    }
+
+    return REFLEX_OK;
+}
+/**
+ * @brief This function close last element of complex field and complex field
+ *
+ * @param reflex
+ * @param value
+ * @param fmt
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Json_complexEnd(Reflex* reflex, void* value, const void* fmt) {
+    Reflex_JsonWriter* writer = (Reflex_JsonWriter*) reflex->Buffer;
+
+    (void) value;
+    (void) fmt;
+    if (!__ignored(writer)) {
+        Reflex_Json_close(writer, &writer->Frames[writer->Depth]);
+    }
+    writer->Depth--;
+
+    return REFLEX_OK;
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function write decimal digits of value before end, two digits are converted at each step
+ *
+ * @param end end of output
+ * @param value
+ * @return char* first digit
+ */
+static char* Reflex_Json_digits(char* end, uint64_t value) {
+    uint32_t small;
+    uint32_t pair;
+
+    // 64-bit division only for big numbers
+    while (value > UINT32_MAX) {
+        pair = (uint32_t) (value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        end[0] = REFLEX_JSON_DIGITS[pair];
+        end[1] = REFLEX_JSON_DIGITS[pair + 1];
+    }
+    small = (uint32_t) value;
+    while (small >= 100) {
+        pair = (small % 100) * 2;
+        small /= 100;
+        end -= 2;
+        end[0] = REFLEX_JSON_DIGITS[pair];
+        end[1] = REFLEX_JSON_DIGITS[pair + 1];
+    }
+    if (small >= 10) {
+        end -= 2;
+        end[0] = REFLEX_JSON_DIGITS[small * 2];
+        end[1] = REFLEX_JSON_DIGITS[small * 2 + 1];
+    }
+    else {
+        *--end = (char) ('0' + small);
+    }
+
+    return end;
+}
+/**
+ * @brief This function write digits * 10^exponent, exponent is used only for very small or big numbers
+ *
+ * @param out output, it must have REFLEX_JSON_NUMBER_LEN bytes
+ * @param sign 1 for negative numbers
+ * @param digits decimal digits, at most 17 digits
+ * @param exponent
+ * @return Reflex_LenType number of written bytes
+ */
+static Reflex_LenType Reflex_Json_decimal(char* out, uint8_t sign, uint64_t digits, int32_t exponent) {
+    char text[20];
+    char* end = text + sizeof(text);
+    char* start = Reflex_Json_digits(end, digits);
+    int32_t len = (int32_t) (end - start);
+    int32_t point = len + exponent;
+    char* pout = out;
+
+    if (sign) {
+        *pout++ = '-';
+    }
+    if (len <= point && point <= 21) {
+        // integer, ex: 1200
+        memcpy(pout, start, (size_t) len);
+        pout += len;
+        memset(pout, '0', (size_t) (point - len));
+        pout += point - len;
+    }
+    else if (0 < point && point <= 21) {
+        // ex: 12.5
+        memcpy(pout, start, (size_t) point);
+        pout += point;
+        *pout++ = '.';
+        memcpy(pout, start + point, (size_t) (len - point));
+        pout += len - point;
+    }
+    else if (-6 < point && point <= 0) {
+        // ex: 0.00125
+        *pout++ = '0';
+        *pout++ = '.';
+        memset(pout, '0', (size_t) -point);
+        pout += -point;
+        memcpy(pout, start, (size_t) len);
+        pout += len;
+    }
+    else {
+        // ex: 1.25e-7
+        *pout++ = *start;
+        if (len > 1) {
+            *pout++ = '.';
+            memcpy(pout, start + 1, (size_t) (len - 1));
+            pout += len - 1;
+        }
+        *pout++ = 'e';
+        pout += Reflex_Json_formatInt(pout, point - 1);
+    }
+
+    return (Reflex_LenType) (pout - out);
+}
+/**
+ * @brief This function return number of times that value is divisible by 5
+ *
+ * @param value it must not be zero
+ * @return uint32_t
+ */
+static uint32_t Reflex_Json_pow5Factor(uint64_t value) {
+    uint32_t count = 0;
+
+    while (value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+
+    return count;
+}
+/**
+ * @brief This function return (m * factor) >> shift, shift is more than 32
+ *
+ * @param m
+ * @param factor
+ * @param shift
+ * @return uint32_t
+ */
+static uint32_t Reflex_Json_mulShift32(uint32_t m, uint64_t factor, int32_t shift) {
+    uint64_t bits0 = (uint64_t) m * (uint32_t) factor;
+    uint64_t bits1 = (uint64_t) m * (factor >> 32);
+
+    return (uint32_t) (((bits0 >> 32) + bits1) >> (shift - 32));
+}
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+/**
+ * @brief This function return (m * mul) >> shift, mul is 128-bit and shift is between 64 and 128
+ *
+ * @param m
+ * @param mul low and high part of 128-bit multiplier
+ * @param shift
+ * @return uint64_t
+ */
+static uint64_t Reflex_Json_mulShift64(uint64_t m, const uint64_t* mul, int32_t shift) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 Reflex_UInt128;
+    Reflex_UInt128 b0 = (Reflex_UInt128) m * mul[0];
+    Reflex_UInt128 b2 = (Reflex_UInt128) m * mul[1];
+
+    return (uint64_t) (((b0 >> 64) + b2) >> (shift - 64));
+#else
+    // 64x64 multiply with 32-bit halves
+    uint64_t mLo = (uint32_t) m;
+    uint64_t mHi = m >> 32;
+    uint64_t b00 = mLo * (uint32_t) mul[0];
+    uint64_t b01 = mLo * (mul[0] >> 32);
+    uint64_t b10 = mHi * (uint32_t) mul[0];
+    uint64_t b11 = mHi * (mul[0] >> 32);
+    uint64_t mid = b10 + (b00 >> 32) + (uint32_t) b01;
+    uint64_t high0 = b11 + (mid >> 32) + (b01 >> 32);
+    uint64_t low1;
+    uint64_t high1;
+    uint64_t sum;
+
+    b00 = mLo * (uint32_t) mul[1];
+    b01 = mLo * (mul[1] >> 32);
+    b10 = mHi * (uint32_t) mul[1];
+    b11 = mHi * (mul[1] >> 32);
+    mid = b10 + (b00 >> 32) + (uint32_t) b01;
+    high1 = b11 + (mid >> 32) + (b01 >> 32);
+    low1 = (mid << 32) | (uint32_t) b00;
+    sum = high0 + low1;
+    if (sum < high0) {
+        high1++;
+    }
+    shift -= 64;
+
+    return (high1 << (64 - shift)) | (sum >> shift);
+#endif
+}
+#endif // REFLEX_SUPPORT_TYPE_DOUBLE
+/**
+ * @brief This function write a char as a string
+ *
+ * @param writer
+ * @param item
+ */
+static void Reflex_Json_putChar(Reflex_JsonWriter* writer, const void* item) {
+    Reflex_Json_string(writer, (const char*) item, 1);
+}
+/**
+ * @brief This function write a float
+ *
+ * @param writer
+ * @param item
+ */
+static void Reflex_Json_putFloat(Reflex_JsonWriter* writer, const void* item) {
+    char text[REFLEX_JSON_NUMBER_LEN];
+
+    Reflex_Json_write(writer, text, (Reflex_PtrType) Reflex_Json_formatFloat(text, *(const float*) item));
+}
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+/**
+ * @brief This function write a double
+ *
+ * @param writer
+ * @param item
+ */
+static void Reflex_Json_putDouble(Reflex_JsonWriter* writer, const void* item) {
+    char text[REFLEX_JSON_NUMBER_LEN];
+
+    Reflex_Json_write(writer, text, (Reflex_PtrType) Reflex_Json_formatDouble(text, *(const double*) item));
+}
+#endif // REFLEX_SUPPORT_TYPE_DOUBLE
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief This function return FNV-1a hash of name mixed with scope
+ *
+ * @param name
+ * @param len length of name
+ * @param scope index of first op of object
+ * @return uint32_t
+ */
+static uint32_t Reflex_Json_hash(const char* name, Reflex_PtrType len, Reflex_LenType scope) {
+    uint32_t hash = 2166136261u;
+
+    while (len-- > 0) {
+        hash = (hash ^ (uint8_t) *name++) * 16777619u;
+    }
+
+    return hash ^ ((uint32_t) scope * 2654435761u);
+}
+/**
+ * @brief This function find a field of object by name in hash table of reader
+ *
+ * @param reader
+ * @param scope index of first op of object
+ * @param name name of field, it's not null terminated
+ * @param len length of name
+ * @return Reflex_LenType index of Field or Begin op, -1 if field not found
+ */
+static Reflex_LenType Reflex_Json_find(const Reflex_JsonReader* reader, Reflex_LenType scope, const char* name, Reflex_PtrType len) {
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+    const Reflex_JsonKey* key;
+    const char* keyName;
+    Reflex_LenType entry;
+    uint32_t hash;
+
+    if (name == NULL || reader->Size == 0) {
+        return -1;
+    }
+    hash = Reflex_Json_hash(name, len, scope);
+    for (entry = reader->Keys[hash % (uint32_t) reader->Size].Head; entry >= 0; entry = key->Next) {
+        key = &reader->Keys[entry];
+        if (key->Hash == hash && key->Scope == scope) {
+            keyName = ((const Reflex_JsonParams*) reader->Plan[key->Op].Fmt)->Name;
+            if (strncmp(keyName, name, (size_t) len) == 0 && keyName[len] == '\0') {
+                return key->Op;
+            }
+        }
+    }
+#else
+    (void) reader;
+    (void) scope;
+    (void) name;
+    (void) len;
+#endif
+
+    return -1;
+}
+/**
+ * @brief This function skip white spaces
+ *
+ * @param reader
+ */
+static void Reflex_Json_space(Reflex_JsonReader* reader) {
+    const char* text = reader->Text;
+    Reflex_PtrType pos = reader->Pos;
+
+    while (pos < reader->TextLen && (text[pos] == ' ' || text[pos] == '\n' || text[pos] == '\r' || text[pos] == '\t')) {
+        pos++;
+    }
+    reader->Pos = pos;
+}
+/**
+ * @brief This function read a character, it's error if next character is different
+ *
+ * @param reader
+ * @param c
+ */
+static void Reflex_Json_expect(Reflex_JsonReader* reader, char c) {
+    Reflex_Json_space(reader);
+    if (__peek(reader) == c) {
+        reader->Pos++;
+    }
+    else {
+        reader->Error = 1;
+    }
+}
+/**
+ * @brief This function read null literal if next value is null
+ *
+ * @param reader
+ * @return uint8_t 1 if null is read
+ */
+static uint8_t Reflex_Json_null(Reflex_JsonReader* reader) {
+    Reflex_Json_space(reader);
+    if (!reader->Error && reader->TextLen - reader->Pos >= 4 && memcmp(reader->Text + reader->Pos, "null", 4) == 0) {
+        reader->Pos += 4;
+        return 1;
+    }
+
+    return 0;
+}
+/**
+ * @brief This function open an object or array
+ *
+ * @param reader
+ * @param c '{' or '['
+ * @return uint8_t 1 if there is a value in object or array, 0 for empty object or array and errors
+ */
+static uint8_t Reflex_Json_open(Reflex_JsonReader* reader, char c) {
+    Reflex_Json_expect(reader, c);
+    if (reader->Error) {
+        return 0;
+    }
+    Reflex_Json_space(reader);
+    if (__peek(reader) == (c == '{' ? '}' : ']')) {
+        reader->Pos++;
+        return 0;
+    }
+
+    return 1;
+}
+/**
+ * @brief This function read separator of values or close of object or array
+ *
+ * @param reader
+ * @param close '}' or ']'
+ * @return uint8_t 1 if there is another value
+ */
+static uint8_t Reflex_Json_more(Reflex_JsonReader* reader, char close) {
+    if (reader->Error) {
+        return 0;
+    }
+    Reflex_Json_space(reader);
+    if (__peek(reader) == ',') {
+        reader->Pos++;
+        return 1;
+    }
+    Reflex_Json_expect(reader, close);
+
+    return 0;
+}
+/**
+ * @brief This function read key of a field and it's colon, keys without escape sequences are
+ * compared in place and escaped keys are decoded into a small buffer
+ *
+ * @param reader
+ * @param scope index of first op of object
+ * @return Reflex_LenType index of Field or Begin op, -1 for unknown keys
+ */
+static Reflex_LenType Reflex_Json_readKey(Reflex_JsonReader* reader, Reflex_LenType scope) {
+    char key[REFLEX_JSON_KEY_LEN];
+    const char* name;
+    Reflex_PtrType end;
+    Reflex_PtrType len;
+
+    Reflex_Json_space(reader);
+    if (__peek(reader) != '"') {
+        reader->Error = 1;
+        return -1;
+    }
+    name = reader->Text + reader->Pos + 1;
+    end = Reflex_Json_scanString(reader->Text, reader->Pos + 1, reader->TextLen);
+    if (end < reader->TextLen && reader->Text[end] == '"') {
+        len = end - reader->Pos - 1;
+        reader->Pos = end + 1;
+    }
+    else {
+        len = Reflex_Json_readString(reader, key, sizeof(key));
+        name = len <= sizeof(key) ? key : NULL;
+    }
+    Reflex_Json_expect(reader, ':');
+
+    return reader->Error ? -1 : Reflex_Json_find(reader, scope, name, len);
+}
+/**
+ * @brief This function read fields of an object, named objects are JSON objects and keys
+ * are found with hash table, other objects are JSON arrays of fields
+ *
+ * @param reader
+ * @param scope index of first op of object
+ * @param named object is a JSON object
+ * @param base address of object
+ */
+static void Reflex_Json_readObject(Reflex_JsonReader* reader, Reflex_LenType scope, uint8_t named, uint8_t* base) {
+    const Reflex_PlanOp* plan = reader->Plan;
+    Reflex_LenType op = scope;
+
+    if (Reflex_Json_null(reader) || !Reflex_Json_open(reader, named ? '{' : '[')) {
+        return;
+    }
+    do {
+        if (named) {
+            op = Reflex_Json_readKey(reader, scope);
+        }
+        if (op >= 0 && plan[op].Code == Reflex_PlanCode_Field) {
+            Reflex_Json_readField(reader, &plan[op].Params, base + plan[op].Offset);
+            op++;
+        }
+    #if REFLEX_SUPPORT_TYPE_COMPLEX
+        else if (op >= 0 && plan[op].Code == Reflex_PlanCode_Begin) {
+            Reflex_Json_readComplex(reader, op, base + plan[op].Offset);
+            op = plan[op].Jump + 1;
+        }
+    #endif
+        else {
+            // unknown key or extra value of array
+            Reflex_Json_skip(reader);
+        }
+    } while (Reflex_Json_more(reader, named ? '}' : ']'));
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function read elements of a complex field, 2D arrays are arrays of rows
+ *
+ * @param reader
+ * @param op index of Begin op
+ * @param field address of complex field
+ */
+static void Reflex_Json_readComplex(Reflex_JsonReader* reader, Reflex_LenType op, uint8_t* field) {
+    const Reflex_TypeParams* fmt = &reader->Plan[op].Params;
+    Reflex_LenType index = 0;
+#if REFLEX_SUPPORT_TYPE_ARRAY_2D
+    Reflex_LenType row = 0;
+#endif
+
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            if (!Reflex_Json_null(reader) && Reflex_Json_open(reader, '[')) {
+                do {
+                    Reflex_Json_readElement(reader, op, field, index++);
+                } while (Reflex_Json_more(reader, ']'));
+            }
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            // Len rows of MLen elements
+            if (Reflex_Json_null(reader) || !Reflex_Json_open(reader, '[')) {
+                break;
+            }
+            do {
+                if (row >= fmt->Len) {
+                    Reflex_Json_skip(reader);
+                }
+                else if (!Reflex_Json_null(reader) && Reflex_Json_open(reader, '[')) {
+                    index = 0;
+                    do {
+                        Reflex_Json_readElement(reader, op, field, index < fmt->MLen ? row * fmt->MLen + index : -1);
+                        index++;
+                    } while (Reflex_Json_more(reader, ']'));
+                }
+                row++;
+            } while (Reflex_Json_more(reader, ']'));
+            break;
+    #endif
+        default:
+            Reflex_Json_readElement(reader, op, field, 0);
+            break;
+    }
+}
+/**
+ * @brief This function read an element of complex field, elements are found same as plan scan,
+ * first element can have different layout and it's followed by Next op
+ *
+ * @param reader
+ * @param op index of Begin op
+ * @param field address of complex field
+ * @param index index of element, values of invalid indexes are skipped
+ */
+static void Reflex_Json_readElement(Reflex_JsonReader* reader, Reflex_LenType op, uint8_t* field, Reflex_LenType index) {
+    const Reflex_PlanOp* begin = &reader->Plan[op];
+    const Reflex_PlanOp* end = &reader->Plan[begin->Jump];
+    const Reflex_PlanOp* next = &reader->Plan[end->Jump - 1];
+    uint8_t* element;
+
+    if (index < 0 || index >= Reflex_Json_elements(&begin->Params)) {
+        Reflex_Json_skip(reader);
+        return;
+    }
+    switch (begin->Params.Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            element = *(uint8_t**) field;
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            element = ((uint8_t**) field)[index];
+            break;
+    #endif
+        default:
+            element = field;
+            if (index > 0) {
+                element += (next->Code == Reflex_PlanCode_Next ? next->Stride : end->Stride) + (index - 1) * end->Stride;
+            }
+            break;
+    }
+    if (element == NULL) {
+        Reflex_Json_skip(reader);
+        return;
+    }
+
+    Reflex_Json_readObject(reader, index == 0 ? op + 1 : end->Jump, Reflex_Json_named(begin->Params.Schema), element);
+}
+/**
+ * @brief This function return number of elements of a complex field
+ *
+ * @param fmt
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Json_elements(const Reflex_TypeParams* fmt) {
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+            return fmt->Len;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            return fmt->Len * fmt->MLen;
+    #endif
+        default:
+            return 1;
+    }
+}
+#endif // REFLEX_SUPPORT_TYPE_COMPLEX
+/**
+ * @brief This function read value of a field of primary types
+ *
+ * @param reader
+ * @param fmt
+ * @param field address of field
+ */
+static void Reflex_Json_readField(Reflex_JsonReader* reader, const Reflex_TypeParams* fmt, uint8_t* field) {
+    uint8_t type = fmt->Fields.Primary;
+#if REFLEX_SUPPORT_TYPE_POINTER_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D
+    Reflex_LenType index = 0;
+#endif
+
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_POINTER
+        case Reflex_Category_Pointer:
+            field = *(uint8_t**) field;
+            if (field == NULL) {
+                Reflex_Json_skip(reader);
+            }
+            else {
+                Reflex_Json_readItem(reader, type, field);
+            }
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+            Reflex_Json_readItems(reader, type, field, fmt->Len);
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_POINTER_ARRAY
+        case Reflex_Category_PointerArray:
+            if (!Reflex_Json_null(reader) && Reflex_Json_open(reader, '[')) {
+                do {
+                    if (index < fmt->Len && ((uint8_t**) field)[index] != NULL) {
+                        Reflex_Json_readItem(reader, type, ((uint8_t**) field)[index]);
+                    }
+                    else {
+                        Reflex_Json_skip(reader);
+                    }
+                    index++;
+                } while (Reflex_Json_more(reader, ']'));
+            }
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            // Len rows of MLen items
+            if (!Reflex_Json_null(reader) && Reflex_Json_open(reader, '[')) {
+                do {
+                    if (index < fmt->Len) {
+                        Reflex_Json_readItems(reader, type, field + index * fmt->MLen * REFLEX_JSON_ITEM_SIZE[type], fmt->MLen);
+                    }
+                    else {
+                        Reflex_Json_skip(reader);
+                    }
+                    index++;
+                } while (Reflex_Json_more(reader, ']'));
+            }
+            break;
+    #endif
+        default:
+            Reflex_Json_readItem(reader, type, field);
+            break;
+    }
+}
+/**
+ * @brief This function read items of an array, char arrays are strings
+ *
+ * @param reader
+ * @param type primary type of items
+ * @param items address of first item
+ * @param len number of items
+ */
+static void Reflex_Json_readItems(Reflex_JsonReader* reader, uint8_t type, uint8_t* items, Reflex_LenType len) {
+    Reflex_LenType index = 0;
+
+    if (type == Reflex_PrimaryType_Char) {
+        Reflex_Json_readText(reader, (char*) items, len);
+        return;
+    }
+    if (Reflex_Json_null(reader) || !Reflex_Json_open(reader, '[')) {
+        return;
+    }
+    do {
+        if (index < len) {
+            Reflex_Json_readItem(reader, type, items + index * REFLEX_JSON_ITEM_SIZE[type]);
+        }
+        else {
+            Reflex_Json_skip(reader);
+        }
+        index++;
+    } while (Reflex_Json_more(reader, ']'));
+}
+/**
+ * @brief This function read an item, integers must be in range of type
+ *
+ * @param reader
+ * @param type primary type of item
+ * @param item address of item
+ */
+static void Reflex_Json_readItem(Reflex_JsonReader* reader, uint8_t type, uint8_t* item) {
+    Reflex_JsonNumber num;
+
+    if (type == Reflex_PrimaryType_Char) {
+        Reflex_Json_readText(reader, (char*) item, 1);
+        return;
+    }
+    if (Reflex_Json_null(reader)) {
+        return;
+    }
+    Reflex_Json_readNumber(reader, &num);
+    if (reader->Error) {
+        return;
+    }
+    switch (type) {
+        case Reflex_PrimaryType_UInt8:
+            __readUInt(reader, num, item, uint8_t, UINT8_MAX);
+            break;
+        case Reflex_PrimaryType_Int8:
+            __readInt(reader, num, item, int8_t, INT8_MAX);
+            break;
+        case Reflex_PrimaryType_UInt16:
+            __readUInt(reader, num, item, uint16_t, UINT16_MAX);
+            break;
+        case Reflex_PrimaryType_Int16:
+            __readInt(reader, num, item, int16_t, INT16_MAX);
+            break;
+        case Reflex_PrimaryType_UInt32:
+            __readUInt(reader, num, item, uint32_t, UINT32_MAX);
+            break;
+        case Reflex_PrimaryType_Int32:
+            __readInt(reader, num, item, int32_t, INT32_MAX);
+            break;
+    #if REFLEX_SUPPORT_TYPE_64BIT
+        case Reflex_PrimaryType_UInt64:
+            __readUInt(reader, num, item, uint64_t, UINT64_MAX);
+            break;
+        case Reflex_PrimaryType_Int64:
+            __readInt(reader, num, item, int64_t, INT64_MAX);
+            break;
+    #endif
+        case Reflex_PrimaryType_Float:
+            *(float*) item = Reflex_Json_toFloat(reader, &num);
+            break;
+    #if REFLEX_SUPPORT_TYPE_DOUBLE
+        case Reflex_PrimaryType_Double:
+            *(double*) item = Reflex_Json_toDouble(reader, &num);
+            break;
+    #endif
+        default:
+            reader->Error = 1;
+            break;
+    }
+}
+/**
+ * @brief This function read a string into a char array, null terminator is added if there is space,
+ * longer strings are error and they are truncated with null terminator
+ *
+ * @param reader
+ * @param out
+ * @param size size of array
+ */
+static void Reflex_Json_readText(Reflex_JsonReader* reader, char* out, Reflex_LenType size) {
+    Reflex_PtrType len;
+
+    if (Reflex_Json_null(reader)) {
+        return;
+    }
+    len = Reflex_Json_readString(reader, out, (Reflex_PtrType) size);
+    if (len < (Reflex_PtrType) size) {
+        out[len] = '\0';
+    }
+    else if (len > (Reflex_PtrType) size) {
+        out[size - 1] = '\0';
+        reader->Error = 1;
+    }
+}
+/**
+ * @brief This function read a string and decode escape sequences, runs of bytes without escape
+ * are found with vector instructions and copied in bulk
+ *
+ * @param reader
+ * @param out output, it can be NULL for skip string
+ * @param size size of output, bytes after size are not written
+ * @return Reflex_PtrType length of decoded string, it can be more than size
+ */
+static Reflex_PtrType Reflex_Json_readString(Reflex_JsonReader* reader, char* out, Reflex_PtrType size) {
+    const char* text = reader->Text;
+    Reflex_PtrType len = 0;
+    Reflex_PtrType end;
+    Reflex_PtrType run;
+    char utf[4];
+
+    Reflex_Json_expect(reader, '"');
+    while (!reader->Error) {
+        end = Reflex_Json_scanString(text, reader->Pos, reader->TextLen);
+        run = end - reader->Pos;
+        if (out != NULL && len < size) {
+            memcpy(out + len, text + reader->Pos, (size_t) (run < size - len ? run : size - len));
+        }
+        len += run;
+        reader->Pos = end;
+        if (end >= reader->TextLen || (uint8_t) text[end] < 0x20) {
+            // string is not finished or it has control characters
+            reader->Error = 1;
+        }
+        else if (text[end] == '"') {
+            reader->Pos++;
+            break;
+        }
+        else {
+            run = Reflex_Json_escape(reader, utf);
+            if (out != NULL && len < size) {
+                memcpy(out + len, utf, (size_t) (run < size - len ? run : size - len));
+            }
+            len += run;
+        }
+    }
+
+    return len;
+}
+/**
+ * @brief This function decode an escape sequence, unicode escapes are converted to UTF-8
+ *
+ * @param reader
+ * @param out output, it must have 4 bytes
+ * @return uint8_t number of bytes of decoded character, 0 on error
+ */
+static uint8_t Reflex_Json_escape(Reflex_JsonReader* reader, char* out) {
+    const char* text = reader->Text + reader->Pos;
+    Reflex_PtrType remain = reader->TextLen - reader->Pos;
+    int32_t code;
+    int32_t low;
+
+    if (remain < 2) {
+        reader->Error = 1;
+        return 0;
+    }
+    reader->Pos += 2;
+    switch (text[1]) {
+        case '"':
+        case '\\':
+        case '/':
+            out[0] = text[1];
+            return 1;
+        case 'b':
+            out[0] = '\b';
+            return 1;
+        case 'f':
+            out[0] = '\f';
+            return 1;
+        case 'n':
+            out[0] = '\n';
+            return 1;
+        case 'r':
+            out[0] = '\r';
+            return 1;
+        case 't':
+            out[0] = '\t';
+            return 1;
+        case 'u':
+            code = remain >= 6 ? Reflex_Json_hex(text + 2) : -1;
+            reader->Pos += 4;
+            if (code >= 0xD800 && code <= 0xDBFF) {
+                // surrogate pair
+                low = remain >= 12 && text[6] == '\\' && text[7] == 'u' ? Reflex_Json_hex(text + 8) : -1;
+                if (low < 0xDC00 || low > 0xDFFF) {
+                    break;
+                }
+                reader->Pos += 6;
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            }
+            else if (code < 0 || (code >= 0xDC00 && code <= 0xDFFF)) {
+                break;
+            }
+            if (code < 0x80) {
+                out[0] = (char) code;
+                return 1;
+            }
+            else if (code < 0x800) {
+                out[0] = (char) (0xC0 | (code >> 6));
+                out[1] = (char) (0x80 | (code & 0x3F));
+                return 2;
+            }
+            else if (code < 0x10000) {
+                out[0] = (char) (0xE0 | (code >> 12));
+                out[1] = (char) (0x80 | ((code >> 6) & 0x3F));
+                out[2] = (char) (0x80 | (code & 0x3F));
+                return 3;
+            }
+            out[0] = (char) (0xF0 | (code >> 18));
+            out[1] = (char) (0x80 | ((code >> 12) & 0x3F));
+            out[2] = (char) (0x80 | ((code >> 6) & 0x3F));
+            out[3] = (char) (0x80 | (code & 0x3F));
+            return 4;
+        default:
+            break;
+    }
+    reader->Error = 1;
+
+    return 0;
+}
+/**
+ * @brief This function parse 4 hex digits
+ *
+ * @param text
+ * @return int32_t value, -1 if digits are not valid
+ */
+static int32_t Reflex_Json_hex(const char* text) {
+    int32_t value = 0;
+    uint8_t index;
+    char c;
+
+    for (index = 0; index < 4; index++) {
+        c = text[index];
+        if (__isDigit(c)) {
+            value = (value << 4) | (c - '0');
+        }
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+            value = (value << 4) | ((c | 0x20) - 'a' + 10);
+        }
+        else {
+            return -1;
+        }
+    }
+
+    return value;
+}
+/**
+ * @brief This function parse a number, digits after first 19 or 20 digits are only counted in exponent
+ *
+ * @param reader
+ * @param num
+ */
+static void Reflex_Json_readNumber(Reflex_JsonReader* reader, Reflex_JsonNumber* num) {
+    const char* text = reader->Text;
+    Reflex_PtrType len = reader->TextLen;
+    Reflex_PtrType pos = reader->Pos;
+    Reflex_PtrType digits;
+    int32_t exponent = 0;
+    uint8_t fraction = 0;
+    uint8_t sign = 0;
+    uint8_t digit;
+
+    num->Mantissa = 0;
+    num->Exponent = 0;
+    num->Start = pos;
+    num->Sign = 0;
+    num->Integer = 1;
+    num->Many = 0;
+    if (pos < len && text[pos] == '-') {
+        num->Sign = 1;
+        pos++;
+    }
+    // integer part, leading zeros are not allowed
+    digits = pos;
+    if (pos < len && text[pos] == '0') {
+        pos++;
+    }
+    while (pos < len) {
+        if (!__isDigit(text[pos])) {
+            if (text[pos] != '.' || fraction || pos == digits) {
+                break;
+            }
+            // fraction part
+            fraction = 1;
+            num->Integer = 0;
+            digits = ++pos;
+            continue;
+        }
+        if (text[digits] == '0' && !fraction) {
+            break;
+        }
+        digit = (uint8_t) (text[pos] - '0');
+        if (num->Mantissa < UINT64_MAX / 10 || (num->Mantissa == UINT64_MAX / 10 && digit <= UINT64_MAX % 10)) {
+            num->Mantissa = num->Mantissa * 10 + digit;
+            num->Exponent -= fraction;
+        }
+        else {
+            num->Many = 1;
+            num->Exponent += !fraction;
+        }
+        pos++;
+    }
+    if (pos == digits) {
+        reader->Error = 1;
+        return;
+    }
+    // exponent part
+    if (pos < len && (text[pos] | 0x20) == 'e') {
+        num->Integer = 0;
+        pos++;
+        if (pos < len && (text[pos] == '+' || text[pos] == '-')) {
+            sign = text[pos] == '-';
+            pos++;
+        }
+        digits = pos;
+        while (pos < len && __isDigit(text[pos])) {
+            if (exponent < 100000) {
+                exponent = exponent * 10 + (text[pos] - '0');
+            }
+            pos++;
+        }
+        if (pos == digits) {
+            reader->Error = 1;
+            return;
+        }
+        num->Exponent += sign ? -exponent : exponent;
+    }
+    num->End = pos;
+    reader->Pos = pos;
+}
+/**
+ * @brief This function copy text of number for strtod
+ *
+ * @param reader
+ * @param num
+ * @param text output, it must have REFLEX_JSON_NUMBER_TEXT bytes
+ * @return uint8_t 1 if number is copied, 0 if it's too long
+ */
+static uint8_t Reflex_Json_numberText(Reflex_JsonReader* reader, const Reflex_JsonNumber* num, char* text) {
+    Reflex_PtrType len = num->End - num->Start;
+
+    if (len >= REFLEX_JSON_NUMBER_TEXT) {
+        reader->Error = 1;
+        return 0;
+    }
+    memcpy(text, reader->Text + num->Start, (size_t) len);
+    text[len] = '\0';
+
+    return 1;
+}
+/**
+ * @brief This function convert number to float, small numbers are exact in float
+ * and converted with one operation, other numbers are parsed with strtof,
+ * numbers bigger than range of float are error
+ *
+ * @param reader
+ * @param num
+ * @return float
+ */
+static float Reflex_Json_toFloat(Reflex_JsonReader* reader, const Reflex_JsonNumber* num) {
+    char text[REFLEX_JSON_NUMBER_TEXT];
+    float value;
+
+#if REFLEX_JSON_FAST_FLOAT
+    if (!num->Many && num->Mantissa <= (1UL << 24) && num->Exponent >= -10 && num->Exponent <= 10) {
+        value = (float) num->Mantissa;
+        value = num->Exponent < 0 ? value / REFLEX_JSON_FLOAT_POW10[-num->Exponent] : value * REFLEX_JSON_FLOAT_POW10[num->Exponent];
+        return num->Sign ? -value : value;
+    }
+#endif
+    if (!Reflex_Json_numberText(reader, num, text)) {
+        return 0;
+    }
+    value = strtof(text, NULL);
+    if (value > FLT_MAX || value < -FLT_MAX) {
+        reader->Error = 1;
+    }
+
+    return value;
+}
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+/**
+ * @brief This function convert number to double, small numbers are exact in double
+ * and converted with one operation, other numbers are parsed with strtod,
+ * numbers bigger than range of double are error
+ *
+ * @param reader
+ * @param num
+ * @return double
+ */
+static double Reflex_Json_toDouble(Reflex_JsonReader* reader, const Reflex_JsonNumber* num) {
+    char text[REFLEX_JSON_NUMBER_TEXT];
+    double value;
+
+#if REFLEX_JSON_FAST_FLOAT
+    if (!num->Many && num->Mantissa <= (1ULL << 53) && num->Exponent >= -22 && num->Exponent <= 22) {
+        value = (double) num->Mantissa;
+        value = num->Exponent < 0 ? value / REFLEX_JSON_DOUBLE_POW10[-num->Exponent] : value * REFLEX_JSON_DOUBLE_POW10[num->Exponent];
+        return num->Sign ? -value : value;
+    }
+#endif
+    if (!Reflex_Json_numberText(reader, num, text)) {
+        return 0;
+    }
+    value = strtod(text, NULL);
+    if (value > DBL_MAX || value < -DBL_MAX) {
+        reader->Error = 1;
+    }
+
+    return value;
+}
+#endif // REFLEX_SUPPORT_TYPE_DOUBLE
+/**
+ * @brief This function skip a value without store it, strings are checked and brackets
+ * of objects and arrays are counted, other parts of skipped objects and arrays are not checked
+ *
+ * @param reader
+ */
+static void Reflex_Json_skip(Reflex_JsonReader* reader) {
+    const char* text = reader->Text;
+    Reflex_LenType depth = 0;
+    Reflex_PtrType start;
+    char c;
+
+    Reflex_Json_space(reader);
+    c = __peek(reader);
+    if (c == '"') {
+        Reflex_Json_readString(reader, NULL, 0);
+        return;
+    }
+    else if (c != '{' && c != '[') {
+        // number or literal
+        start = reader->Pos;
+        while (reader->Pos < reader->TextLen && (__isDigit(text[reader->Pos]) ||
+            ((text[reader->Pos] | 0x20) >= 'a' && (text[reader->Pos] | 0x20) <= 'z') ||
+            text[reader->Pos] == '-' || text[reader->Pos] == '+' || text[reader->Pos] == '.')
+        ) {
+            reader->Pos++;
+        }
+        reader->Error |= reader->Pos == start;
+        return;
+    }
+    do {
+        reader->Pos = Reflex_Json_scanStruct(text, reader->Pos, reader->TextLen);
+        c = __peek(reader);
+        if (c == '"') {
+            Reflex_Json_readString(reader, NULL, 0);
+        }
+        else if (c == '{' || c == '[') {
+            depth++;
+            reader->Pos++;
+        }
+        else if (c == '}' || c == ']') {
+            depth--;
+            reader->Pos++;
+        }
+        else {
+            reader->Error = 1;
+        }
+    } while (depth > 0 && !reader->Error);
+}
+/**
+ * @brief This function find end of a run of string, it's a quote, backslash or control character
+ *
+ * @param text
+ * @param pos start of run
+ * @param len length of text
+ * @return Reflex_PtrType position of end of run, len if it's not found
+ */
+static Reflex_PtrType Reflex_Json_scanString(const char* text, Reflex_PtrType pos, Reflex_PtrType len) {
+#if REFLEX_JSON_SIMD
+    uint64_t mask;
+
+    for (; pos + REFLEX_SIMD_VECTOR_SIZE <= len; pos += REFLEX_SIMD_VECTOR_SIZE) {
+        mask = __stringMask(text + pos);
+        if (mask != 0) {
+            return pos + __firstByte(mask);
+        }
+    }
+#endif
+    while (pos < len && text[pos] != '"' && text[pos] != '\\' && (uint8_t) text[pos] >= 0x20) {
+        pos++;
+    }
+
+    return pos;
+}
+/**
+ * @brief This function find next quote or bracket
+ *
+ * @param text
+ * @param pos
+ * @param len length of text
+ * @return Reflex_PtrType position of quote or bracket, len if it's not found
+ */
+static Reflex_PtrType Reflex_Json_scanStruct(const char* text, Reflex_PtrType pos, Reflex_PtrType len) {
+#if REFLEX_JSON_SIMD
+    uint64_t mask;
+
+    for (; pos + REFLEX_SIMD_VECTOR_SIZE <= len; pos += REFLEX_SIMD_VECTOR_SIZE) {
+        mask = __structMask(text + pos);
+        if (mask != 0) {
+            return pos + __firstByte(mask);
+        }
+    }
+#endif
+    while (pos < len && text[pos] != '"' && (text[pos] | 0x20) != '{' && (text[pos] | 0x20) != '}') {
+        pos++;
+    }
+
+    return pos;
+}
+#endif // REFLEX_SUPPORT_PLAN
+
+#endif // REFLEX_SUPPORT_JSON
@@ -0,0 +1,147 @@
+/**
+ * @file ReflexJson.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief JSON encoder of Reflex, it's a set of Compact functions that write fields into a JSON text
+ *        without snprintf, integers are formatted with a table of digit pairs and float and double
+ *        are formatted with shortest digits that read back to same value (Ryu algorithm)
+ *        Objects of schemas with Reflex_JsonParams formats (made by REFLEX_JSON_PARAMS) are written as JSON objects
+ *        with names of fields, other schemas are written as JSON arrays of fields
+ *        Arrays are JSON arrays, 2D arrays are arrays of rows and char arrays are escaped strings
+ *        Note: writer never write after end of buffer, it only count bytes that needed
+ *        Reader parse JSON text in one pass and write values directly into fields with a compiled plan,
+ *        keys are found with a hash table of names of each object, unknown keys are skipped
+ *
+ * @version 0.1
+ * @date 2023-04-08
+ *
+ * @copyright Copyright (c) 2023
+ */
+#ifndef _REFLEX_JSON_H_
+#define _REFLEX_JSON_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Reflex.h"
+
+#if REFLEX_SUPPORT_JSON && REFLEX_SUPPORT_COMPACT && REFLEX_SUPPORT_BUFFER
+
+/**
+ * @brief Maximum number of bytes of a formatted number, ex: -1.2345678901234567e-308
+ */
+#define REFLEX_JSON_NUMBER_LEN              25
+
+#if REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+/**
+ * @brief Marker of named formats, Marker of Reflex_JsonParams is address of it,
+ * so other custom type params with same size are not taken as named formats
+ */
+extern const uint8_t REFLEX_JSON_NAMED;
+/**
+ * @brief This object hold format of a field with it's name, schemas of these formats are written as JSON objects
+ */
+typedef struct {
+    Reflex_TypeParams                   Params;
+    const char*                         Name;                           /**< name of field, it's not escaped */
+    const uint8_t*                      Marker;                         /**< address of REFLEX_JSON_NAMED */
+} Reflex_JsonParams;
+/**
+ * @brief This macro help you to fill Reflex_JsonParams, parameters are same as REFLEX_TYPE_PARAMS
+ *
+ * @param NAME name of field
+ */
+#define REFLEX_JSON_PARAMS(NAME, ...)       { .Params = REFLEX_TYPE_PARAMS(__VA_ARGS__), .Name = (NAME), .Marker = &REFLEX_JSON_NAMED, }
+#endif // REFLEX_SUPPORT_CUSTOM_TYPE_PARAMS
+/**
+ * @brief This object hold state of a complex field or main object in writer
+ */
+typedef struct {
+    const Reflex_TypeParams*            Complex;                        /**< format of complex field, NULL for main object */
+    Reflex_LenType                      Index;                          /**< number of opened elements */
+    Reflex_LenType                      Remaining;                      /**< number of fields of current element that not written */
+    uint8_t                             Named;                          /**< current element is a JSON object */
+} Reflex_JsonFrame;
+/**
+ * @brief This object hold state of JSON writer, it must be buffer of reflex
+ */
+typedef struct {
+    char*                               Buf;
+    Reflex_PtrType                      Size;                           /**< size of buffer */
+    Reflex_PtrType                      Len;                            /**< number of bytes that needed, it can be more than size */
+    Reflex_LenType                      Depth;                          /**< depth of current complex field, 0 for main object */
+    uint8_t                             Error;                          /**< nested complex fields are deeper than REFLEX_MAX_DEPTH */
+    Reflex_JsonFrame                    Frames[REFLEX_MAX_DEPTH + 1];
+} Reflex_JsonWriter;
+#if REFLEX_SUPPORT_PLAN
+/**
+ * @brief Maximum length of keys that have escape sequences, longer escaped keys are unknown keys
+ */
+#ifndef REFLEX_JSON_KEY_LEN
+    #define REFLEX_JSON_KEY_LEN             64
+#endif
+/**
+ * @brief Maximum length of numbers that are not exact in fast path and parsed with strtod, longer numbers are error
+ */
+#ifndef REFLEX_JSON_NUMBER_TEXT
+    #define REFLEX_JSON_NUMBER_TEXT         64
+#endif
+/**
+ * @brief This object hold a named field of plan in hash table of reader
+ */
+typedef struct {
+    uint32_t                            Hash;                           /**< hash of name and scope */
+    Reflex_LenType                      Scope;                          /**< index of first op of object that own field */
+    Reflex_LenType                      Op;                             /**< index of Field or Begin op */
+    Reflex_LenType                      Head;                           /**< first key of hash bucket, -1 for empty bucket */
+    Reflex_LenType                      Next;                           /**< next key in hash bucket */
+} Reflex_JsonKey;
+/**
+ * @brief This object hold bound plan and state of JSON reader
+ */
+typedef struct {
+    const Reflex_PlanOp*                Plan;
+    Reflex_JsonKey*                     Keys;
+    Reflex_LenType                      Size;                           /**< size of keys array, it's number of hash buckets */
+    Reflex_LenType                      Len;                            /**< number of keys */
+    const char*                         Text;
+    Reflex_PtrType                      TextLen;
+    Reflex_PtrType                      Pos;                            /**< position of reader in text, it's position of error if decode failed */
+    uint8_t                             Named;                          /**< main object is a JSON object */
+    uint8_t                             Error;
+} Reflex_JsonReader;
+#endif // REFLEX_SUPPORT_PLAN
+
+/**
+ * @brief Compact functions of JSON encoder, all categories are handled by them
+ */
+extern const Reflex_ScanFunctions REFLEX_JSON_COMPACT;
+#if REFLEX_SUPPORT_DRIVER
+/**
+ * @brief Driver of JSON encoder, it's same as compact functions and it can be base of custom drivers
+ */
+extern const Reflex_ScanDriver REFLEX_JSON_DRIVER;
+#endif
+
+/* ------------------------------------ JSON API ---------------------------------- */
+void           Reflex_Json_begin(Reflex_JsonWriter* writer, void* out, Reflex_PtrType size);
+Reflex_PtrType Reflex_Json_end(Reflex_JsonWriter* writer);
+Reflex_PtrType Reflex_Json_encode(Reflex* reflex, void* obj, void* out, Reflex_PtrType size);
+Reflex_LenType Reflex_Json_formatInt(char* out, int64_t value);
+Reflex_LenType Reflex_Json_formatUInt(char* out, uint64_t value);
+Reflex_LenType Reflex_Json_formatFloat(char* out, float value);
+#if REFLEX_SUPPORT_TYPE_DOUBLE
+Reflex_LenType Reflex_Json_formatDouble(char* out, double value);
+#endif
+#if REFLEX_SUPPORT_PLAN
+Reflex_LenType Reflex_Json_bind(Reflex_JsonReader* reader, const Reflex_Schema* schema, const Reflex_PlanOp* plan, Reflex_JsonKey* keys, Reflex_LenType size);
+Reflex_Result  Reflex_Json_decode(Reflex_JsonReader* reader, void* obj, const void* text, Reflex_PtrType len);
+#endif
+
+#endif // REFLEX_SUPPORT_JSON
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _REFLEX_JSON_H_
@@ -0,0 +1,270 @@
+#include "ReflexPacker.h"
+
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_ARGS && REFLEX_SUPPORT_SIZE_FN
+
+#include <string.h>
+
+#include "ReflexSimd.h"
+
+/* ------------------------------------------ Private Macro ----------------------------------- */
+#define __copyVector(V)                     (V)
+
+/**
+ * @brief This macro define copy function of a run with vector instructions,
+ * run is copied in vectors and last vector overlap previous one,
+ * it's aligned to items because len and vector size are multiple of item size
+ */
+#define __packVectorFn(NAME, OP)            static void NAME(uint8_t* dst, const uint8_t* src, Reflex_LenType len, Reflex_LenType count, Reflex_LenType record, Reflex_LenType stride) { \
+                                                Reflex_LenType index; \
+                                                while (count-- > 0) { \
+                                                    for (index = 0; index + REFLEX_SIMD_VECTOR_SIZE <= len; index += REFLEX_SIMD_VECTOR_SIZE) { \
+                                                        __storeVector(dst + index, OP(__loadVector(src + index))); \
+                                                    } \
+                                                    if (index < len) { \
+                                                        __storeVector(dst + len - REFLEX_SIMD_VECTOR_SIZE, OP(__loadVector(src + len - REFLEX_SIMD_VECTOR_SIZE))); \
+                                                    } \
+                                                    dst += record; \
+                                                    src += stride; \
+                                                } \
+                                            }
+/**
+ * @brief This macro define copy function of a run that swap items in scalar code
+ */
+#define __packSwapFn(NAME, TYPE, SWAP)      static void NAME(uint8_t* dst, const uint8_t* src, Reflex_LenType len, Reflex_LenType count, Reflex_LenType record, Reflex_LenType stride) { \
+                                                TYPE value; \
+                                                Reflex_LenType index; \
+                                                while (count-- > 0) { \
+                                                    for (index = 0; index < len; index += sizeof(TYPE)) { \
+                                                        memcpy(&value, src + index, sizeof(TYPE)); \
+                                                        value = SWAP(value); \
+                                                        memcpy(dst + index, &value, sizeof(TYPE)); \
+                                                    } \
+                                                    dst += record; \
+                                                    src += stride; \
+                                                } \
+                                            }
+/**
+ * @brief This macro define copy function of a run with fixed length
+ */
+#define __packFixedFn(NAME, LEN)            static void NAME(uint8_t* dst, const uint8_t* src, Reflex_LenType len, Reflex_LenType count, Reflex_LenType record, Reflex_LenType stride) { \
+                                                (void) len; \
+                                                while (count-- > 0) { \
+                                                    memcpy(dst, src, LEN); \
+                                                    dst += record; \
+                                                    src += stride; \
+                                                } \
+                                            }
+
+/* ------------------------------------ Private Functions ---------------------------------- */
+static Reflex_Result     Reflex_Packer_bindField(Reflex* reflex, void* value, const void* fmt);
+static Reflex_PackCopyFn Reflex_Packer_selectCopy(const Reflex_PackRun* run);
+
+__packFixedFn(Reflex_Pack_copy1, 1)
+__packFixedFn(Reflex_Pack_copy2, 2)
+__packFixedFn(Reflex_Pack_copy4, 4)
+__packFixedFn(Reflex_Pack_copy8, 8)
+__packFixedFn(Reflex_Pack_copyBytes, len)
+__packSwapFn(Reflex_Pack_swap16, uint16_t, __swap16)
+__packSwapFn(Reflex_Pack_swap32, uint32_t, __swap32)
+__packSwapFn(Reflex_Pack_swap64, uint64_t, __swap64)
+#if REFLEX_SIMD_VECTOR_SIZE
+__packVectorFn(Reflex_Pack_copyVector, __copyVector)
+__packVectorFn(Reflex_Pack_swapVector16, __swapVector16)
+__packVectorFn(Reflex_Pack_swapVector32, __swapVector32)
+__packVectorFn(Reflex_Pack_swapVector64, __swapVector64)
+#endif
+
+/* ------------------------------------ Packer API ---------------------------------- */
+/**
+ * @brief This function bind packer to a flat schema, fields are placed in object
+ * with same rules of scan and continuous fields are merged into one run,
+ * copy function of each run is selected once here
+ *
+ * @param packer
+ * @param schema flat schema, only primary, array and 2D array fields
+ * @param runs array of runs, one run per field is enough
+ * @param size size of runs array
+ * @param swap 1 for reverse bytes of items, ex: convert little endian to big endian
+ * @return Reflex_Result REFLEX_OK, REFLEX_ERROR if schema is not flat or runs array is small
+ */
+Reflex_Result Reflex_Packer_bind(Reflex_Packer* packer, const Reflex_Schema* schema, Reflex_PackRun* runs, Reflex_LenType size, uint8_t swap) {
+    Reflex reflex = {0};
+    Reflex_Result result;
+    Reflex_LenType index;
+
+    packer->Runs = runs;
+    packer->Size = size;
+    packer->Len = 0;
+    packer->RecordSize = 0;
+    packer->Swap = swap;
+    // schemas with complex fields have no size
+    packer->Stride = Reflex_size(schema, Reflex_SizeType_Normal);
+    if (packer->Stride < 0) {
+        return REFLEX_ERROR;
+    }
+    // scan object at address 0, address of each field is offset of it
+    Reflex_init(&reflex, schema);
+    Reflex_setCallback(&reflex, Reflex_Packer_bindField);
+    Reflex_setArgs(&reflex, packer);
+    result = Reflex_scan(&reflex, NULL);
+    if (result != REFLEX_OK) {
+        packer->Len = 0;
+        return result;
+    }
+
+    for (index = 0; index < packer->Len; index++) {
+        runs[index].copy = Reflex_Packer_selectCopy(&runs[index]);
+    }
+
+    return REFLEX_OK;
+}
+/**
+ * @brief This function encode array of objects into packed records,
+ * objects are encoded in blocks of REFLEX_PACKER_BLOCK objects and each run is
+ * copied for all objects of block before next run
+ *
+ * @param packer bound packer
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means size of object
+ * @param out output buffer, it must have count * record size bytes
+ * @return Reflex_PtrType number of written bytes
+ */
+Reflex_PtrType Reflex_Packer_encode(const Reflex_Packer* packer, const void* base, Reflex_LenType count, Reflex_LenType stride, void* out) {
+    const Reflex_PackRun* runs = packer->Runs;
+    const Reflex_PackRun* end = runs + packer->Len;
+    const Reflex_PackRun* run;
+    const uint8_t* src = (const uint8_t*) base;
+    uint8_t* dst = (uint8_t*) out;
+    Reflex_LenType block;
+
+    if (count <= 0) {
+        return 0;
+    }
+    if (stride == 0) {
+        stride = packer->Stride;
+    }
+    // object has no padding, records are same as objects
+    if (packer->Len == 1 && runs->ItemSize == 1 && runs->Len == stride) {
+        memcpy(dst, src, (size_t) count * (size_t) stride);
+        return (Reflex_PtrType) count * (Reflex_PtrType) stride;
+    }
+
+    while (count > 0) {
+        block = count < REFLEX_PACKER_BLOCK ? count : REFLEX_PACKER_BLOCK;
+        for (run = runs; run < end; run++) {
+            run->copy(dst + run->Dst, src + run->Src, run->Len, block, packer->RecordSize, stride);
+        }
+        src += (Reflex_PtrType) block * (Reflex_PtrType) stride;
+        dst += (Reflex_PtrType) block * (Reflex_PtrType) packer->RecordSize;
+        count -= block;
+    }
+
+    return (Reflex_PtrType) (dst - (uint8_t*) out);
+}
+/**
+ * @brief This function return size of packed record
+ *
+ * @param packer
+ * @return Reflex_LenType
+ */
+Reflex_LenType Reflex_Packer_recordSize(const Reflex_Packer* packer) {
+    return packer->RecordSize;
+}
+/* ---------------------- Private Functions (Implementation) ----------------------- */
+/**
+ * @brief This callback add field to runs of packer
+ *
+ * @param reflex
+ * @param value offset of field
+ * @param fmt
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Packer_bindField(Reflex* reflex, void* value, const void* fmt) {
+    Reflex_Packer* packer = (Reflex_Packer*) reflex->Args;
+    Reflex_TypeParams item = *(const Reflex_TypeParams*) fmt;
+    Reflex_LenType offset = (Reflex_LenType) (Reflex_PtrType) value;
+    Reflex_LenType len = Reflex_sizeType(&item);
+    Reflex_PackRun* run = packer->Len > 0 ? &packer->Runs[packer->Len - 1] : NULL;
+    uint8_t itemSize = 1;
+
+    switch (item.Fields.Category) {
+        case Reflex_Category_Primary:
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+    #endif
+            break;
+        default:
+            return REFLEX_ERROR;
+    }
+    if (packer->Swap) {
+        item.Fields.Category = Reflex_Category_Primary;
+        itemSize = (uint8_t) Reflex_sizeType(&item);
+    }
+    // merge with previous run if it's continuous in object
+    if (run != NULL && run->Src + run->Len == offset && run->ItemSize == itemSize) {
+        run->Len += len;
+    }
+    else {
+        if (packer->Len >= packer->Size) {
+            return REFLEX_ERROR;
+        }
+        run = &packer->Runs[packer->Len++];
+        run->Src = offset;
+        run->Dst = packer->RecordSize;
+        run->Len = len;
+        run->ItemSize = itemSize;
+    }
+    packer->RecordSize += len;
+
+    return REFLEX_OK;
+}
+/**
+ * @brief This function select copy function of run based on length and item size
+ *
+ * @param run
+ * @return Reflex_PackCopyFn
+ */
+static Reflex_PackCopyFn Reflex_Packer_selectCopy(const Reflex_PackRun* run) {
+#if REFLEX_SIMD_VECTOR_SIZE
+    if (run->Len >= REFLEX_SIMD_VECTOR_SIZE) {
+        switch (run->ItemSize) {
+            case 2:
+                return Reflex_Pack_swapVector16;
+            case 4:
+                return Reflex_Pack_swapVector32;
+            case 8:
+                return Reflex_Pack_swapVector64;
+            default:
+                return Reflex_Pack_copyVector;
+        }
+    }
+#endif
+    switch (run->ItemSize) {
+        case 2:
+            return Reflex_Pack_swap16;
+        case 4:
+            return Reflex_Pack_swap32;
+        case 8:
+            return Reflex_Pack_swap64;
+        default:
+            break;
+    }
+    switch (run->Len) {
+        case 1:
+            return Reflex_Pack_copy1;
+        case 2:
+            return Reflex_Pack_copy2;
+        case 4:
+            return Reflex_Pack_copy4;
+        case 8:
+            return Reflex_Pack_copy8;
+        default:
+            return Reflex_Pack_copyBytes;
+    }
+}
+
+#endif // REFLEX_SUPPORT_PACKER
@@ -0,0 +1,71 @@
+/**
+ * @file ReflexPacker.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Packer encode many objects of a flat schema into padding free records,
+ *        flat schema is made only of primary, array and 2D array fields without pointers and complex fields,
+ *        packer is bound once to schema and fields are merged into runs of continuous bytes,
+ *        then objects are encoded in blocks of REFLEX_PACKER_BLOCK objects with SIMD copy and byte swap
+ *        Note: records of packer are same as Reflex_Packed_encode when byte swap is off
+ *
+ * @version 0.1
+ * @date 2023-04-08
+ *
+ * @copyright Copyright (c) 2023
+ */
+#ifndef _REFLEX_PACKER_H_
+#define _REFLEX_PACKER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Reflex.h"
+
+#if REFLEX_SUPPORT_PACKER && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_ARGS && REFLEX_SUPPORT_SIZE_FN
+
+/**
+ * @brief This function copy bytes of a run for a block of objects,
+ * it's selected at bind time based on length and item size of run
+ *
+ * @param dst address of run in first record
+ * @param src address of run in first object
+ * @param len number of bytes, it's multiple of item size
+ * @param count number of objects
+ * @param record size of record
+ * @param stride distance between objects
+ */
+typedef void (*Reflex_PackCopyFn)(uint8_t* dst, const uint8_t* src, Reflex_LenType len, Reflex_LenType count, Reflex_LenType record, Reflex_LenType stride);
+/**
+ * @brief This object hold continuous bytes of one or more fields
+ */
+typedef struct {
+    Reflex_PackCopyFn                   copy;                           /**< copy function of run */
+    Reflex_LenType                      Src;                            /**< offset of run in object */
+    Reflex_LenType                      Dst;                            /**< offset of run in record */
+    Reflex_LenType                      Len;                            /**< number of bytes */
+    uint8_t                             ItemSize;                       /**< size of items for byte swap, 1 means no swap */
+} Reflex_PackRun;
+/**
+ * @brief This object hold bound packer of a schema
+ */
+typedef struct {
+    Reflex_PackRun*                     Runs;
+    Reflex_LenType                      Size;                           /**< size of runs array */
+    Reflex_LenType                      Len;                            /**< number of used runs */
+    Reflex_LenType                      Stride;                         /**< size of object with paddings */
+    Reflex_LenType                      RecordSize;                     /**< size of packed record */
+    uint8_t                             Swap;                           /**< reverse bytes of items */
+} Reflex_Packer;
+
+/* ------------------------------------ Packer API ---------------------------------- */
+Reflex_Result  Reflex_Packer_bind(Reflex_Packer* packer, const Reflex_Schema* schema, Reflex_PackRun* runs, Reflex_LenType size, uint8_t swap);
+Reflex_PtrType Reflex_Packer_encode(const Reflex_Packer* packer, const void* base, Reflex_LenType count, Reflex_LenType stride, void* out);
+Reflex_LenType Reflex_Packer_recordSize(const Reflex_Packer* packer);
+
+#endif // REFLEX_SUPPORT_PACKER
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _REFLEX_PACKER_H_
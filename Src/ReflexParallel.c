@@ -0,0 +1,529 @@
+#include "ReflexParallel.h"
+
+#if REFLEX_SUPPORT_PARALLEL && REFLEX_SUPPORT_CONFIG
+
+#include <pthread.h>
+
+/* ------------------------------------ Private typedef ----------------------------------- */
+struct __Reflex_ParallelJob;
+typedef struct __Reflex_ParallelJob Reflex_ParallelJob;
+/**
+ * @brief This function process one element of array in a worker
+ */
+typedef Reflex_Result (*Reflex_ParallelElementFn)(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj);
+/**
+ * @brief This struct hold chunks of a worker, owner take chunks from Next
+ * and thieves take half of remaining chunks from End
+ */
+typedef struct {
+    pthread_mutex_t             Lock;
+    Reflex_LenType              Next;                           /**< first chunk that is not taken */
+    Reflex_LenType              End;                            /**< end of chunks of worker */
+} Reflex_ParallelQueue;
+/**
+ * @brief This struct hold shared state of a parallel scan
+ */
+struct __Reflex_ParallelJob {
+    const Reflex_Config*        Config;
+    uint8_t*                    Base;
+    Reflex_ParallelElementFn    Element;                        /**< process each element */
+    Reflex_OnFieldFn            onField;
+    const Reflex_Encoder*       Encoder;
+    uint8_t*                    Out;                            /**< output buffer of encode */
+    Reflex_PtrType*             Offsets;                        /**< offset of each object in output, sizes in sizing phase */
+    Reflex_Result*              Results;                        /**< result of each chunk, each one is written by one worker */
+    Reflex_ParallelQueue*       Queues;
+    pthread_mutex_t             Lock;
+    Reflex_LenType              Count;
+    Reflex_LenType              Stride;
+    Reflex_LenType              ChunkSize;
+    Reflex_LenType              Workers;
+    Reflex_LenType              Failed;                         /**< first chunk with error, chunks after it are skipped */
+    uint8_t                     Raw;                            /**< use onField instead of callback of FunctionMode */
+    uint8_t                     Cancel;                         /**< skip chunks after first error */
+};
+/**
+ * @brief This struct hold a worker thread
+ */
+typedef struct {
+    Reflex_ParallelJob*         Job;
+    Reflex_LenType              Index;
+    pthread_t                   Thread;
+} Reflex_ParallelWorker;
+
+/* ------------------------------------ Private Functions ---------------------------------- */
+static Reflex_Result  Reflex_Parallel_run(Reflex_ParallelJob* job, const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, const Reflex_ParallelParams* params);
+static Reflex_Result  Reflex_Parallel_runScan(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnFieldFn onField, uint8_t raw, const Reflex_ParallelParams* params);
+#if REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D)
+static Reflex_Result  Reflex_Parallel_runField(const Reflex_Config* config, void* obj, const Reflex_TypeParams* fmt, Reflex_LenType stride, Reflex_OnFieldFn onField, uint8_t raw, const Reflex_ParallelParams* params);
+#endif
+static void*          Reflex_Parallel_worker(void* arg);
+static Reflex_LenType Reflex_Parallel_take(Reflex_ParallelJob* job, Reflex_LenType index);
+static Reflex_Result  Reflex_Parallel_runChunk(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType chunk);
+static Reflex_Result  Reflex_Parallel_scanElement(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj);
+static Reflex_Result  Reflex_Parallel_sizeElement(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj);
+static Reflex_Result  Reflex_Parallel_encodeElement(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj);
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+static Reflex_LenType Reflex_Parallel_packedSize(Reflex* reflex, void* obj);
+static Reflex_LenType Reflex_Parallel_packedEncode(Reflex* reflex, void* obj, uint8_t* buf);
+#endif
+
+/* ------------------------------------ Parallel Scan API ---------------------------------- */
+/**
+ * @brief This function scan over array of objects with same schema on many workers
+ * and run custom function, in callbacks MainObject is current object
+ * and Reflex_getElementIndex return index of it
+ *
+ * @param config shared config, it's not changed by scan
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means Reflex_size of schema without complex fields
+ * @param onField thread safe callback
+ * @param params parameters of parallel scan, NULL means defaults
+ * @return Reflex_Result combined result of chunks
+ */
+Reflex_Result Reflex_Parallel_scanArrayRaw(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnFieldFn onField, const Reflex_ParallelParams* params) {
+    return Reflex_Parallel_runScan(config, base, count, stride, onField, 1, params);
+}
+/**
+ * @brief This function scan over array of objects with same schema on many workers
+ *
+ * @param config shared config, it's not changed by scan
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means Reflex_size of schema without complex fields
+ * @param params parameters of parallel scan, NULL means defaults
+ * @return Reflex_Result combined result of chunks
+ */
+Reflex_Result Reflex_Parallel_scanArray(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, const Reflex_ParallelParams* params) {
+    return Reflex_Parallel_runScan(config, base, count, stride, NULL, 0, params);
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D)
+/**
+ * @brief This function scan over elements of a complex array or complex 2D array field on many workers
+ * and run custom function, each element is scanned as an object of schema of field,
+ * begin and end callbacks of field itself are not called
+ *
+ * @param config shared config, schema of it is replaced with schema of field
+ * @param obj address of field
+ * @param fmt format of field
+ * @param stride distance between elements, 0 means Reflex_size of schema without complex fields
+ * @param onField thread safe callback
+ * @param params parameters of parallel scan, NULL means defaults
+ * @return Reflex_Result combined result of chunks, REFLEX_ERROR if field is not a complex array
+ */
+Reflex_Result Reflex_Parallel_scanFieldRaw(const Reflex_Config* config, void* obj, const Reflex_TypeParams* fmt, Reflex_LenType stride, Reflex_OnFieldFn onField, const Reflex_ParallelParams* params) {
+    return Reflex_Parallel_runField(config, obj, fmt, stride, onField, 1, params);
+}
+/**
+ * @brief This function scan over elements of a complex array or complex 2D array field on many workers
+ *
+ * @param config shared config, schema of it is replaced with schema of field
+ * @param obj address of field
+ * @param fmt format of field
+ * @param stride distance between elements, 0 means Reflex_size of schema without complex fields
+ * @param params parameters of parallel scan, NULL means defaults
+ * @return Reflex_Result combined result of chunks, REFLEX_ERROR if field is not a complex array
+ */
+Reflex_Result Reflex_Parallel_scanField(const Reflex_Config* config, void* obj, const Reflex_TypeParams* fmt, Reflex_LenType stride, const Reflex_ParallelParams* params) {
+    return Reflex_Parallel_runField(config, obj, fmt, stride, NULL, 0, params);
+}
+#endif
+/* ------------------------------------ Parallel Encode API ---------------------------------- */
+/**
+ * @brief This function encode array of objects into one output buffer on many workers in two phases,
+ * first phase find encoded size of each object, for fixed size schemas it's Reflex_size with
+ * Reflex_SizeType_Packed, else sizing callback run for each object on workers,
+ * prefix sum of sizes give final offset of each object and in second phase
+ * workers encode objects directly into their final offsets without copy or lock,
+ * so output is byte identical to encode objects one by one in order
+ *
+ * @param config shared config, it's not changed by encode
+ * @param base address of first object
+ * @param count number of objects
+ * @param stride distance between objects, 0 means Reflex_size of schema without complex fields
+ * @param encoder thread safe sizing and encode callbacks, NULL means packed encoding
+ * @param out output buffer
+ * @param size size of output buffer
+ * @param offsets array of count + 1 items, offsets[i] is offset of object i and offsets[count] is total size
+ * @param params parameters of parallel scan, NULL means defaults
+ * @return Reflex_Result REFLEX_OK, REFLEX_ERROR if output buffer is small or sizing and encode not match
+ */
+Reflex_Result Reflex_Parallel_encode(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, const Reflex_Encoder* encoder,
+                                     void* out, Reflex_PtrType size, Reflex_PtrType* offsets, const Reflex_ParallelParams* params) {
+    Reflex_ParallelJob job;
+    Reflex_Encoder callbacks = {0};
+    Reflex_Result result;
+    Reflex_PtrType objSize;
+    Reflex_LenType fixed = -1;
+    Reflex_LenType index;
+
+    if (encoder != NULL) {
+        callbacks = *encoder;
+    }
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+    if (callbacks.sizeOf == NULL) {
+        callbacks.sizeOf = Reflex_Parallel_packedSize;
+        fixed = Reflex_size(config->Schema, Reflex_SizeType_Packed);
+    }
+    if (callbacks.encode == NULL) {
+        callbacks.encode = Reflex_Parallel_packedEncode;
+    }
+#endif
+    if (callbacks.sizeOf == NULL || callbacks.encode == NULL) {
+        return REFLEX_ERROR;
+    }
+
+    job.Encoder = &callbacks;
+    job.Out = (uint8_t*) out;
+    job.Offsets = offsets;
+    // sizing phase, size of object i is stored in offsets[i + 1]
+    if (fixed < 0) {
+        job.Element = Reflex_Parallel_sizeElement;
+        result = Reflex_Parallel_run(&job, config, base, count, stride, params);
+        if (result != REFLEX_OK) {
+            return result;
+        }
+    }
+    // prefix sum of sizes
+    offsets[0] = 0;
+    for (index = 0; index < count; index++) {
+        objSize = fixed >= 0 ? (Reflex_PtrType) fixed : offsets[index + 1];
+        if (objSize > size - offsets[index]) {
+            return REFLEX_ERROR;
+        }
+        offsets[index + 1] = offsets[index] + objSize;
+    }
+    // encode phase
+    job.Element = Reflex_Parallel_encodeElement;
+    return Reflex_Parallel_run(&job, config, base, count, stride, params);
+}
+/* ---------------------- Private Functions (Implementation) ----------------------- */
+/**
+ * @brief This function run parallel scan over array of objects
+ *
+ * @param config
+ * @param base
+ * @param count
+ * @param stride
+ * @param onField
+ * @param raw 1 for use onField, 0 for use callback of FunctionMode
+ * @param params
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Parallel_runScan(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnFieldFn onField, uint8_t raw, const Reflex_ParallelParams* params) {
+    Reflex_ParallelJob job;
+
+    job.Element = Reflex_Parallel_scanElement;
+    job.onField = onField;
+    job.Raw = raw;
+
+    return Reflex_Parallel_run(&job, config, base, count, stride, params);
+}
+#if REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D)
+/**
+ * @brief This function run parallel scan over elements of complex array field with schema of field
+ *
+ * @param config
+ * @param obj
+ * @param fmt
+ * @param stride
+ * @param onField
+ * @param raw 1 for use onField, 0 for use callback of FunctionMode
+ * @param params
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Parallel_runField(const Reflex_Config* config, void* obj, const Reflex_TypeParams* fmt, Reflex_LenType stride, Reflex_OnFieldFn onField, uint8_t raw, const Reflex_ParallelParams* params) {
+    Reflex_Config fieldConfig = *config;
+    Reflex_LenType count;
+
+    if (fmt->Fields.Primary != Reflex_PrimaryType_Complex) {
+        return REFLEX_ERROR;
+    }
+    switch (fmt->Fields.Category) {
+    #if REFLEX_SUPPORT_TYPE_ARRAY
+        case Reflex_Category_Array:
+            count = fmt->Len;
+            break;
+    #endif
+    #if REFLEX_SUPPORT_TYPE_ARRAY_2D
+        case Reflex_Category_Array2D:
+            count = fmt->Len * fmt->MLen;
+            break;
+    #endif
+        default:
+            return REFLEX_ERROR;
+    }
+    fieldConfig.Schema = fmt->Schema;
+
+    return Reflex_Parallel_runScan(&fieldConfig, obj, count, stride, onField, raw, params);
+}
+#endif
+/**
+ * @brief This function split array into chunks, run workers and combine results of chunks
+ *
+ * @param job Element and it's parameters must be set
+ * @param config
+ * @param base
+ * @param count
+ * @param stride
+ * @param params
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Parallel_run(Reflex_ParallelJob* job, const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, const Reflex_ParallelParams* params) {
+    Reflex_Result results[REFLEX_PARALLEL_MAX_CHUNKS];
+    Reflex_ParallelQueue queues[REFLEX_PARALLEL_WORKERS];
+    Reflex_ParallelWorker workers[REFLEX_PARALLEL_WORKERS];
+    Reflex_Result result = REFLEX_OK;
+    Reflex_ReduceFn reduce = params != NULL ? params->Reduce : NULL;
+    Reflex_LenType chunks;
+    Reflex_LenType index;
+
+    if (count <= 0) {
+        return REFLEX_OK;
+    }
+#if REFLEX_SUPPORT_SIZE_FN
+    if (stride == 0) {
+        stride = Reflex_size(config->Schema, Reflex_SizeType_Normal);
+    }
+#endif
+    if (stride <= 0) {
+        return REFLEX_ERROR;
+    }
+    // find size of chunks
+    job->ChunkSize = params != NULL && params->ChunkSize > 0 ? params->ChunkSize : REFLEX_PARALLEL_CHUNK_SIZE;
+    if (job->ChunkSize < (count + REFLEX_PARALLEL_MAX_CHUNKS - 1) / REFLEX_PARALLEL_MAX_CHUNKS) {
+        job->ChunkSize = (count + REFLEX_PARALLEL_MAX_CHUNKS - 1) / REFLEX_PARALLEL_MAX_CHUNKS;
+    }
+    chunks = (count + job->ChunkSize - 1) / job->ChunkSize;
+    // find number of workers
+    job->Workers = params != NULL && params->Workers > 0 ? params->Workers : REFLEX_PARALLEL_WORKERS;
+    if (job->Workers > REFLEX_PARALLEL_WORKERS) {
+        job->Workers = REFLEX_PARALLEL_WORKERS;
+    }
+    if (job->Workers > chunks) {
+        job->Workers = chunks;
+    }
+
+    job->Config = config;
+    job->Base = (uint8_t*) base;
+    job->Results = results;
+    job->Queues = queues;
+    job->Count = count;
+    job->Stride = stride;
+    job->Failed = chunks;
+    job->Cancel = reduce == NULL;
+    pthread_mutex_init(&job->Lock, NULL);
+    // give continuous chunks to each worker
+    for (index = 0; index < job->Workers; index++) {
+        pthread_mutex_init(&queues[index].Lock, NULL);
+        queues[index].Next = chunks * index / job->Workers;
+        queues[index].End = chunks * (index + 1) / job->Workers;
+        workers[index].Job = job;
+        workers[index].Index = index;
+    }
+    // caller thread is first worker, if a thread can't start it's chunks are stolen by others
+    for (index = 1; index < job->Workers; index++) {
+        if (pthread_create(&workers[index].Thread, NULL, Reflex_Parallel_worker, &workers[index]) != 0) {
+            workers[index].Job = NULL;
+        }
+    }
+    Reflex_Parallel_worker(&workers[0]);
+    for (index = 1; index < job->Workers; index++) {
+        if (workers[index].Job != NULL) {
+            pthread_join(workers[index].Thread, NULL);
+        }
+    }
+    for (index = 0; index < job->Workers; index++) {
+        pthread_mutex_destroy(&queues[index].Lock);
+    }
+    pthread_mutex_destroy(&job->Lock);
+    // combine results in order of chunks
+    for (index = 0; index < chunks; index++) {
+        if (reduce != NULL) {
+            result = reduce(result, results[index]);
+        }
+        else if (results[index] != REFLEX_OK) {
+            return results[index];
+        }
+    }
+
+    return result;
+}
+/**
+ * @brief This function is main loop of workers, it's scan chunks until no chunk remain
+ *
+ * @param arg address of Reflex_ParallelWorker
+ * @return void*
+ */
+static void* Reflex_Parallel_worker(void* arg) {
+    Reflex_ParallelWorker* worker = (Reflex_ParallelWorker*) arg;
+    Reflex_ParallelJob* job = worker->Job;
+    Reflex reflex;
+    Reflex_LenType chunk;
+    Reflex_LenType failed;
+
+    Reflex_initContext(&reflex, job->Config);
+
+    while ((chunk = Reflex_Parallel_take(job, worker->Index)) >= 0) {
+        pthread_mutex_lock(&job->Lock);
+        failed = job->Failed;
+        pthread_mutex_unlock(&job->Lock);
+        // result of chunks after first error is not used
+        if (job->Cancel && chunk > failed) {
+            job->Results[chunk] = REFLEX_OK;
+            continue;
+        }
+        job->Results[chunk] = Reflex_Parallel_runChunk(job, &reflex, chunk);
+        if (job->Results[chunk] != REFLEX_OK) {
+            pthread_mutex_lock(&job->Lock);
+            if (chunk < job->Failed) {
+                job->Failed = chunk;
+            }
+            pthread_mutex_unlock(&job->Lock);
+        }
+    }
+
+    return NULL;
+}
+/**
+ * @brief This function take next chunk of worker, if worker has no chunk
+ * it's steal half of remaining chunks of another worker
+ *
+ * @param job
+ * @param index index of worker
+ * @return Reflex_LenType index of chunk, -1 if no chunk remain
+ */
+static Reflex_LenType Reflex_Parallel_take(Reflex_ParallelJob* job, Reflex_LenType index) {
+    Reflex_ParallelQueue* queue = &job->Queues[index];
+    Reflex_ParallelQueue* victim;
+    Reflex_LenType chunk = -1;
+    Reflex_LenType steal;
+    Reflex_LenType end;
+    Reflex_LenType offset;
+
+    // take from own chunks
+    pthread_mutex_lock(&queue->Lock);
+    if (queue->Next < queue->End) {
+        chunk = queue->Next++;
+    }
+    pthread_mutex_unlock(&queue->Lock);
+    // steal from others
+    for (offset = 1; chunk < 0 && offset < job->Workers; offset++) {
+        victim = &job->Queues[(index + offset) % job->Workers];
+        pthread_mutex_lock(&victim->Lock);
+        steal = (victim->End - victim->Next + 1) / 2;
+        end = victim->End;
+        victim->End -= steal;
+        pthread_mutex_unlock(&victim->Lock);
+        if (steal > 0) {
+            pthread_mutex_lock(&queue->Lock);
+            queue->Next = end - steal;
+            queue->End = end;
+            chunk = queue->Next++;
+            pthread_mutex_unlock(&queue->Lock);
+        }
+    }
+
+    return chunk;
+}
+/**
+ * @brief This function process objects of a chunk, it's stop on first error
+ *
+ * @param job
+ * @param reflex context of worker
+ * @param chunk
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Parallel_runChunk(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType chunk) {
+    Reflex_Result result = REFLEX_OK;
+    Reflex_LenType index = chunk * job->ChunkSize;
+    Reflex_LenType end = index + job->ChunkSize < job->Count ? index + job->ChunkSize : job->Count;
+    uint8_t* obj = job->Base + (Reflex_PtrType) index * (Reflex_PtrType) job->Stride;
+
+    for (; index < end && result == REFLEX_OK; index++) {
+    #if REFLEX_SUPPORT_SCAN_ARRAY
+        reflex->ElementIndex = index;
+    #endif
+        result = job->Element(job, reflex, index, obj);
+        obj += job->Stride;
+    }
+
+    return result;
+}
+/**
+ * @brief This function scan an object
+ *
+ * @param job
+ * @param reflex context of worker
+ * @param index index of object
+ * @param obj
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Parallel_scanElement(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj) {
+    (void) index;
+
+    return job->Raw ? Reflex_scanRaw(reflex, obj, job->onField) : Reflex_scan(reflex, obj);
+}
+/**
+ * @brief This function find encoded size of an object and store it in offsets[index + 1]
+ *
+ * @param job
+ * @param reflex context of worker
+ * @param index index of object
+ * @param obj
+ * @return Reflex_Result
+ */
+static Reflex_Result Reflex_Parallel_sizeElement(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj) {
+    Reflex_LenType len = job->Encoder->sizeOf(reflex, obj);
+
+    if (len < 0) {
+        return REFLEX_ERROR;
+    }
+    job->Offsets[index + 1] = (Reflex_PtrType) len;
+
+    return REFLEX_OK;
+}
+/**
+ * @brief This function encode an object into it's final offset
+ *
+ * @param job
+ * @param reflex context of worker
+ * @param index index of object
+ * @param obj
+ * @return Reflex_Result REFLEX_ERROR if written bytes not match with size of object
+ */
+static Reflex_Result Reflex_Parallel_encodeElement(Reflex_ParallelJob* job, Reflex* reflex, Reflex_LenType index, uint8_t* obj) {
+    Reflex_LenType len = job->Encoder->encode(reflex, obj, job->Out + job->Offsets[index]);
+
+    if (len < 0 || (Reflex_PtrType) len != job->Offsets[index + 1] - job->Offsets[index]) {
+        return REFLEX_ERROR;
+    }
+
+    return REFLEX_OK;
+}
+#if REFLEX_SUPPORT_PACKED && REFLEX_SUPPORT_SIZE_FN && REFLEX_SUPPORT_CALLBACK && REFLEX_SUPPORT_BUFFER
+/**
+ * @brief Default sizing callback of encode
+ *
+ * @param reflex
+ * @param obj
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Parallel_packedSize(Reflex* reflex, void* obj) {
+    return Reflex_Packed_size(reflex->Schema, obj);
+}
+/**
+ * @brief Default encode callback of encode
+ *
+ * @param reflex
+ * @param obj
+ * @param buf
+ * @return Reflex_LenType
+ */
+static Reflex_LenType Reflex_Parallel_packedEncode(Reflex* reflex, void* obj, uint8_t* buf) {
+    return Reflex_Packed_encode(reflex->Schema, obj, buf);
+}
+#endif
+
+#endif // REFLEX_SUPPORT_PARALLEL
@@ -0,0 +1,88 @@
+/**
+ * @file ReflexParallel.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Parallel scan functions of Reflex, elements of a big array are split into chunks
+ *        and scanned by a small pool of pthread workers with work stealing,
+ *        each worker use it's own Reflex context of a shared Reflex_Config
+ *        Result of chunks are combined in order of chunk index, so result is deterministic
+ *        Note: onField is called from many threads at same time, it must be thread safe,
+ *        fields of one element are always scanned by one worker in normal order
+ *        Reflex_Parallel_encode use same workers for encode objects into one buffer
+ *
+ * @version 0.1
+ * @date 2023-04-08
+ *
+ * @copyright Copyright (c) 2023
+ */
+#ifndef _REFLEX_PARALLEL_H_
+#define _REFLEX_PARALLEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Reflex.h"
+
+#if REFLEX_SUPPORT_PARALLEL && REFLEX_SUPPORT_CONFIG
+
+/**
+ * @brief This callback combine results of chunks, it's called in order of chunk index
+ * after all workers are finished
+ *
+ * @param acc combined result of previous chunks, REFLEX_OK for first chunk
+ * @param result result of current chunk, result of first element with error in chunk
+ * @return Reflex_Result combined result
+ */
+typedef Reflex_Result (*Reflex_ReduceFn)(Reflex_Result acc, Reflex_Result result);
+/**
+ * @brief This object hold parameters of parallel scan, zero initialized params use defaults
+ */
+typedef struct {
+    Reflex_ReduceFn                     Reduce;                         /**< combine results of chunks, NULL means first error in index order and skip rest of chunks */
+    Reflex_LenType                      Workers;                        /**< number of workers include caller thread, 0 means REFLEX_PARALLEL_WORKERS */
+    Reflex_LenType                      ChunkSize;                      /**< number of elements in each chunk, 0 means REFLEX_PARALLEL_CHUNK_SIZE */
+} Reflex_ParallelParams;
+/**
+ * @brief This callback return encoded size of object, it's called from many threads
+ *
+ * @param reflex context of worker
+ * @param obj
+ * @return Reflex_LenType size of encoded object, -1 for error
+ */
+typedef Reflex_LenType (*Reflex_EncodeSizeFn)(Reflex* reflex, void* obj);
+/**
+ * @brief This callback encode object into buffer, it's called from many threads
+ * and must write exactly same number of bytes that sizing callback returned
+ *
+ * @param reflex context of worker
+ * @param obj
+ * @param buf final place of object in output buffer
+ * @return Reflex_LenType number of written bytes, -1 for error
+ */
+typedef Reflex_LenType (*Reflex_EncodeFn)(Reflex* reflex, void* obj, uint8_t* buf);
+/**
+ * @brief This object hold callbacks of parallel encode, NULL callbacks use packed encoding
+ */
+typedef struct {
+    Reflex_EncodeSizeFn                 sizeOf;                         /**< NULL means Reflex_size packed for fixed size schemas, else Reflex_Packed_size */
+    Reflex_EncodeFn                     encode;                         /**< NULL means Reflex_Packed_encode */
+} Reflex_Encoder;
+
+/* ------------------------------------ Parallel Scan API ---------------------------------- */
+Reflex_Result Reflex_Parallel_scanArrayRaw(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, Reflex_OnFieldFn onField, const Reflex_ParallelParams* params);
+Reflex_Result Reflex_Parallel_scanArray(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, const Reflex_ParallelParams* params);
+#if REFLEX_SUPPORT_TYPE_COMPLEX && (REFLEX_SUPPORT_TYPE_ARRAY || REFLEX_SUPPORT_TYPE_ARRAY_2D)
+Reflex_Result Reflex_Parallel_scanFieldRaw(const Reflex_Config* config, void* obj, const Reflex_TypeParams* fmt, Reflex_LenType stride, Reflex_OnFieldFn onField, const Reflex_ParallelParams* params);
+Reflex_Result Reflex_Parallel_scanField(const Reflex_Config* config, void* obj, const Reflex_TypeParams* fmt, Reflex_LenType stride, const Reflex_ParallelParams* params);
+#endif
+/* ------------------------------------ Parallel Encode API ---------------------------------- */
+Reflex_Result Reflex_Parallel_encode(const Reflex_Config* config, void* base, Reflex_LenType count, Reflex_LenType stride, const Reflex_Encoder* encoder,
+                                     void* out, Reflex_PtrType size, Reflex_PtrType* offsets, const Reflex_ParallelParams* params);
+
+#endif // REFLEX_SUPPORT_PARALLEL
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _REFLEX_PARALLEL_H_
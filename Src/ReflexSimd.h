@@ -0,0 +1,102 @@
+/**
+ * @file ReflexSimd.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Private byte swap macros of Reflex, scalar swap of items and vector swap
+ *        of instruction set that selected by REFLEX_PACKER_SIMD,
+ *        it's shared by packer and byte order functions and it's not part of public API
+ *        Byte masks find special bytes of JSON text in a vector, each byte of vector give
+ *        REFLEX_SIMD_MASK_BITS bits in mask
+ *
+ * @version 0.1
+ * @date 2023-04-08
+ *
+ * @copyright Copyright (c) 2023
+ */
+#ifndef _REFLEX_SIMD_H_
+#define _REFLEX_SIMD_H_
+
+#include "Reflex.h"
+
+#if REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_AVX2
+    #include <immintrin.h>
+#elif REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_SSSE3
+    #include <tmmintrin.h>
+#elif REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_SSE2
+    #include <emmintrin.h>
+#elif REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define __swap16(X)                     __builtin_bswap16(X)
+    #define __swap32(X)                     __builtin_bswap32(X)
+    #define __swap64(X)                     __builtin_bswap64(X)
+#else
+    #define __swap16(X)                     ((uint16_t) (((X) >> 8) | ((X) << 8)))
+    #define __swap32(X)                     ((((uint32_t) __swap16((uint16_t) (X))) << 16) | __swap16((uint16_t) ((X) >> 16)))
+    #define __swap64(X)                     ((((uint64_t) __swap32((uint32_t) (X))) << 32) | __swap32((uint32_t) ((X) >> 32)))
+#endif
+
+// vector operations of each instruction set, swap reverse bytes of each item in vector
+#if REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_AVX2
+    #define REFLEX_SIMD_VECTOR_SIZE         32
+    #define __loadVector(P)                 _mm256_loadu_si256((const __m256i*) (P))
+    #define __storeVector(P, V)             _mm256_storeu_si256((__m256i*) (P), V)
+    #define __swapVector16(V)               _mm256_shuffle_epi8(V, _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, \
+                                                                                    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14))
+    #define __swapVector32(V)               _mm256_shuffle_epi8(V, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, \
+                                                                                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12))
+    #define __swapVector64(V)               _mm256_shuffle_epi8(V, _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, \
+                                                                                    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8))
+    #define REFLEX_SIMD_MASK_BITS           1
+    #define __byteVector(C)                 _mm256_set1_epi8((char) (C))
+    #define __equalVector(V, C)             _mm256_cmpeq_epi8(V, __byteVector(C))
+    #define __orVector(A, B)                _mm256_or_si256(A, B)
+    #define __lessVector(V, C)              _mm256_cmpeq_epi8(_mm256_min_epu8(V, __byteVector((C) - 1)), V)
+    #define __maskVector(V)                 ((uint64_t) (uint32_t) _mm256_movemask_epi8(V))
+#elif REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_SSSE3
+    #define REFLEX_SIMD_VECTOR_SIZE         16
+    #define __loadVector(P)                 _mm_loadu_si128((const __m128i*) (P))
+    #define __storeVector(P, V)             _mm_storeu_si128((__m128i*) (P), V)
+    #define __swapVector16(V)               _mm_shuffle_epi8(V, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14))
+    #define __swapVector32(V)               _mm_shuffle_epi8(V, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12))
+    #define __swapVector64(V)               _mm_shuffle_epi8(V, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8))
+    #define REFLEX_SIMD_MASK_BITS           1
+    #define __byteVector(C)                 _mm_set1_epi8((char) (C))
+    #define __equalVector(V, C)             _mm_cmpeq_epi8(V, __byteVector(C))
+    #define __orVector(A, B)                _mm_or_si128(A, B)
+    #define __lessVector(V, C)              _mm_cmpeq_epi8(_mm_min_epu8(V, __byteVector((C) - 1)), V)
+    #define __maskVector(V)                 ((uint64_t) (uint32_t) _mm_movemask_epi8(V))
+#elif REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_SSE2
+    // SSE2 has no byte shuffle, bytes of 16-bit words are swapped with shifts then words are shuffled
+    #define REFLEX_SIMD_VECTOR_SIZE         16
+    #define __loadVector(P)                 _mm_loadu_si128((const __m128i*) (P))
+    #define __storeVector(P, V)             _mm_storeu_si128((__m128i*) (P), V)
+    #define __swapVector16(V)               _mm_or_si128(_mm_slli_epi16(V, 8), _mm_srli_epi16(V, 8))
+    #define __swapVector32(V)               _mm_shufflehi_epi16(_mm_shufflelo_epi16(__swapVector16(V), _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1))
+    #define __swapVector64(V)               _mm_shufflehi_epi16(_mm_shufflelo_epi16(__swapVector16(V), _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3))
+    #define REFLEX_SIMD_MASK_BITS           1
+    #define __byteVector(C)                 _mm_set1_epi8((char) (C))
+    #define __equalVector(V, C)             _mm_cmpeq_epi8(V, __byteVector(C))
+    #define __orVector(A, B)                _mm_or_si128(A, B)
+    #define __lessVector(V, C)              _mm_cmpeq_epi8(_mm_min_epu8(V, __byteVector((C) - 1)), V)
+    #define __maskVector(V)                 ((uint64_t) (uint32_t) _mm_movemask_epi8(V))
+#elif REFLEX_PACKER_SIMD == REFLEX_PACKER_SIMD_NEON
+    #define REFLEX_SIMD_VECTOR_SIZE         16
+    #define __loadVector(P)                 vld1q_u8((const uint8_t*) (P))
+    #define __storeVector(P, V)             vst1q_u8((uint8_t*) (P), V)
+    #define __swapVector16(V)               vrev16q_u8(V)
+    #define __swapVector32(V)               vrev32q_u8(V)
+    #define __swapVector64(V)               vrev64q_u8(V)
+    // NEON has no move mask, each byte of compare is narrowed to 4 bits
+    #define REFLEX_SIMD_MASK_BITS           4
+    #define __byteVector(C)                 vdupq_n_u8((uint8_t) (C))
+    #define __equalVector(V, C)             vceqq_u8(V, __byteVector(C))
+    #define __orVector(A, B)                vorrq_u8(A, B)
+    #define __lessVector(V, C)              vcltq_u8(V, __byteVector(C))
+    #define __maskVector(V)                 vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(V), 4)), 0)
+#else
+    #define REFLEX_SIMD_VECTOR_SIZE         0
+#endif
+
+#endif // _REFLEX_SIMD_H_